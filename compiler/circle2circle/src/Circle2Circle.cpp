@@ -53,6 +53,18 @@ void print_help(const char *progname)
   std::cerr << "Require two following parameters (input_dtype, output_dtype)" << std::endl;
   std::cerr << "                            ";
   std::cerr << "Ex: --quantize_dequantize_weights float32 uint8" << std::endl;
+  std::cerr << "   --quantize_granularity : Granularity of quantization parameters of weights"
+            << std::endl;
+  std::cerr << "                            ";
+  std::cerr << "Require one following parameter (layer or channel, default: layer)" << std::endl;
+  std::cerr << "                            ";
+  std::cerr << "Ex: --quantize_granularity channel" << std::endl;
+  std::cerr << "                            ";
+  std::cerr << "layer requires output_dtype uint8, and channel requires output_dtype int8"
+            << std::endl;
+  std::cerr << "                            ";
+  std::cerr << "Ex: --quantize_with_minmax float32 int8 --quantize_granularity channel"
+            << std::endl;
   std::cerr << std::endl;
 }
 
@@ -124,6 +136,19 @@ int entry(int argc, char **argv)
     return 2;
   };
 
+  argparse["--quantize_granularity"] = [&options](const char **argv) {
+    if (argv[0] == nullptr)
+      throw std::runtime_error("--quantize_granularity must have one following parameter.");
+
+    std::string granularity = argv[0];
+
+    if (granularity.compare("layer") != 0 && granularity.compare("channel") != 0)
+      throw std::runtime_error("Wrong algorithm parameter for --quantize_granularity.");
+
+    options->param(AlgorithmParameters::Quantize_granularity, granularity);
+    return 1;
+  };
+
   for (int n = 1; n < argc - 2; ++n)
   {
     const std::string tag{argv[n]};
@@ -39,6 +39,15 @@ public:
    * @return false if there was nothing changed
    */
   virtual bool run(loco::Graph *graph) = 0;
+
+public:
+  /**
+   * @brief  Return true if a change at the given node may give this pass something to change
+   *
+   * PhaseRunner<PhaseStrategy::Worklist> reruns a pass only when a change since its last run
+   * touched a node it is interested in. A pass is interested in every node by default.
+   */
+  virtual bool interested(const loco::Node *) const { return true; }
 };
 
 std::string pass_name(const Pass *);
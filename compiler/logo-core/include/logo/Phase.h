@@ -21,6 +21,7 @@
 
 #include <loco.h>
 
+#include <chrono>
 #include <vector>
 #include <memory>
 
@@ -70,9 +71,14 @@ public:
   void changed(bool changed) { _changed = changed; }
   bool changed(void) const { return _changed; }
 
+  // Wall-clock time taken by the pass
+  void elapsed(std::chrono::microseconds elapsed) { _elapsed = elapsed; }
+  std::chrono::microseconds elapsed(void) const { return _elapsed; }
+
 private:
   const Pass *_pass;
   bool _changed;
+  std::chrono::microseconds _elapsed{0};
 };
 
 struct PhaseEventListener
@@ -130,7 +136,7 @@ public:
     }
   }
 
-  void notifyPassEnd(Pass *pass, bool changed) const
+  void notifyPassEnd(Pass *pass, bool changed, std::chrono::microseconds elapsed) const
   {
     if (_listener)
     {
@@ -138,6 +144,7 @@ public:
 
       info.pass(pass);
       info.changed(changed);
+      info.elapsed(elapsed);
 
       _listener->notify(&info);
     }
@@ -153,6 +160,9 @@ enum class PhaseStrategy
   Saturate,
   // Same as Saturate but will restart from the first when there is a change
   Restart,
+  // Same as Saturate but will rerun only the passes which are interested in the nodes touched
+  // by a change since their last run
+  Worklist,
 };
 
 template <PhaseStrategy S> class PhaseRunner;
@@ -187,6 +197,21 @@ private:
   loco::Graph *_graph;
 };
 
+template <> class PhaseRunner<PhaseStrategy::Worklist> final : public PhaseRunnerMixinObservable
+{
+public:
+  PhaseRunner(loco::Graph *graph) : _graph{graph}
+  {
+    // DO NOTHING
+  }
+
+public:
+  void run(const Phase &) const;
+
+private:
+  loco::Graph *_graph;
+};
+
 } // namespace logo
 
 #endif // __LOGO_PHASE_H__
@@ -16,6 +16,156 @@
 
 #include <logo/Phase.h>
 
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <set>
+#include <unordered_map>
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+std::chrono::microseconds elapsed_since(const Clock::time_point &begin)
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - begin);
+}
+
+/**
+ * @brief Identifier of a node that is never reused while the process is alive
+ *
+ * NOTE The address of a destroyed node may be reused by a node created later, so it cannot tell
+ *      whether a node in a snapshot is the same node in a later snapshot.
+ */
+struct NodeId final : public loco::NodeAnnotation
+{
+  explicit NodeId(uint64_t value) : value{value} {}
+
+  uint64_t value;
+};
+
+uint64_t node_id(loco::Node *node)
+{
+  static std::atomic<uint64_t> next_id{1};
+
+  if (auto id = node->annot<NodeId>())
+    return id->value;
+
+  auto value = next_id.fetch_add(1);
+  node->annot(std::make_unique<NodeId>(value));
+  return value;
+}
+
+struct NodeState
+{
+  // NOTE This is valid while the node is alive, that is in the latest snapshot only
+  loco::Node *node;
+  const loco::Dialect *dialect;
+  uint32_t opnum;
+  // Identifiers of arguments, 0 for an argument which is not set
+  std::vector<uint64_t> args;
+
+  bool operator==(const NodeState &rhs) const
+  {
+    return dialect == rhs.dialect && opnum == rhs.opnum && args == rhs.args;
+  }
+};
+
+using GraphState = std::unordered_map<uint64_t, NodeState>;
+
+GraphState snapshot(loco::Graph *g)
+{
+  GraphState state;
+
+  for (uint32_t n = 0; n < g->nodes()->size(); ++n)
+  {
+    auto node = g->nodes()->at(n);
+    auto &node_state = state[node_id(node)];
+
+    node_state.node = node;
+    node_state.dialect = node->dialect();
+    node_state.opnum = node->opnum();
+    for (uint32_t i = 0; i < node->arity(); ++i)
+    {
+      auto arg = node->arg(i);
+      node_state.args.emplace_back(arg == nullptr ? 0 : node_id(arg));
+    }
+  }
+
+  return state;
+}
+
+/**
+ * @brief Remove NodeId annotations from every node of a graph when going out of scope, also when
+ *        a pass throws
+ */
+class NodeIdScope final
+{
+public:
+  explicit NodeIdScope(loco::Graph *g) : _graph{g} {}
+  ~NodeIdScope()
+  {
+    for (uint32_t n = 0; n < _graph->nodes()->size(); ++n)
+    {
+      _graph->nodes()->at(n)->annot<NodeId>(nullptr);
+    }
+  }
+
+  NodeIdScope(const NodeIdScope &) = delete;
+  NodeIdScope &operator=(const NodeIdScope &) = delete;
+
+private:
+  loco::Graph *_graph;
+};
+
+/**
+ * @brief Return nodes that are created or whose arguments are changed between two states, with
+ *        their old and new arguments whose uses are changed
+ */
+std::set<loco::Node *> touched(const GraphState &before, const GraphState &after)
+{
+  std::set<loco::Node *> nodes;
+
+  auto insert_alive = [&](const std::vector<uint64_t> &args) {
+    for (auto arg : args)
+    {
+      auto it = after.find(arg);
+      if (it != after.end())
+        nodes.insert(it->second.node);
+    }
+  };
+
+  for (const auto &e : after)
+  {
+    auto it = before.find(e.first);
+    if (it != before.end() && it->second == e.second)
+      continue;
+
+    nodes.insert(e.second.node);
+    insert_alive(e.second.args);
+    if (it != before.end())
+      insert_alive(it->second.args);
+  }
+
+  // Arguments of destroyed nodes lose their uses
+  for (const auto &e : before)
+  {
+    if (after.find(e.first) == after.end())
+      insert_alive(e.second.args);
+  }
+
+  return nodes;
+}
+
+bool interested(const logo::Pass *pass, const std::set<loco::Node *> &nodes)
+{
+  return std::any_of(nodes.begin(), nodes.end(),
+                     [pass](const loco::Node *node) { return pass->interested(node); });
+}
+
+} // namespace
+
 namespace logo
 {
 
@@ -31,10 +181,11 @@ void PhaseRunner<PhaseStrategy::Saturate>::run(const Phase &phase) const
     {
       notifyPassBegin(pass.get());
 
+      auto begin = Clock::now();
       bool pass_changed = pass->run(_graph);
       changed = changed || pass_changed;
 
-      notifyPassEnd(pass.get(), pass_changed);
+      notifyPassEnd(pass.get(), pass_changed, elapsed_since(begin));
     }
   }
 
@@ -53,10 +204,11 @@ void PhaseRunner<PhaseStrategy::Restart>::run(const Phase &phase) const
     {
       notifyPassBegin(pass.get());
 
+      auto begin = Clock::now();
       bool pass_changed = pass->run(_graph);
       changed = changed || pass_changed;
 
-      notifyPassEnd(pass.get(), pass_changed);
+      notifyPassEnd(pass.get(), pass_changed, elapsed_since(begin));
 
       if (changed)
       {
@@ -68,4 +220,50 @@ void PhaseRunner<PhaseStrategy::Restart>::run(const Phase &phase) const
   notifyPhaseEnd();
 }
 
+void PhaseRunner<PhaseStrategy::Worklist>::run(const Phase &phase) const
+{
+  notifyPhaseBegin();
+
+  // Every pass runs at least once
+  std::vector<bool> pending(phase.size(), true);
+  NodeIdScope ids{_graph};
+  auto state = snapshot(_graph);
+
+  while (std::find(pending.begin(), pending.end(), true) != pending.end())
+  {
+    for (uint32_t n = 0; n < phase.size(); ++n)
+    {
+      if (!pending.at(n))
+        continue;
+
+      auto &pass = phase.at(n);
+
+      notifyPassBegin(pass.get());
+
+      auto begin = Clock::now();
+      bool pass_changed = pass->run(_graph);
+      pending.at(n) = false;
+
+      notifyPassEnd(pass.get(), pass_changed, elapsed_since(begin));
+
+      if (!pass_changed)
+        continue;
+
+      auto new_state = snapshot(_graph);
+      auto nodes = touched(state, new_state);
+      state = std::move(new_state);
+
+      // A change which touches no node is on attributes of nodes, such as shape annotations,
+      // so every pass is rerun as Saturate does
+      for (uint32_t m = 0; m < phase.size(); ++m)
+      {
+        if (!pending.at(m))
+          pending.at(m) = nodes.empty() || interested(phase.at(m).get(), nodes);
+      }
+    }
+  }
+
+  notifyPhaseEnd();
+}
+
 } // namespace logo
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <logo/Phase.h>
+
+#include <loco.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+// Insert a Forward node before Push once
+struct InsertForwardPass final : public logo::Pass
+{
+  bool run(loco::Graph *g) final
+  {
+    ++runs;
+    auto push = loco::must_cast<loco::Push *>(loco::output_nodes(g).at(0));
+    if (dynamic_cast<loco::Forward *>(push->from()))
+      return false;
+
+    auto forward = g->nodes()->create<loco::Forward>();
+    forward->input(push->from());
+    push->from(forward);
+    return true;
+  }
+
+  uint32_t runs = 0;
+};
+
+// Replace ReLU before Push with a new one of the same input once, and create an unused Forward
+struct RecreateReLUPass final : public logo::Pass
+{
+  bool run(loco::Graph *g) final
+  {
+    if (done)
+      return false;
+
+    auto push = loco::must_cast<loco::Push *>(loco::output_nodes(g).at(0));
+    auto relu = loco::must_cast<loco::ReLU *>(push->from());
+    auto input = relu->input();
+
+    // Destroy first so that the new node may take the address of the old one
+    push->from(nullptr);
+    relu->drop();
+    g->nodes()->destroy(relu);
+
+    auto new_relu = g->nodes()->create<loco::ReLU>();
+    new_relu->input(input);
+    push->from(new_relu);
+
+    g->nodes()->create<loco::Forward>();
+
+    done = true;
+    return true;
+  }
+
+  bool done = false;
+};
+
+// Count runs without changing the graph
+template <typename Interest> struct CountPass final : public logo::Pass
+{
+  bool run(loco::Graph *) final
+  {
+    ++runs;
+    return false;
+  }
+
+  bool interested(const loco::Node *node) const final
+  {
+    return dynamic_cast<const Interest *>(node) != nullptr;
+  }
+
+  uint32_t runs = 0;
+};
+
+struct PassEndCounter final : public logo::PhaseEventListener
+{
+  void notify(const logo::PhaseEventInfo<logo::PhaseEvent::PassEnd> *info) final
+  {
+    ++count;
+    ASSERT_GE(info->elapsed().count(), 0);
+  }
+
+  uint32_t count = 0;
+};
+
+std::unique_ptr<loco::Graph> make_pull_push_graph(void)
+{
+  auto g = loco::make_graph();
+
+  auto pull = g->nodes()->create<loco::Pull>();
+  auto push = g->nodes()->create<loco::Push>();
+  push->from(pull);
+
+  auto input = g->inputs()->create();
+  loco::link(input, pull);
+  auto output = g->outputs()->create();
+  loco::link(output, push);
+
+  return g;
+}
+
+} // namespace
+
+TEST(LogoPhaseTests, worklist_reruns_interested_passes_only)
+{
+  auto g = make_pull_push_graph();
+
+  logo::Phase phase;
+  phase.emplace_back(std::make_unique<CountPass<loco::Forward>>());
+  phase.emplace_back(std::make_unique<CountPass<loco::ReLU>>());
+  phase.emplace_back(std::make_unique<InsertForwardPass>());
+
+  auto forward_pass = dynamic_cast<CountPass<loco::Forward> *>(phase.at(0).get());
+  auto relu_pass = dynamic_cast<CountPass<loco::ReLU> *>(phase.at(1).get());
+  auto insert_pass = dynamic_cast<InsertForwardPass *>(phase.at(2).get());
+
+  PassEndCounter counter;
+  logo::PhaseRunner<logo::PhaseStrategy::Worklist> runner{g.get()};
+  runner.attach(&counter);
+  runner.run(phase);
+
+  // The inserted Forward node is of interest to the first pass only
+  ASSERT_EQ(forward_pass->runs, 2);
+  ASSERT_EQ(relu_pass->runs, 1);
+  ASSERT_EQ(insert_pass->runs, 2);
+  ASSERT_EQ(counter.count, 5);
+}
+
+TEST(LogoPhaseTests, worklist_tells_recreated_node)
+{
+  auto g = make_pull_push_graph();
+  {
+    auto push = loco::must_cast<loco::Push *>(loco::output_nodes(g.get()).at(0));
+    auto relu = g->nodes()->create<loco::ReLU>();
+    relu->input(push->from());
+    push->from(relu);
+  }
+
+  logo::Phase phase;
+  phase.emplace_back(std::make_unique<CountPass<loco::ReLU>>());
+  phase.emplace_back(std::make_unique<RecreateReLUPass>());
+
+  auto relu_pass = dynamic_cast<CountPass<loco::ReLU> *>(phase.at(0).get());
+
+  logo::PhaseRunner<logo::PhaseStrategy::Worklist> runner{g.get()};
+  runner.run(phase);
+
+  // The new ReLU node is touched even if it reuses the address of the destroyed one
+  ASSERT_EQ(relu_pass->runs, 2);
+}
+
+TEST(LogoPhaseTests, saturate_reruns_all_passes)
+{
+  auto g = make_pull_push_graph();
+
+  logo::Phase phase;
+  phase.emplace_back(std::make_unique<CountPass<loco::ReLU>>());
+  phase.emplace_back(std::make_unique<InsertForwardPass>());
+
+  auto relu_pass = dynamic_cast<CountPass<loco::ReLU> *>(phase.at(0).get());
+
+  logo::PhaseRunner<logo::PhaseStrategy::Saturate> runner{g.get()};
+  runner.run(phase);
+
+  ASSERT_EQ(relu_pass->runs, 2);
+}
@@ -39,6 +39,7 @@ struct RemoveForwardNodePass final : public Pass
   const char *name(void) const final { return "RemoveForwardNodePass"; }
 
   bool run(loco::Graph *g) final;
+  bool interested(const loco::Node *node) const final;
 };
 
 } // namespace logo
@@ -34,6 +34,7 @@ public:
 
 public:
   bool run(loco::Graph *graph) override;
+  bool interested(const loco::Node *node) const override;
 };
 
 } // namespace logo
@@ -61,4 +61,9 @@ bool RemoveForwardNodePass::run(loco::Graph *g)
   return collector.candidates.size() > 0;
 }
 
+bool RemoveForwardNodePass::interested(const loco::Node *node) const
+{
+  return dynamic_cast<const loco::Forward *>(node) != nullptr;
+}
+
 } // namespace logo
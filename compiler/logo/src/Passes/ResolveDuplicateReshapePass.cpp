@@ -105,4 +105,9 @@ bool ResolveDuplicateReshapePass::run(loco::Graph *graph)
   return changed;
 }
 
+bool ResolveDuplicateReshapePass::interested(const loco::Node *node) const
+{
+  return dynamic_cast<const loco::FixedReshape *>(node) != nullptr;
+}
+
 } // namespace logo
@@ -100,4 +100,9 @@ bool ResolveRedundantReshapePass::run(loco::Graph *graph)
   return changed;
 }
 
+bool ResolveRedundantReshapePass::interested(const loco::Node *node) const
+{
+  return dynamic_cast<const loco::FixedReshape *>(node) != nullptr;
+}
+
 } // namespace logo
@@ -36,9 +36,27 @@ public:
   virtual ~ExecutionObserver();
 
   // Called when the value of a tensor has been updated during execution.
+  // The memory of the tensor may be reused by other tensors afterwards, so the tensor is valid
+  // only during the call.
   virtual void postTensorWrite(const luci::CircleNode *node, const Tensor *tensor);
 };
 
+// Memory used by the tensors of a model, in bytes.
+struct MemoryStats
+{
+  // Size of the tensors which are not planned, i.e. inputs and outputs.
+  size_t static_size = 0;
+  // Size of the constants, which are not copied but use the memory of the module.
+  size_t constant_size = 0;
+  // Sum of the sizes of the intermediate tensors, i.e. their memory without planning.
+  size_t intermediate_size = 0;
+  // Size of the arena shared by the intermediate tensors.
+  size_t arena_size = 0;
+
+  // Peak memory of the tensors owned by the interpreter.
+  size_t peak_size() const { return static_size + arena_size; }
+};
+
 class Interpreter
 {
 public:
@@ -46,6 +64,9 @@ public:
 
   ~Interpreter();
 
+  // Tensor of an input node, ex. to read input data into the tensor directly.
+  Tensor *getInputTensor(const luci::CircleInput *input_node);
+
   void writeInputTensor(const luci::CircleInput *input_node, const void *data, size_t data_size);
 
   void readOutputTensor(const luci::CircleOutput *output_node, void *data, size_t data_size);
@@ -54,14 +75,20 @@ public:
 
   void attachObserver(ExecutionObserver *observer);
 
+  const MemoryStats &memoryStats() const { return _memory_stats; }
+
 private:
   void createTensors(const loco::Graph *graph);
   void createKernels(const loco::Graph *graph);
+  void planTensors(const std::vector<const luci::CircleNode *> &execution_order);
 
   const loco::Graph *_main_graph = nullptr;
   std::unique_ptr<class TensorMap> _tensor_map;
   std::unique_ptr<class KernelMap> _kernel_map;
   std::vector<ExecutionObserver *> _observers;
+  // Memory shared by the intermediate tensors
+  std::unique_ptr<uint8_t[]> _arena;
+  MemoryStats _memory_stats;
 };
 
 } // namespace luci_interpreter
@@ -23,6 +23,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace luci_interpreter
@@ -107,9 +108,9 @@ public:
     return _quantization.zero_point[0];
   }
 
-  template <typename T> const T *data() const { return reinterpret_cast<const T *>(_data.get()); }
+  template <typename T> const T *data() const { return reinterpret_cast<const T *>(_data_ptr); }
 
-  template <typename T> T *data() { return reinterpret_cast<T *>(_data.get()); }
+  template <typename T> T *data() { return reinterpret_cast<T *>(_data_ptr); }
 
   const std::string &name() const { return _name; }
 
@@ -119,11 +120,26 @@ public:
 
   void resize(const Shape &new_shape);
 
+  // Size of the tensor data in bytes.
+  size_t size_in_bytes() const;
+
+  // Frees the memory of the tensor and stops allocating memory on 'resize'. The memory has to be
+  // assigned with 'setDataBuffer' afterwards, ex. from an arena shared with other tensors.
+  void disableAllocation();
+
+  // Makes the tensor use 'buffer' which is owned by someone else. Allocation has to be disabled.
+  void setDataBuffer(uint8_t *buffer);
+
+private:
+  void allocate();
+
 private:
   DataType _element_type;
   Shape _shape;
   AffineQuantization _quantization;
   std::unique_ptr<uint8_t[]> _data;
+  uint8_t *_data_ptr = nullptr;
+  bool _is_allocatable = true;
   std::string _name;
 };
 
@@ -19,11 +19,13 @@
 #include "KernelBuilder.h"
 #include "KernelMap.h"
 #include "TensorMap.h"
+#include "core/MemoryPlanner.h"
 
 #include <loco/IR/Algorithm.h>
 
 #include <algorithm>
 #include <stdexcept>
+#include <unordered_map>
 
 namespace luci_interpreter
 {
@@ -97,6 +99,30 @@ static bool isTensorProducingNode(const luci::CircleNode *node)
   }
 }
 
+// Intermediate tensors live in memory shared with other tensors, while inputs, outputs and
+// constants have their own memory, because they are accessed out of execution.
+static bool isPlannedNode(const luci::CircleNode *node)
+{
+  if (!isTensorProducingNode(node))
+    return false;
+
+  switch (node->opcode())
+  {
+    case luci::CircleOpcode::CONST:
+    case luci::CircleOpcode::CIRCLEINPUT:
+      return false;
+    default:
+      break;
+  }
+
+  for (const loco::Node *succ : loco::succs(node))
+  {
+    if (dynamic_cast<const luci::CircleOutput *>(succ) != nullptr)
+      return false;
+  }
+  return true;
+}
+
 void Interpreter::createTensors(const loco::Graph *graph)
 {
   for (uint32_t i = 0; i < graph->nodes()->size(); ++i)
@@ -132,13 +158,81 @@ void Interpreter::createTensors(const loco::Graph *graph)
     {
       size_t data_size{};
       const void *const_data = getNodeData(const_node, &data_size);
-      tensor->writeData(const_data, data_size);
+      if (data_size != tensor->size_in_bytes())
+        throw std::runtime_error("Invalid data size of constant \"" + node->name() + "\".");
+      // Kernels do not write constants, so the tensor can use the memory of the node itself, which
+      // is then shared by all the interpreters of the module.
+      tensor->disableAllocation();
+      tensor->setDataBuffer(static_cast<uint8_t *>(const_cast<void *>(const_data)));
     }
 
+    if (isPlannedNode(node))
+      tensor->disableAllocation();
+
     _tensor_map->setTensor(node, std::move(tensor));
   }
 }
 
+void Interpreter::planTensors(const std::vector<const luci::CircleNode *> &execution_order)
+{
+  struct Lifetime
+  {
+    uint32_t first_step;
+    uint32_t last_step;
+  };
+
+  // A tensor is alive from the step that writes it to the last step that reads it, or that
+  // notifies the observers of it, so that the observers see the tensor before it is overwritten.
+  std::unordered_map<const loco::Node *, uint32_t> steps;
+  std::unordered_map<const luci::CircleNode *, Lifetime> lifetimes;
+  for (uint32_t step = 0; step < execution_order.size(); ++step)
+  {
+    const luci::CircleNode *node = execution_order[step];
+    steps.emplace(node, step);
+
+    for (uint32_t i = 0; i < node->arity(); ++i)
+    {
+      const auto it = lifetimes.find(loco::must_cast<const luci::CircleNode *>(node->arg(i)));
+      if (it != lifetimes.end())
+        it->second.last_step = step;
+    }
+
+    if (isPlannedNode(node))
+    {
+      // Outputs of multiple-output nodes are written by the step of the node
+      const uint32_t first_step = isExecutableNode(node) ? step : steps.at(node->arg(0));
+      lifetimes.emplace(node, Lifetime{first_step, step});
+    }
+    else if (isTensorProducingNode(node))
+    {
+      const size_t size = _tensor_map->getTensor(node)->size_in_bytes();
+      if (node->opcode() == luci::CircleOpcode::CONST)
+        _memory_stats.constant_size += size;
+      else
+        _memory_stats.static_size += size;
+    }
+  }
+
+  MemoryPlanner planner;
+  for (const auto &node_lifetime : lifetimes)
+  {
+    const Tensor *tensor = _tensor_map->getTensor(node_lifetime.first);
+    const Lifetime &lifetime = node_lifetime.second;
+    planner.claim(tensor, tensor->size_in_bytes(), lifetime.first_step, lifetime.last_step);
+  }
+  planner.plan();
+
+  _arena = std::make_unique<uint8_t[]>(planner.capacity());
+  for (const auto &node_lifetime : lifetimes)
+  {
+    Tensor *tensor = _tensor_map->getTensor(node_lifetime.first);
+    tensor->setDataBuffer(_arena.get() + planner.offset(tensor));
+  }
+
+  _memory_stats.intermediate_size = planner.total_size();
+  _memory_stats.arena_size = planner.capacity();
+}
+
 void Interpreter::createKernels(const loco::Graph *graph)
 {
   KernelBuilder kernel_builder(*_tensor_map);
@@ -173,10 +267,12 @@ Interpreter::Interpreter(const luci::Module *module)
   // TODO Some kernels (ex. Reshape, Pad) need some of their input tensors (ex 'shape', 'paddings')
   //  to be known in order to configure properly. This means that 'configure' and 'execute' steps
   //  should be interleaved. For now such 'dynamic' tensors are not supported.
+  std::vector<const luci::CircleNode *> execution_order;
   for (const loco::Node *loco_node :
        loco::postorder_traversal(loco::output_nodes(const_cast<loco::Graph *>(_main_graph))))
   {
     const auto *node = loco::must_cast<const luci::CircleNode *>(loco_node);
+    execution_order.push_back(node);
 
     if (isExecutableNode(node))
     {
@@ -184,12 +280,14 @@ Interpreter::Interpreter(const luci::Module *module)
       kernel->configure();
     }
   }
+
+  // Shapes of all the tensors are known after configuration, so their memory can be planned.
+  planTensors(execution_order);
 }
 
 Interpreter::~Interpreter() = default;
 
-void Interpreter::writeInputTensor(const luci::CircleInput *input_node, const void *data,
-                                   size_t data_size)
+Tensor *Interpreter::getInputTensor(const luci::CircleInput *input_node)
 {
   Tensor *tensor = _tensor_map->getTensor(input_node);
   if (tensor == nullptr)
@@ -197,7 +295,13 @@ void Interpreter::writeInputTensor(const luci::CircleInput *input_node, const vo
     const std::string &name = input_node->name();
     throw std::runtime_error("Cannot find tensor for input node named \"" + name + "\".");
   }
-  tensor->writeData(data, data_size);
+  return tensor;
+}
+
+void Interpreter::writeInputTensor(const luci::CircleInput *input_node, const void *data,
+                                   size_t data_size)
+{
+  getInputTensor(input_node)->writeData(data, data_size);
 }
 
 void Interpreter::readOutputTensor(const luci::CircleOutput *output_node, void *data,
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/MemoryPlanner.h"
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+namespace luci_interpreter
+{
+
+constexpr size_t MemoryPlanner::alignment;
+
+void MemoryPlanner::claim(const Tensor *tensor, size_t size, uint32_t first_step,
+                          uint32_t last_step)
+{
+  assert(first_step <= last_step);
+  const size_t aligned_size = (size + alignment - 1) / alignment * alignment;
+  _claims.push_back({tensor, aligned_size, first_step, last_step, 0});
+  _total_size += aligned_size;
+}
+
+void MemoryPlanner::plan()
+{
+  // Place larger tensors first, earlier tensors first among the ones of the same size
+  std::stable_sort(_claims.begin(), _claims.end(), [](const Claim &lhs, const Claim &rhs) {
+    return lhs.size > rhs.size;
+  });
+
+  std::vector<const Claim *> interferences;
+  for (size_t i = 0; i < _claims.size(); ++i)
+  {
+    Claim &claim = _claims[i];
+
+    // Placed tensors which are alive at the same time, in ascending order of offset
+    interferences.clear();
+    for (size_t j = 0; j < i; ++j)
+    {
+      const Claim &placed = _claims[j];
+      if (placed.first_step <= claim.last_step && claim.first_step <= placed.last_step)
+        interferences.push_back(&placed);
+    }
+    std::sort(interferences.begin(), interferences.end(),
+              [](const Claim *lhs, const Claim *rhs) { return lhs->offset < rhs->offset; });
+
+    size_t offset = 0;
+    for (const Claim *placed : interferences)
+    {
+      if (offset + claim.size <= placed->offset)
+        break;
+      offset = std::max(offset, placed->offset + placed->size);
+    }
+
+    claim.offset = offset;
+    _offsets[claim.tensor] = offset;
+    _capacity = std::max(_capacity, offset + claim.size);
+  }
+}
+
+size_t MemoryPlanner::offset(const Tensor *tensor) const
+{
+  const auto it = _offsets.find(tensor);
+  if (it == _offsets.cend())
+  {
+    throw std::runtime_error("Tensor \"" + tensor->name() + "\" is not planned.");
+  }
+  return it->second;
+}
+
+} // namespace luci_interpreter
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LUCI_INTERPRETER_CORE_MEMORYPLANNER_H
+#define LUCI_INTERPRETER_CORE_MEMORYPLANNER_H
+
+#include "luci_interpreter/core/Tensor.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace luci_interpreter
+{
+
+// Plans the memory of tensors in an arena, so that the tensors which are not alive at the same
+// time may share memory.
+//
+// The lifetime of a tensor is the range of steps in execution order, from the step that writes
+// the tensor to the last step that reads it. Like onert's 'cpu_common::WICPlanner', tensors are
+// placed in descending order of size, each at the lowest offset which does not overlap with the
+// tensors already placed whose lifetimes overlap.
+class MemoryPlanner
+{
+public:
+  // Offsets and sizes in the arena are multiples of this.
+  static constexpr size_t alignment = 16;
+
+  // Claims 'size' bytes for 'tensor' which is alive from 'first_step' to 'last_step' inclusive.
+  void claim(const Tensor *tensor, size_t size, uint32_t first_step, uint32_t last_step);
+
+  // Assigns offsets to the claimed tensors. Has to be called after all the tensors are claimed.
+  void plan();
+
+  // Offset of a tensor in the arena.
+  size_t offset(const Tensor *tensor) const;
+
+  // Size of the arena, i.e. peak memory of the claimed tensors.
+  size_t capacity() const { return _capacity; }
+
+  // Sum of the sizes of the claimed tensors, i.e. their memory without planning.
+  size_t total_size() const { return _total_size; }
+
+private:
+  struct Claim
+  {
+    const Tensor *tensor;
+    size_t size;
+    uint32_t first_step;
+    uint32_t last_step;
+    size_t offset;
+  };
+
+  std::vector<Claim> _claims;
+  std::unordered_map<const Tensor *, size_t> _offsets;
+  size_t _capacity = 0;
+  size_t _total_size = 0;
+};
+
+} // namespace luci_interpreter
+
+#endif // LUCI_INTERPRETER_CORE_MEMORYPLANNER_H
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/MemoryPlanner.h"
+
+#include <gtest/gtest.h>
+
+namespace luci_interpreter
+{
+namespace
+{
+
+Tensor makeTensor(const std::string &name)
+{
+  return Tensor(DataType::FLOAT32, Shape{}, AffineQuantization{}, name);
+}
+
+TEST(MemoryPlannerTest, Chain)
+{
+  // a -> b -> c -> d, each tensor is read by the next step
+  Tensor a = makeTensor("a"), b = makeTensor("b"), c = makeTensor("c"), d = makeTensor("d");
+  MemoryPlanner planner;
+  planner.claim(&a, 64, 0, 1);
+  planner.claim(&b, 32, 1, 2);
+  planner.claim(&c, 64, 2, 3);
+  planner.claim(&d, 16, 3, 3);
+  planner.plan();
+
+  EXPECT_EQ(planner.offset(&a), 0);
+  EXPECT_EQ(planner.offset(&c), 0);
+  EXPECT_EQ(planner.offset(&b), 64);
+  EXPECT_EQ(planner.offset(&d), 64);
+  EXPECT_EQ(planner.capacity(), 96);
+  EXPECT_EQ(planner.total_size(), 176);
+}
+
+TEST(MemoryPlannerTest, FillsGap)
+{
+  Tensor a = makeTensor("a"), b = makeTensor("b"), c = makeTensor("c");
+  MemoryPlanner planner;
+  planner.claim(&a, 64, 0, 1);
+  planner.claim(&b, 64, 0, 3);
+  planner.claim(&c, 40, 2, 3);
+  planner.plan();
+
+  // 'c' takes the memory of 'a' below 'b'
+  EXPECT_EQ(planner.offset(&a), 0);
+  EXPECT_EQ(planner.offset(&b), 64);
+  EXPECT_EQ(planner.offset(&c), 0);
+  EXPECT_EQ(planner.capacity(), 128);
+  EXPECT_EQ(planner.total_size(), 176);
+}
+
+TEST(MemoryPlannerTest, Unplanned_NEG)
+{
+  Tensor a = makeTensor("a");
+  MemoryPlanner planner;
+  planner.plan();
+
+  EXPECT_ANY_THROW(planner.offset(&a));
+}
+
+} // namespace
+} // namespace luci_interpreter
@@ -27,16 +27,12 @@ Tensor::Tensor(DataType element_type, Shape shape, AffineQuantization quantizati
     : _element_type(element_type), _shape(std::move(shape)), _quantization(std::move(quantization)),
       _name(std::move(name))
 {
-  const size_t element_size = getDataTypeSize(_element_type);
-  const int32_t num_elements = _shape.num_elements();
-  _data = std::make_unique<uint8_t[]>(num_elements * element_size);
+  allocate();
 }
 
 void Tensor::readData(void *data_ptr, size_t data_size) const
 {
-  const size_t element_size = getDataTypeSize(element_type());
-  const int32_t num_elements = shape().num_elements();
-  if (data_size != num_elements * element_size)
+  if (data_size != size_in_bytes())
   {
     throw std::invalid_argument("Invalid data size.");
   }
@@ -45,9 +41,7 @@ void Tensor::readData(void *data_ptr, size_t data_size) const
 
 void Tensor::writeData(const void *data_ptr, size_t data_size)
 {
-  const size_t element_size = getDataTypeSize(element_type());
-  const int32_t num_elements = shape().num_elements();
-  if (data_size != num_elements * element_size)
+  if (data_size != size_in_bytes())
   {
     throw std::invalid_argument("Invalid data size.");
   }
@@ -57,9 +51,39 @@ void Tensor::writeData(const void *data_ptr, size_t data_size)
 void Tensor::resize(const Shape &new_shape)
 {
   _shape = new_shape;
+  if (_is_allocatable)
+  {
+    allocate();
+  }
+}
+
+size_t Tensor::size_in_bytes() const
+{
   const size_t element_size = getDataTypeSize(_element_type);
   const int32_t num_elements = _shape.num_elements();
-  _data = std::make_unique<uint8_t[]>(num_elements * element_size);
+  return num_elements * element_size;
+}
+
+void Tensor::disableAllocation()
+{
+  _is_allocatable = false;
+  _data.reset();
+  _data_ptr = nullptr;
+}
+
+void Tensor::setDataBuffer(uint8_t *buffer)
+{
+  if (_is_allocatable)
+  {
+    throw std::runtime_error("Tensor \"" + _name + "\" allocates its own memory.");
+  }
+  _data_ptr = buffer;
+}
+
+void Tensor::allocate()
+{
+  _data = std::make_unique<uint8_t[]>(size_in_bytes());
+  _data_ptr = _data.get();
 }
 
 } // namespace luci_interpreter
@@ -86,6 +86,10 @@ CircleConst *create_circleconst(GraphBuilderContext *context, int32_t tensor_ind
       copy_data<loco::DataType::U8>(buffer, num_elements, const_node);
       break;
 
+    case loco::DataType::S8:
+      copy_data<loco::DataType::S8>(buffer, num_elements, const_node);
+      break;
+
     case loco::DataType::S32:
       copy_data<loco::DataType::S32>(buffer, num_elements, const_node);
       break;
@@ -74,6 +74,7 @@ INSTANTIATE(loco::DataType::S64);
 INSTANTIATE(loco::DataType::S32);
 INSTANTIATE(loco::DataType::FLOAT32);
 INSTANTIATE(loco::DataType::U8);
+INSTANTIATE(loco::DataType::S8);
 INSTANTIATE(loco::DataType::BOOL);
 
 #undef INSTANTIATE
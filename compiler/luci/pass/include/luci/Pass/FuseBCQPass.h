@@ -31,6 +31,7 @@ struct FuseBCQPass final : public logo::Pass
   const char *name(void) const final { return "luci::FuseBCQPass"; }
 
   bool run(loco::Graph *g) final;
+  bool interested(const loco::Node *node) const final;
 };
 
 } // namespace luci
@@ -33,6 +33,7 @@ struct FuseInstanceNormPass final : public logo::Pass
   const char *name(void) const final { return "luci::FuseInstanceNormPass"; }
 
   bool run(loco::Graph *g) final;
+  bool interested(const loco::Node *node) const final;
 };
 
 } // namespace luci
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LUCI_QUANTIZATION_PARAMETERS_H__
+#define __LUCI_QUANTIZATION_PARAMETERS_H__
+
+namespace luci
+{
+
+/**
+ * @brief Granularity of quantization parameters of weights
+ * @note  LayerWise has a pair of scale and zero point for a tensor, and ChannelWise has a pair
+ *        for each output channel of Conv2D, DepthwiseConv2D and FullyConnected weights
+ *
+ *        LayerWise quantizes weights and activations to uint8, and requires the uint8 output
+ *        dtype. ChannelWise quantizes weights to symmetric int8 whose zero points are 0, and
+ *        activations to int8, and requires the int8 output dtype.
+ */
+enum QuantizationGranularity
+{
+  LayerWise = 0,
+  ChannelWise = 1,
+};
+
+} // namespace luci
+
+#endif // __LUCI_QUANTIZATION_PARAMETERS_H__
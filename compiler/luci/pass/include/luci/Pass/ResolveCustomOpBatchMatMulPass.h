@@ -30,6 +30,7 @@ struct ResolveCustomOpBatchMatMulPass final : public logo::Pass
   const char *name(void) const final { return "luci::ResolveCustomOpBatchMatMulPass"; }
 
   bool run(loco::Graph *g) final;
+  bool interested(const loco::Node *node) const final;
 };
 
 } // namespace luci
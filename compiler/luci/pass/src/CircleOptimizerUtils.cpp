@@ -58,4 +58,13 @@ loco::DataType str_to_dtype(const std::string &str)
   return loco::DataType::Unknown;
 }
 
+QuantizationGranularity str_to_granularity(const std::string &str)
+{
+  if (to_lower_case(str).compare("channel") == 0)
+    return QuantizationGranularity::ChannelWise;
+
+  // Layer-wise is the default, which keeps the behavior of callers not setting granularity
+  return QuantizationGranularity::LayerWise;
+}
+
 } // namespace luci
@@ -17,6 +17,8 @@
 #ifndef __LUCI_CIRCLE_OPTIMIZER_UTILS_H__
 #define __LUCI_CIRCLE_OPTIMIZER_UTILS_H__
 
+#include "luci/Pass/QuantizationParameters.h"
+
 #include <loco.h>
 
 #include <algorithm>
@@ -26,6 +28,8 @@ namespace luci
 
 loco::DataType str_to_dtype(const std::string &);
 
+QuantizationGranularity str_to_granularity(const std::string &);
+
 } // namespace luci
 
 #endif // __LUCI_CIRCLE_OPTIMIZER_UTILS_H__
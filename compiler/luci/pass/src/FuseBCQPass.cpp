@@ -365,4 +365,11 @@ bool FuseBCQPass::run(loco::Graph *g)
   return changed;
 }
 
+bool FuseBCQPass::interested(const loco::Node *node) const
+{
+  return dynamic_cast<const luci::CircleGather *>(node) != nullptr ||
+         dynamic_cast<const luci::CircleFullyConnected *>(node) != nullptr ||
+         dynamic_cast<const luci::CircleConst *>(node) != nullptr;
+}
+
 } // namespace luci
@@ -398,4 +398,16 @@ bool FuseInstanceNormPass::run(loco::Graph *g)
   return changed;
 }
 
+bool FuseInstanceNormPass::interested(const loco::Node *node) const
+{
+  // Kinds of nodes in the pattern, other than 'ifm'
+  return dynamic_cast<const luci::CircleAdd *>(node) != nullptr ||
+         dynamic_cast<const luci::CircleMul *>(node) != nullptr ||
+         dynamic_cast<const luci::CircleSub *>(node) != nullptr ||
+         dynamic_cast<const luci::CircleRsqrt *>(node) != nullptr ||
+         dynamic_cast<const luci::CircleMean *>(node) != nullptr ||
+         dynamic_cast<const luci::CircleSquaredDifference *>(node) != nullptr ||
+         dynamic_cast<const luci::CircleConst *>(node) != nullptr;
+}
+
 } // namespace luci
@@ -0,0 +1,355 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ * Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "QuantizationUtils.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace
+{
+
+using namespace luci;
+
+// Number of independent min/max lanes, which lets the compiler keep them in a vector register
+constexpr uint32_t kLanes = 8;
+
+// Loops below work on raw pointers, as CircleConst::at() is not inlined and keeps them scalar
+
+void min_max_of(const float *data, uint32_t size, float *min, float *max)
+{
+  float lane_min[kLanes];
+  float lane_max[kLanes];
+  std::fill(lane_min, lane_min + kLanes, std::numeric_limits<float>::max());
+  std::fill(lane_max, lane_max + kLanes, std::numeric_limits<float>::lowest());
+
+  uint32_t i = 0;
+  for (; i + kLanes <= size; i += kLanes)
+  {
+    for (uint32_t l = 0; l < kLanes; ++l)
+    {
+      lane_min[l] = std::min(lane_min[l], data[i + l]);
+      lane_max[l] = std::max(lane_max[l], data[i + l]);
+    }
+  }
+
+  float min_value = *std::min_element(lane_min, lane_min + kLanes);
+  float max_value = *std::max_element(lane_max, lane_max + kLanes);
+  for (; i < size; ++i)
+  {
+    min_value = std::min(min_value, data[i]);
+    max_value = std::max(max_value, data[i]);
+  }
+  *min = min_value;
+  *max = max_value;
+}
+
+// Quantize with round(zp + data / scale) clamped to [0, 255]. Values below zero are clamped
+// anyway, so truncation after adding 0.5 rounds half away from zero as std::round does.
+void quantize_u8(const float *data, uint32_t size, float scaling_factor_inv, float zp,
+                 uint8_t *quantized)
+{
+  for (uint32_t i = 0; i < size; ++i)
+  {
+    const int32_t value = static_cast<int32_t>(zp + data[i] * scaling_factor_inv + 0.5f);
+    quantized[i] = static_cast<uint8_t>(std::min(255, std::max(0, value)));
+  }
+}
+
+// Quantize with round(data / scale) clamped to [-127, 127]
+inline int8_t quantize_s8(float data, float scaling_factor_inv)
+{
+  const float value = std::round(data * scaling_factor_inv);
+  return static_cast<int8_t>(std::min(127.0f, std::max(-127.0f, value)));
+}
+
+// View a tensor as [outer, channels, inner] around channel_dim
+void split_by_channel(const CircleConst *node, int32_t channel_dim, uint32_t *outer,
+                      uint32_t *channels, uint32_t *inner)
+{
+  assert(channel_dim >= 0 && static_cast<uint32_t>(channel_dim) < node->rank());
+  *outer = 1;
+  *inner = 1;
+  for (int32_t i = 0; i < channel_dim; ++i)
+    *outer *= node->dim(i).value();
+  *channels = node->dim(channel_dim).value();
+  for (uint32_t i = channel_dim + 1; i < node->rank(); ++i)
+    *inner *= node->dim(i).value();
+}
+
+void replace_with_u8(CircleConst *node, const std::vector<uint8_t> &quantized)
+{
+  const auto size = static_cast<uint32_t>(quantized.size());
+  node->dtype(loco::DataType::U8);      // change the type of tensor
+  node->size<loco::DataType::U8>(size); // resize tensor
+  if (size > 0)
+    std::copy(quantized.begin(), quantized.end(), &node->at<loco::DataType::U8>(0));
+}
+
+void replace_with_s8(CircleConst *node, const std::vector<int8_t> &quantized)
+{
+  const auto size = static_cast<uint32_t>(quantized.size());
+  node->dtype(loco::DataType::S8);      // change the type of tensor
+  node->size<loco::DataType::S8>(size); // resize tensor
+  if (size > 0)
+    std::copy(quantized.begin(), quantized.end(), &node->at<loco::DataType::S8>(0));
+}
+
+// Return the dimension of output channels if the node is weights of the given layer, or -1
+int32_t weights_channel_dim_of(const CircleConst *node, loco::Node *layer)
+{
+  // OHWI
+  auto conv = dynamic_cast<CircleConv2D *>(layer);
+  if (conv != nullptr && conv->filter() == node)
+    return 0;
+
+  // 1HWC
+  auto dw_conv = dynamic_cast<CircleDepthwiseConv2D *>(layer);
+  if (dw_conv != nullptr && dw_conv->filter() == node)
+    return 3;
+
+  // OI
+  auto fc = dynamic_cast<CircleFullyConnected *>(layer);
+  if (fc != nullptr && fc->weights() == node)
+    return 0;
+
+  return -1;
+}
+
+} // namespace
+
+namespace luci
+{
+
+void compute_asym_scale_zp(float min, float max, float *scaling_factor, int64_t *zp)
+{
+  assert(min != max);
+  if (min == max)
+  {
+    *scaling_factor = 1;
+    *zp = 0;
+    return;
+  }
+  const int32_t kMinScale = 0;
+  const int32_t kMaxScale = 255;
+  const double qmin_double = kMinScale;
+  const double qmax_double = kMaxScale;
+  const double rmin = std::fmin(0, min);
+  const double rmax = std::fmax(0, max);
+
+  double scale = (rmax - rmin) / (qmax_double - qmin_double);
+  const double zero_point_from_min = qmin_double - rmin / scale;
+  const double zero_point_from_max = qmax_double - rmax / scale;
+  const double zero_point_from_min_error = std::abs(qmin_double) + std::abs(rmin / scale);
+  const double zero_point_from_max_error = std::abs(qmax_double) + std::abs(rmax / scale);
+  const double zero_point_double = zero_point_from_min_error < zero_point_from_max_error
+                                       ? zero_point_from_min
+                                       : zero_point_from_max;
+  int32_t nudged_zero_point = 0;
+  if (zero_point_double <= qmin_double)
+  {
+    nudged_zero_point = kMinScale;
+  }
+  else if (zero_point_double >= qmax_double)
+  {
+    nudged_zero_point = kMaxScale;
+  }
+  else
+  {
+    nudged_zero_point = static_cast<int32_t>(std::round(zero_point_double));
+  }
+  assert(nudged_zero_point >= kMinScale && nudged_zero_point <= kMaxScale);
+  *scaling_factor = scale;
+  *zp = nudged_zero_point;
+}
+
+void compute_sym_scale(float min, float max, float *scaling_factor)
+{
+  const int32_t kMaxScale = 127;
+  const float rmax = std::max(std::abs(min), std::abs(max));
+
+  // A channel of zeros is quantized to zeros with any scale
+  *scaling_factor = rmax == 0 ? 1.0f : rmax / kMaxScale;
+}
+
+void find_min_max(const CircleConst *node, float *min, float *max)
+{
+  const uint32_t size = node->size<loco::DataType::FLOAT32>();
+  if (size == 0)
+  {
+    *min = 0;
+    *max = 0;
+    return;
+  }
+  min_max_of(&node->at<loco::DataType::FLOAT32>(0), size, min, max);
+}
+
+void find_channel_min_max(const CircleConst *node, int32_t channel_dim, std::vector<float> *min,
+                          std::vector<float> *max)
+{
+  uint32_t outer, channels, inner;
+  split_by_channel(node, channel_dim, &outer, &channels, &inner);
+  min->assign(channels, std::numeric_limits<float>::max());
+  max->assign(channels, std::numeric_limits<float>::lowest());
+  if (node->size<loco::DataType::FLOAT32>() == 0)
+    return;
+
+  const float *data = &node->at<loco::DataType::FLOAT32>(0);
+  float *min_data = min->data();
+  float *max_data = max->data();
+  for (uint32_t o = 0; o < outer; ++o)
+  {
+    if (inner == 1)
+    {
+      // Channels are contiguous, ex) DepthwiseConv2D filter
+      const float *channel_data = data + o * channels;
+      for (uint32_t c = 0; c < channels; ++c)
+      {
+        min_data[c] = std::min(min_data[c], channel_data[c]);
+        max_data[c] = std::max(max_data[c], channel_data[c]);
+      }
+    }
+    else
+    {
+      // Each channel is a contiguous slice, ex) Conv2D filter
+      for (uint32_t c = 0; c < channels; ++c)
+      {
+        float slice_min, slice_max;
+        min_max_of(data + (o * channels + c) * inner, inner, &slice_min, &slice_max);
+        min_data[c] = std::min(min_data[c], slice_min);
+        max_data[c] = std::max(max_data[c], slice_max);
+      }
+    }
+  }
+}
+
+void asym_wquant_with_minmax(CircleConst *node, float min, float max, float *scaling_factor,
+                             int64_t *zp)
+{
+  uint32_t size = node->size<loco::DataType::FLOAT32>();
+  std::vector<uint8_t> quantized_values(size, 0);
+  if (min == max)
+  {
+    replace_with_u8(node, quantized_values);
+
+    *scaling_factor = 1;
+    *zp = 0;
+    return;
+  }
+
+  compute_asym_scale_zp(min, max, scaling_factor, zp);
+  const float scaling_factor_inv = 1.0 / *scaling_factor;
+  if (size > 0)
+    quantize_u8(&node->at<loco::DataType::FLOAT32>(0), size, scaling_factor_inv,
+                static_cast<float>(*zp), quantized_values.data());
+
+  replace_with_u8(node, quantized_values);
+}
+
+void sym_wquant_per_channel(CircleConst *node, int32_t channel_dim, const std::vector<float> &min,
+                            const std::vector<float> &max, std::vector<float> *scaling_factor,
+                            std::vector<int64_t> *zp)
+{
+  uint32_t outer, channels, inner;
+  split_by_channel(node, channel_dim, &outer, &channels, &inner);
+  assert(min.size() == channels && max.size() == channels);
+
+  std::vector<float> scaling_factor_inv(channels);
+  scaling_factor->resize(channels);
+  zp->assign(channels, 0);
+  for (uint32_t c = 0; c < channels; ++c)
+  {
+    compute_sym_scale(min[c], max[c], &(*scaling_factor)[c]);
+    scaling_factor_inv[c] = 1.0 / (*scaling_factor)[c];
+  }
+
+  const uint32_t size = node->size<loco::DataType::FLOAT32>();
+  std::vector<int8_t> quantized_values(size);
+  if (size > 0)
+  {
+    const float *data = &node->at<loco::DataType::FLOAT32>(0);
+    int8_t *quantized = quantized_values.data();
+    for (uint32_t o = 0; o < outer; ++o)
+    {
+      if (inner == 1)
+      {
+        const uint32_t offset = o * channels;
+        for (uint32_t c = 0; c < channels; ++c)
+          quantized[offset + c] = quantize_s8(data[offset + c], scaling_factor_inv[c]);
+      }
+      else
+      {
+        for (uint32_t c = 0; c < channels; ++c)
+        {
+          const uint32_t offset = (o * channels + c) * inner;
+          const float inv = scaling_factor_inv[c];
+          for (uint32_t i = 0; i < inner; ++i)
+            quantized[offset + i] = quantize_s8(data[offset + i], inv);
+        }
+      }
+    }
+  }
+
+  replace_with_s8(node, quantized_values);
+}
+
+void check_quantization_dtype(loco::DataType output_dtype, QuantizationGranularity granularity)
+{
+  if (granularity == QuantizationGranularity::LayerWise && output_dtype != loco::DataType::U8)
+    throw std::runtime_error("Layer-wise quantization supports uint8 output only");
+
+  // Kernels of channel-wise quantized weights take symmetric int8 weights and int8 activations
+  if (granularity == QuantizationGranularity::ChannelWise && output_dtype != loco::DataType::S8)
+    throw std::runtime_error("Channel-wise quantization supports int8 output only");
+}
+
+bool is_weights(CircleNode *node)
+{
+  auto circle_const = dynamic_cast<CircleConst *>(node);
+  if (circle_const == nullptr)
+    return false;
+
+  auto succs = loco::succs(node);
+  if (succs.empty())
+    return false;
+
+  for (auto out : succs)
+  {
+    if (weights_channel_dim_of(circle_const, out) < 0)
+      return false;
+  }
+  return true;
+}
+
+int32_t weights_channel_dim(CircleConst *node)
+{
+  auto succs = loco::succs(node);
+  if (succs.empty())
+    return -1;
+
+  int32_t channel_dim = weights_channel_dim_of(node, *succs.begin());
+  for (auto out : succs)
+  {
+    if (weights_channel_dim_of(node, out) != channel_dim)
+      return -1;
+  }
+  return channel_dim;
+}
+
+} // namespace luci
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LUCI_QUANTIZATION_UTILS_H__
+#define __LUCI_QUANTIZATION_UTILS_H__
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/Pass/QuantizationParameters.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace luci
+{
+
+// Compute scale and zero point of uint8 for [min, max], where the zero point is in [0, 255]
+void compute_asym_scale_zp(float min, float max, float *scaling_factor, int64_t *zp);
+
+// Compute scale of int8 for [min, max], which maps [-max(|min|, |max|), max(|min|, |max|)] to
+// [-127, 127] with the zero point 0
+void compute_sym_scale(float min, float max, float *scaling_factor);
+
+// Find min/max of a float32 const
+void find_min_max(const CircleConst *node, float *min, float *max);
+
+// Find min/max of each channel of a float32 const along channel_dim
+void find_channel_min_max(const CircleConst *node, int32_t channel_dim, std::vector<float> *min,
+                          std::vector<float> *max);
+
+// Quantize a float32 const to uint8 with a pair of scale and zero point
+void asym_wquant_with_minmax(CircleConst *node, float min, float max, float *scaling_factor,
+                             int64_t *zp);
+
+// Quantize a float32 const to int8 with a symmetric scale for each channel, whose zero point is 0
+void sym_wquant_per_channel(CircleConst *node, int32_t channel_dim, const std::vector<float> &min,
+                            const std::vector<float> &max, std::vector<float> *scaling_factor,
+                            std::vector<int64_t> *zp);
+
+// Throw if the output dtype is not the one of the granularity, uint8 for LayerWise and int8 for
+// ChannelWise
+void check_quantization_dtype(loco::DataType output_dtype, QuantizationGranularity granularity);
+
+// Check if the node is weights of Conv2D, DepthwiseConv2D or FullyConnected layers, which may be
+// shared by several of them
+bool is_weights(CircleNode *node);
+
+// Return the dimension of output channels of weights of Conv2D, DepthwiseConv2D or
+// FullyConnected, or -1 if the node is not such weights or is shared by layers whose dimensions
+// differ
+int32_t weights_channel_dim(CircleConst *node);
+
+} // namespace luci
+
+#endif // __LUCI_QUANTIZATION_UTILS_H__
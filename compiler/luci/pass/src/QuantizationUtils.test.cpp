@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "QuantizationUtils.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace
+{
+
+luci::CircleConst *create_const(loco::Graph *g, const std::vector<uint32_t> &shape,
+                                const std::vector<float> &values)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(loco::DataType::FLOAT32);
+  node->rank(shape.size());
+  for (uint32_t i = 0; i < shape.size(); ++i)
+    node->dim(i) = shape[i];
+  node->size<loco::DataType::FLOAT32>(values.size());
+  for (uint32_t i = 0; i < values.size(); ++i)
+    node->at<loco::DataType::FLOAT32>(i) = values[i];
+  return node;
+}
+
+} // namespace
+
+TEST(QuantizationUtilsTest, compute_asym_scale_zp)
+{
+  float scale;
+  int64_t zp;
+
+  luci::compute_asym_scale_zp(-1.0f, 1.0f, &scale, &zp);
+  EXPECT_FLOAT_EQ(2.0f / 255.0f, scale);
+  // Over the range of int8
+  EXPECT_EQ(128, zp);
+
+  luci::compute_asym_scale_zp(-255.0f, 0.0f, &scale, &zp);
+  EXPECT_FLOAT_EQ(1.0f, scale);
+  EXPECT_EQ(255, zp);
+
+  // Zero is always representable
+  luci::compute_asym_scale_zp(1.0f, 255.0f, &scale, &zp);
+  EXPECT_FLOAT_EQ(1.0f, scale);
+  EXPECT_EQ(0, zp);
+}
+
+TEST(QuantizationUtilsTest, compute_sym_scale)
+{
+  float scale;
+
+  luci::compute_sym_scale(-2.54f, 1.0f, &scale);
+  EXPECT_FLOAT_EQ(0.02f, scale);
+
+  luci::compute_sym_scale(0.0f, 0.0f, &scale);
+  EXPECT_FLOAT_EQ(1.0f, scale);
+}
+
+TEST(QuantizationUtilsTest, find_channel_min_max)
+{
+  auto g = loco::make_graph();
+  // [2, 1, 1, 3]
+  auto node = create_const(g.get(), {2, 1, 1, 3}, {1, -2, 3, -4, 5, -6});
+
+  float min, max;
+  luci::find_min_max(node, &min, &max);
+  EXPECT_FLOAT_EQ(-6.0f, min);
+  EXPECT_FLOAT_EQ(5.0f, max);
+
+  std::vector<float> min_vec, max_vec;
+  luci::find_channel_min_max(node, 0, &min_vec, &max_vec);
+  EXPECT_EQ(std::vector<float>({-2, -6}), min_vec);
+  EXPECT_EQ(std::vector<float>({3, 5}), max_vec);
+
+  luci::find_channel_min_max(node, 3, &min_vec, &max_vec);
+  EXPECT_EQ(std::vector<float>({-4, -2, -6}), min_vec);
+  EXPECT_EQ(std::vector<float>({1, 5, 3}), max_vec);
+}
+
+TEST(QuantizationUtilsTest, asym_wquant_with_minmax)
+{
+  auto g = loco::make_graph();
+  auto node = create_const(g.get(), {4}, {-1.0f, 0.0f, 0.5f, 1.0f});
+
+  float scale;
+  int64_t zp;
+  luci::asym_wquant_with_minmax(node, -1.0f, 1.0f, &scale, &zp);
+
+  ASSERT_EQ(loco::DataType::U8, node->dtype());
+  ASSERT_EQ(4, node->size<loco::DataType::U8>());
+  // round(zp - 127.5) where zp is 128
+  EXPECT_EQ(1, node->at<loco::DataType::U8>(0));
+  EXPECT_EQ(zp, node->at<loco::DataType::U8>(1));
+  EXPECT_EQ(255, node->at<loco::DataType::U8>(3));
+}
+
+TEST(QuantizationUtilsTest, sym_wquant_per_channel)
+{
+  auto g = loco::make_graph();
+  // Channels along the last dimension, like DepthwiseConv2D filter
+  auto node = create_const(g.get(), {1, 1, 2, 3}, {1.27f, -0.5f, 0.0f, -0.635f, 1.0f, 0.0f});
+
+  std::vector<float> min, max;
+  luci::find_channel_min_max(node, 3, &min, &max);
+  std::vector<float> scale;
+  std::vector<int64_t> zp;
+  luci::sym_wquant_per_channel(node, 3, min, max, &scale, &zp);
+
+  ASSERT_EQ(3, scale.size());
+  EXPECT_FLOAT_EQ(0.01f, scale[0]);
+  EXPECT_FLOAT_EQ(1.0f / 127.0f, scale[1]);
+  // A channel of zeros
+  EXPECT_FLOAT_EQ(1.0f, scale[2]);
+  EXPECT_EQ(std::vector<int64_t>({0, 0, 0}), zp);
+
+  ASSERT_EQ(loco::DataType::S8, node->dtype());
+  ASSERT_EQ(6, node->size<loco::DataType::S8>());
+  EXPECT_EQ(127, node->at<loco::DataType::S8>(0));
+  EXPECT_EQ(-64, node->at<loco::DataType::S8>(1));
+  EXPECT_EQ(0, node->at<loco::DataType::S8>(2));
+  EXPECT_EQ(-64, node->at<loco::DataType::S8>(3));
+  EXPECT_EQ(127, node->at<loco::DataType::S8>(4));
+  EXPECT_EQ(0, node->at<loco::DataType::S8>(5));
+}
+
+TEST(QuantizationUtilsTest, weights_channel_dim)
+{
+  auto g = loco::make_graph();
+  auto conv_filter = create_const(g.get(), {1}, {0});
+  auto dw_filter = create_const(g.get(), {1}, {0});
+  auto fc_weights = create_const(g.get(), {1}, {0});
+  auto bias = create_const(g.get(), {1}, {0});
+
+  auto conv = g->nodes()->create<luci::CircleConv2D>();
+  conv->filter(conv_filter);
+  conv->bias(bias);
+  auto dw_conv = g->nodes()->create<luci::CircleDepthwiseConv2D>();
+  dw_conv->filter(dw_filter);
+  auto fc = g->nodes()->create<luci::CircleFullyConnected>();
+  fc->weights(fc_weights);
+
+  EXPECT_EQ(0, luci::weights_channel_dim(conv_filter));
+  EXPECT_EQ(3, luci::weights_channel_dim(dw_filter));
+  EXPECT_EQ(0, luci::weights_channel_dim(fc_weights));
+  EXPECT_EQ(-1, luci::weights_channel_dim(bias));
+
+  // Shared by layers of the same dimension
+  auto fc_sharing = g->nodes()->create<luci::CircleFullyConnected>();
+  fc_sharing->weights(conv_filter);
+  EXPECT_TRUE(luci::is_weights(conv_filter));
+  EXPECT_EQ(0, luci::weights_channel_dim(conv_filter));
+
+  // Shared by layers of different dimensions
+  auto dw_conv_sharing = g->nodes()->create<luci::CircleDepthwiseConv2D>();
+  dw_conv_sharing->filter(conv_filter);
+  EXPECT_TRUE(luci::is_weights(conv_filter));
+  EXPECT_EQ(-1, luci::weights_channel_dim(conv_filter));
+
+  // Used as other than weights
+  auto conv_sharing = g->nodes()->create<luci::CircleConv2D>();
+  conv_sharing->input(fc_weights);
+  EXPECT_FALSE(luci::is_weights(fc_weights));
+  EXPECT_EQ(-1, luci::weights_channel_dim(fc_weights));
+}
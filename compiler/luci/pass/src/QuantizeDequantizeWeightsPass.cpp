@@ -15,6 +15,7 @@
  */
 
 #include "luci/Pass/QuantizeDequantizeWeightsPass.h"
+#include "QuantizationUtils.h"
 
 #include <luci/IR/CircleNodes.h>
 #include <luci/IR/CircleNodeVisitor.h>
@@ -22,6 +23,7 @@
 
 #include <iostream>
 #include <cmath>
+#include <stdexcept>
 
 namespace luci
 {
@@ -29,130 +31,28 @@ namespace luci
 namespace
 {
 
-void compute_asym_scale_zp(float min, float max, float *scaling_factor, int64_t *zp)
-{
-  assert(min != max);
-  if (min == max)
-  {
-    *scaling_factor = 1;
-    *zp = 0;
-  }
-  const int32_t kMinScale = 0;
-  const int32_t kMaxScale = 255;
-  const double qmin_double = kMinScale;
-  const double qmax_double = kMaxScale;
-  const double rmin = std::fmin(0, min);
-  const double rmax = std::fmax(0, max);
-
-  double scale = (rmax - rmin) / (qmax_double - qmin_double);
-  const double zero_point_from_min = qmin_double - rmin / scale;
-  const double zero_point_from_max = qmax_double - rmax / scale;
-  const double zero_point_from_min_error = std::abs(qmin_double) + std::abs(rmin / scale);
-  const double zero_point_from_max_error = std::abs(qmax_double) + std::abs(rmax / scale);
-  const double zero_point_double = zero_point_from_min_error < zero_point_from_max_error
-                                       ? zero_point_from_min
-                                       : zero_point_from_max;
-  int8_t nudged_zero_point = 0;
-  if (zero_point_double <= qmin_double)
-  {
-    nudged_zero_point = kMinScale;
-  }
-  else if (zero_point_double >= qmax_double)
-  {
-    nudged_zero_point = kMaxScale;
-  }
-  else
-  {
-    nudged_zero_point = static_cast<int8_t>(std::round(zero_point_double));
-  }
-  *scaling_factor = scale;
-  *zp = nudged_zero_point;
-}
-
-void asym_wquant_with_minmax(CircleConst *node, float min, float max, float *scaling_factor,
-                             int64_t *zp)
-{
-
-  const int32_t kMinScale = 0;
-  const int32_t kMaxScale = 255;
-
-  uint32_t size = node->size<loco::DataType::FLOAT32>();
-  if (min == max)
-  {
-    node->dtype(loco::DataType::U8);      // change the type of tensor
-    node->size<loco::DataType::U8>(size); // resize tensor
-    for (int i = 0; i < static_cast<int32_t>(size); ++i)
-      node->at<loco::DataType::U8>(i) = 0;
-
-    *scaling_factor = 1;
-    *zp = 0;
-    return;
-  }
-
-  compute_asym_scale_zp(min, max, scaling_factor, zp);
-  const float scaling_factor_inv = 1.0 / *scaling_factor;
-  std::vector<int32_t> quantized_values(size);
-  for (int i = 0; i < static_cast<int32_t>(size); ++i)
-  {
-    quantized_values[i] = static_cast<int32_t>(
-        std::round(*zp + node->at<loco::DataType::FLOAT32>(i) * scaling_factor_inv));
-  }
-
-  node->dtype(loco::DataType::U8);      // change the type of tensor
-  node->size<loco::DataType::U8>(size); // resize tensor
-  for (int i = 0; i < static_cast<int32_t>(size); ++i)
-  {
-    node->at<loco::DataType::U8>(i) = std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
-  }
-}
-
 bool is_quantized(const CircleNode *node)
 {
   return node->dtype() == loco::DataType::U8 || // activation, weight
+         node->dtype() == loco::DataType::S8 || // activation, weight of channel-wise quantization
          node->dtype() == loco::DataType::S32;  // bias
 }
 
-// Check if node is weights of conv2d, depthwise_conv2d, or fully_connected layer
-bool is_weights(CircleNode *node)
-{
-  auto circle_const = dynamic_cast<CircleConst *>(node);
-  if (circle_const == nullptr)
-    return false;
-
-  auto succs = loco::succs(node);
-  if (succs.size() != 1) // assume weights is used by only one node
-    return false;
-
-  for (auto out : succs)
-  {
-    auto conv = dynamic_cast<CircleConv2D *>(out);
-    if (conv != nullptr && conv->filter() == circle_const)
-      return true;
-
-    auto dw_conv = dynamic_cast<CircleDepthwiseConv2D *>(out);
-    if (dw_conv != nullptr && dw_conv->filter() == circle_const)
-      return true;
-
-    auto fc = dynamic_cast<CircleFullyConnected *>(out);
-    if (fc != nullptr && fc->weights() == circle_const)
-      return true;
-  }
-  return false;
-}
-
 /**
  * @brief QuantizeDequantizeWeights quantizes and dequantizes tensors for weights
  * @details Find min/max values on the fly, quantize the model, and dequantize the model
  */
 struct QuantizeDequantizeWeights final : public luci::CircleNodeMutableVisitor<bool>
 {
-  QuantizeDequantizeWeights(loco::DataType input, loco::DataType output)
-      : input_type(input), output_type(output)
+  QuantizeDequantizeWeights(loco::DataType input, loco::DataType output,
+                            QuantizationGranularity gr)
+      : input_type(input), output_type(output), granularity(gr)
   {
   }
 
   loco::DataType input_type;
   loco::DataType output_type;
+  QuantizationGranularity granularity;
 
   // Quantize and dequantize input tensors of each node
   bool visit(luci::CircleNode *node)
@@ -173,22 +73,39 @@ struct QuantizeDequantizeWeights final : public luci::CircleNodeMutableVisitor<b
       {
         auto circle_const = loco::must_cast<luci::CircleConst *>(circle_node);
 
-        // Find min/max on the fly
-        float min = std::numeric_limits<float>::max();
-        float max = std::numeric_limits<float>::min();
-        for (uint32_t i = 0; i < circle_const->size<loco::DataType::FLOAT32>(); i++)
-        {
-          auto data = circle_const->at<loco::DataType::FLOAT32>(i);
-          min = data < min ? data : min;
-          max = data > max ? data : max;
-        }
-        float scaling_factor;
-        int64_t zp;
-
         // TODO: Implement quantize and dequantize
         // Code needs to be changed
         ////////////////////////////////////////////////////// FROM HERE
 
+        if (granularity == QuantizationGranularity::ChannelWise)
+        {
+          auto channel_dim = weights_channel_dim(circle_const);
+          if (channel_dim < 0)
+            throw std::runtime_error("Channel-wise quantization does not support weights shared "
+                                     "by layers of different output channel dimensions: " +
+                                     circle_const->name());
+
+          // Find min/max of each output channel on the fly
+          std::vector<float> min, max;
+          find_channel_min_max(circle_const, channel_dim, &min, &max);
+          std::vector<float> scaling_factor;
+          std::vector<int64_t> zp;
+          sym_wquant_per_channel(circle_const, channel_dim, min, max, &scaling_factor, &zp);
+          auto quantparam = std::make_unique<CircleQuantParam>();
+          quantparam->min = min;
+          quantparam->max = max;
+          quantparam->scale = scaling_factor;
+          quantparam->zerop = zp;
+          quantparam->quantized_dimension = channel_dim;
+          circle_node->quantparam(std::move(quantparam));
+          continue;
+        }
+
+        // Find min/max on the fly
+        float min, max;
+        find_min_max(circle_const, &min, &max);
+        float scaling_factor;
+        int64_t zp;
         asym_wquant_with_minmax(circle_const, min, max, &scaling_factor, &zp);
         auto quantparam = std::make_unique<CircleQuantParam>();
         quantparam->min.push_back(min);
@@ -211,10 +128,12 @@ bool QuantizeDequantizeWeightsPass::run(loco::Graph *g)
   LOGGER(l);
   INFO(l) << "QuantizeDequantizeWeightsPass Start" << std::endl;
 
+  check_quantization_dtype(_output_dtype, _granularity);
+
   // Quantize weights
   for (auto node : loco::active_nodes(loco::output_nodes(g)))
   {
-    QuantizeDequantizeWeights qw(_input_dtype, _output_dtype);
+    QuantizeDequantizeWeights qw(_input_dtype, _output_dtype, _granularity);
     auto circle_node = loco::must_cast<luci::CircleNode *>(node);
     circle_node->accept(&qw);
   }
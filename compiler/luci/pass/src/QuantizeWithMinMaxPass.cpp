@@ -15,6 +15,7 @@
  */
 
 #include "luci/Pass/QuantizeWithMinMaxPass.h"
+#include "QuantizationUtils.h"
 
 #include <luci/IR/CircleNodes.h>
 #include <luci/IR/CircleNodeVisitor.h>
@@ -24,6 +25,8 @@
 
 #include <iostream>
 #include <cmath>
+#include <limits>
+#include <stdexcept>
 
 namespace luci
 {
@@ -31,46 +34,6 @@ namespace luci
 namespace
 {
 
-void compute_asym_scale_zp(float min, float max, float *scaling_factor, int64_t *zp)
-{
-  assert(min != max);
-  if (min == max)
-  {
-    *scaling_factor = 1;
-    *zp = 0;
-  }
-  const int32_t kMinScale = 0;
-  const int32_t kMaxScale = 255;
-  const double qmin_double = kMinScale;
-  const double qmax_double = kMaxScale;
-  const double rmin = std::fmin(0, min);
-  const double rmax = std::fmax(0, max);
-
-  double scale = (rmax - rmin) / (qmax_double - qmin_double);
-  const double zero_point_from_min = qmin_double - rmin / scale;
-  const double zero_point_from_max = qmax_double - rmax / scale;
-  const double zero_point_from_min_error = std::abs(qmin_double) + std::abs(rmin / scale);
-  const double zero_point_from_max_error = std::abs(qmax_double) + std::abs(rmax / scale);
-  const double zero_point_double = zero_point_from_min_error < zero_point_from_max_error
-                                       ? zero_point_from_min
-                                       : zero_point_from_max;
-  int8_t nudged_zero_point = 0;
-  if (zero_point_double <= qmin_double)
-  {
-    nudged_zero_point = kMinScale;
-  }
-  else if (zero_point_double >= qmax_double)
-  {
-    nudged_zero_point = kMaxScale;
-  }
-  else
-  {
-    nudged_zero_point = static_cast<int8_t>(std::round(zero_point_double));
-  }
-  *scaling_factor = scale;
-  *zp = nudged_zero_point;
-}
-
 // Check if the node is the bias of Conv2D, DepthwiseConv2D, or FullyConnected layer
 // If true, return <input, weight> pair of the successor node (used to quantize bias)
 // If flase, return <nullptr, nullptr>
@@ -136,79 +99,46 @@ void quant_bias(CircleConst *node, float input_scale, float weight_scale, float
   *zp = 0;
 }
 
-bool has_min_max(const CircleNode *node)
+// Quantize bias of channel-wise quantized weights, whose scale is input_scale * weight_scale[c]
+void quant_bias_per_channel(CircleConst *node, float input_scale,
+                            const std::vector<float> &weight_scale,
+                            std::vector<float> *scaling_factor, std::vector<int64_t> *zp)
 {
-  return node->quantparam() && !node->quantparam()->min.empty() && !node->quantparam()->max.empty();
-}
-
-bool is_quantized(const CircleNode *node)
-{
-  return node->dtype() == loco::DataType::U8 || // activation, weight
-         node->dtype() == loco::DataType::S32;  // bias
-}
-
-void asym_wquant_with_minmax(CircleConst *node, float min, float max, float *scaling_factor,
-                             int64_t *zp)
-{
-  const int32_t kMinScale = 0;
-  const int32_t kMaxScale = 255;
-
   uint32_t size = node->size<loco::DataType::FLOAT32>();
-  if (min == max)
-  {
-    node->dtype(loco::DataType::U8);      // change the type of tensor
-    node->size<loco::DataType::U8>(size); // resize tensor
-    for (int i = 0; i < static_cast<int32_t>(size); ++i)
-      node->at<loco::DataType::U8>(i) = 0;
-
-    *scaling_factor = 1;
-    *zp = 0;
-    return;
-  }
+  assert(size == weight_scale.size());
 
-  compute_asym_scale_zp(min, max, scaling_factor, zp);
-  const float scaling_factor_inv = 1.0 / *scaling_factor;
+  scaling_factor->resize(size);
+  zp->assign(size, 0);
   std::vector<int32_t> quantized_values(size);
-  for (int i = 0; i < static_cast<int32_t>(size); ++i)
+  const int32_t kScale = std::numeric_limits<int32_t>::max();
+  for (uint32_t i = 0; i < size; ++i)
   {
-    quantized_values[i] = static_cast<int32_t>(
-        std::round(*zp + node->at<loco::DataType::FLOAT32>(i) * scaling_factor_inv));
+    float scale = input_scale * weight_scale[i];
+    const float scaling_factor_inv = (scale == 0) ? 0 : 1.0 / scale;
+    auto value =
+        static_cast<int32_t>(std::round(node->at<loco::DataType::FLOAT32>(i) * scaling_factor_inv));
+    quantized_values[i] = std::min(kScale, std::max(-kScale, value));
+    (*scaling_factor)[i] = scale;
   }
 
-  node->dtype(loco::DataType::U8);      // change the type of tensor
-  node->size<loco::DataType::U8>(size); // resize tensor
-  for (int i = 0; i < static_cast<int32_t>(size); ++i)
+  node->dtype(loco::DataType::S32);      // change the type of tensor
+  node->size<loco::DataType::S32>(size); // resize tensor
+  for (uint32_t i = 0; i < size; ++i)
   {
-    node->at<loco::DataType::U8>(i) = std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
+    node->at<loco::DataType::S32>(i) = quantized_values[i];
   }
 }
 
-// Check if node is weights of conv2d, depthwise_conv2d, or fully_connected layer
-bool is_weights(CircleNode *node)
+bool has_min_max(const CircleNode *node)
 {
-  auto circle_const = dynamic_cast<CircleConst *>(node);
-  if (circle_const == nullptr)
-    return false;
-
-  auto succs = loco::succs(node);
-  if (succs.size() != 1) // assume weights is used by only one node
-    return false;
-
-  for (auto out : succs)
-  {
-    auto conv = dynamic_cast<CircleConv2D *>(out);
-    if (conv != nullptr && conv->filter() == circle_const)
-      return true;
-
-    auto dw_conv = dynamic_cast<CircleDepthwiseConv2D *>(out);
-    if (dw_conv != nullptr && dw_conv->filter() == circle_const)
-      return true;
+  return node->quantparam() && !node->quantparam()->min.empty() && !node->quantparam()->max.empty();
+}
 
-    auto fc = dynamic_cast<CircleFullyConnected *>(out);
-    if (fc != nullptr && fc->weights() == circle_const)
-      return true;
-  }
-  return false;
+bool is_quantized(const CircleNode *node)
+{
+  return node->dtype() == loco::DataType::U8 || // activation, weight
+         node->dtype() == loco::DataType::S8 || // activation, weight of channel-wise quantization
+         node->dtype() == loco::DataType::S32;  // bias
 }
 
 /**
@@ -217,13 +147,14 @@ bool is_weights(CircleNode *node)
  */
 struct QuantizeActivation final : public luci::CircleNodeMutableVisitor<bool>
 {
-  QuantizeActivation(loco::DataType input, loco::DataType output)
-      : input_type(input), output_type(output)
+  QuantizeActivation(loco::DataType input, loco::DataType output, QuantizationGranularity gr)
+      : input_type(input), output_type(output), granularity(gr)
   {
   }
 
   loco::DataType input_type;
   loco::DataType output_type;
+  QuantizationGranularity granularity;
 
   // Quantize input tensors of each node
   bool visit(luci::CircleNode *node)
@@ -260,8 +191,17 @@ struct QuantizeActivation final : public luci::CircleNodeMutableVisitor<bool>
         int64_t zp;
         compute_asym_scale_zp(min, max, &scaling_factor, &zp);
         circle_node->quantparam()->scale.push_back(scaling_factor);
-        circle_node->quantparam()->zerop.push_back(zp);
-        circle_node->dtype(loco::DataType::U8);
+        if (output_type == loco::DataType::S8)
+        {
+          // int8 zero point is shifted from uint8 with the same scale
+          circle_node->quantparam()->zerop.push_back(zp - 128);
+          circle_node->dtype(loco::DataType::S8);
+        }
+        else
+        {
+          circle_node->quantparam()->zerop.push_back(zp);
+          circle_node->dtype(loco::DataType::U8);
+        }
       }
     }
     return false;
@@ -270,12 +210,14 @@ struct QuantizeActivation final : public luci::CircleNodeMutableVisitor<bool>
 
 struct QuantizeBias final : public luci::CircleNodeMutableVisitor<bool>
 {
-  QuantizeBias(loco::DataType input, loco::DataType output) : input_type(input), output_type(output)
+  QuantizeBias(loco::DataType input, loco::DataType output, QuantizationGranularity gr)
+      : input_type(input), output_type(output), granularity(gr)
   {
   }
 
   loco::DataType input_type;
   loco::DataType output_type;
+  QuantizationGranularity granularity;
 
   // Quantize bias node
   bool visit(luci::CircleNode *node)
@@ -295,13 +237,25 @@ struct QuantizeBias final : public luci::CircleNodeMutableVisitor<bool>
     assert(input->quantparam()->scale.size() == 1); // Only support per-layer quant
     auto input_scale = input->quantparam()->scale[0];
 
-    assert(weight->quantparam()->scale.size() == 1); // Only support per-layer quant
-    auto weight_scale = weight->quantparam()->scale[0];
-
     auto circle_const = loco::must_cast<luci::CircleConst *>(node);
+    const auto &weight_scale = weight->quantparam()->scale;
+    if (granularity == QuantizationGranularity::ChannelWise && weight_scale.size() > 1)
+    {
+      std::vector<float> scaling_factor;
+      std::vector<int64_t> zp;
+      quant_bias_per_channel(circle_const, input_scale, weight_scale, &scaling_factor, &zp);
+      auto quantparam = std::make_unique<CircleQuantParam>();
+      quantparam->scale = scaling_factor;
+      quantparam->zerop = zp;
+      assert(circle_const->quantparam() == nullptr); // bias should not be quantized before
+      circle_const->quantparam(std::move(quantparam));
+      return false;
+    }
+
+    assert(weight_scale.size() == 1);
     float scaling_factor;
     int64_t zp;
-    quant_bias(circle_const, input_scale, weight_scale, &scaling_factor, &zp);
+    quant_bias(circle_const, input_scale, weight_scale[0], &scaling_factor, &zp);
     auto quantparam = std::make_unique<CircleQuantParam>();
     quantparam->scale.push_back(scaling_factor);
     quantparam->zerop.push_back(zp);
@@ -318,13 +272,14 @@ struct QuantizeBias final : public luci::CircleNodeMutableVisitor<bool>
  */
 struct QuantizeWeights final : public luci::CircleNodeMutableVisitor<bool>
 {
-  QuantizeWeights(loco::DataType input, loco::DataType output)
-      : input_type(input), output_type(output)
+  QuantizeWeights(loco::DataType input, loco::DataType output, QuantizationGranularity gr)
+      : input_type(input), output_type(output), granularity(gr)
   {
   }
 
   loco::DataType input_type;
   loco::DataType output_type;
+  QuantizationGranularity granularity;
 
   // Quantize input tensors of each node
   bool visit(luci::CircleNode *node)
@@ -345,15 +300,33 @@ struct QuantizeWeights final : public luci::CircleNodeMutableVisitor<bool>
       {
         auto circle_const = loco::must_cast<luci::CircleConst *>(circle_node);
 
-        // Find min/max on the fly
-        float min = std::numeric_limits<float>::max();
-        float max = std::numeric_limits<float>::min();
-        for (uint32_t i = 0; i < circle_const->size<loco::DataType::FLOAT32>(); i++)
+        if (granularity == QuantizationGranularity::ChannelWise)
         {
-          auto data = circle_const->at<loco::DataType::FLOAT32>(i);
-          min = data < min ? data : min;
-          max = data > max ? data : max;
+          auto channel_dim = weights_channel_dim(circle_const);
+          if (channel_dim < 0)
+            throw std::runtime_error("Channel-wise quantization does not support weights shared "
+                                     "by layers of different output channel dimensions: " +
+                                     circle_const->name());
+
+          // Find min/max of each output channel on the fly
+          std::vector<float> min, max;
+          find_channel_min_max(circle_const, channel_dim, &min, &max);
+          std::vector<float> scaling_factor;
+          std::vector<int64_t> zp;
+          sym_wquant_per_channel(circle_const, channel_dim, min, max, &scaling_factor, &zp);
+          auto quantparam = std::make_unique<CircleQuantParam>();
+          quantparam->min = min;
+          quantparam->max = max;
+          quantparam->scale = scaling_factor;
+          quantparam->zerop = zp;
+          quantparam->quantized_dimension = channel_dim;
+          circle_node->quantparam(std::move(quantparam));
+          continue;
         }
+
+        // Find min/max on the fly
+        float min, max;
+        find_min_max(circle_const, &min, &max);
         float scaling_factor;
         int64_t zp;
         asym_wquant_with_minmax(circle_const, min, max, &scaling_factor, &zp);
@@ -376,10 +349,12 @@ bool QuantizeWithMinMaxPass::run(loco::Graph *g)
   LOGGER(l);
   INFO(l) << "QuantizeWithMinMaxPass Start" << std::endl;
 
+  check_quantization_dtype(_output_dtype, _granularity);
+
   // Quantize activation
   for (auto node : loco::active_nodes(loco::output_nodes(g)))
   {
-    QuantizeActivation qa(_input_dtype, _output_dtype);
+    QuantizeActivation qa(_input_dtype, _output_dtype, _granularity);
     auto circle_node = loco::must_cast<luci::CircleNode *>(node);
     circle_node->accept(&qa);
   }
@@ -387,7 +362,7 @@ bool QuantizeWithMinMaxPass::run(loco::Graph *g)
   // Quantize weights
   for (auto node : loco::active_nodes(loco::output_nodes(g)))
   {
-    QuantizeWeights qw(_input_dtype, _output_dtype);
+    QuantizeWeights qw(_input_dtype, _output_dtype, _granularity);
     auto circle_node = loco::must_cast<luci::CircleNode *>(node);
     circle_node->accept(&qw);
   }
@@ -395,7 +370,7 @@ bool QuantizeWithMinMaxPass::run(loco::Graph *g)
   // Quantize bias
   for (auto node : loco::active_nodes(loco::output_nodes(g)))
   {
-    QuantizeBias qb(_input_dtype, _output_dtype);
+    QuantizeBias qb(_input_dtype, _output_dtype, _granularity);
     auto circle_node = loco::must_cast<luci::CircleNode *>(node);
     circle_node->accept(&qb);
   }
@@ -404,11 +379,11 @@ bool QuantizeWithMinMaxPass::run(loco::Graph *g)
   for (auto node : loco::output_nodes(g))
   {
     auto circle_node = loco::must_cast<luci::CircleOutput *>(node);
-    circle_node->dtype(loco::DataType::U8);
+    circle_node->dtype(_output_dtype);
 
     auto graph_outputs = g->outputs();
     auto graph_output = graph_outputs->at(circle_node->index());
-    graph_output->dtype(loco::DataType::U8);
+    graph_output->dtype(_output_dtype);
   }
 
   INFO(l) << "QuantizeWithMinMaxPass End" << std::endl;
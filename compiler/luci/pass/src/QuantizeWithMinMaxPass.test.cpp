@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/QuantizeWithMinMaxPass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace
+{
+
+void set_min_max(luci::CircleNode *node, float min, float max)
+{
+  auto quantparam = std::make_unique<luci::CircleQuantParam>();
+  quantparam->min.push_back(min);
+  quantparam->max.push_back(max);
+  node->quantparam(std::move(quantparam));
+}
+
+// Bias of 2 channels
+luci::CircleConst *create_bias(loco::Graph *g)
+{
+  auto bias = g->nodes()->create<luci::CircleConst>();
+  bias->dtype(loco::DataType::FLOAT32);
+  bias->rank(1);
+  bias->dim(0) = 2;
+  bias->size<loco::DataType::FLOAT32>(2);
+  bias->at<loco::DataType::FLOAT32>(0) = 0.5f;
+  bias->at<loco::DataType::FLOAT32>(1) = -0.5f;
+  return bias;
+}
+
+/**
+ * @brief Graph of Input - Conv2D - Output with 2 output channels, whose min/max are recorded
+ */
+class QuantizeConv2DGraph
+{
+public:
+  QuantizeConv2DGraph()
+  {
+    g = loco::make_graph();
+
+    input = g->nodes()->create<luci::CircleInput>();
+    filter = g->nodes()->create<luci::CircleConst>();
+    conv = g->nodes()->create<luci::CircleConv2D>();
+    output = g->nodes()->create<luci::CircleOutput>();
+
+    input->dtype(loco::DataType::FLOAT32);
+    set_min_max(input, -1.0f, 1.0f);
+
+    // [2, 1, 1, 2] whose channels have different ranges
+    const std::vector<float> filter_values{1.27f, -0.5f, 0.1f, -0.127f};
+    filter->dtype(loco::DataType::FLOAT32);
+    filter->rank(4);
+    filter->dim(0) = 2;
+    filter->dim(1) = 1;
+    filter->dim(2) = 1;
+    filter->dim(3) = 2;
+    filter->size<loco::DataType::FLOAT32>(filter_values.size());
+    for (uint32_t i = 0; i < filter_values.size(); ++i)
+      filter->at<loco::DataType::FLOAT32>(i) = filter_values[i];
+
+    bias = create_bias(g.get());
+
+    conv->input(input);
+    conv->filter(filter);
+    conv->bias(bias);
+    conv->dtype(loco::DataType::FLOAT32);
+    set_min_max(conv, -2.0f, 2.0f);
+
+    output->from(conv);
+    output->dtype(loco::DataType::FLOAT32);
+    auto graph_output = g->outputs()->create();
+    output->index(graph_output->index());
+  }
+
+public:
+  std::unique_ptr<loco::Graph> g;
+  luci::CircleInput *input = nullptr;
+  luci::CircleConst *filter = nullptr;
+  luci::CircleConst *bias = nullptr;
+  luci::CircleConv2D *conv = nullptr;
+  luci::CircleOutput *output = nullptr;
+};
+
+} // namespace
+
+TEST(QuantizeWithMinMaxPassTest, channel_wise_conv2d)
+{
+  QuantizeConv2DGraph graph;
+
+  luci::QuantizeWithMinMaxPass pass(loco::DataType::FLOAT32, loco::DataType::S8,
+                                    luci::QuantizationGranularity::ChannelWise);
+  pass.run(graph.g.get());
+
+  // Symmetric int8 weights for each output channel
+  ASSERT_EQ(loco::DataType::S8, graph.filter->dtype());
+  auto filter_qparam = graph.filter->quantparam();
+  ASSERT_NE(nullptr, filter_qparam);
+  ASSERT_EQ(2, filter_qparam->scale.size());
+  EXPECT_FLOAT_EQ(0.01f, filter_qparam->scale[0]);
+  EXPECT_FLOAT_EQ(0.001f, filter_qparam->scale[1]);
+  EXPECT_EQ(std::vector<int64_t>({0, 0}), filter_qparam->zerop);
+  EXPECT_EQ(0, filter_qparam->quantized_dimension);
+  EXPECT_EQ(127, graph.filter->at<loco::DataType::S8>(0));
+  EXPECT_EQ(-50, graph.filter->at<loco::DataType::S8>(1));
+  EXPECT_EQ(100, graph.filter->at<loco::DataType::S8>(2));
+  EXPECT_EQ(-127, graph.filter->at<loco::DataType::S8>(3));
+
+  // int8 activations
+  ASSERT_EQ(loco::DataType::S8, graph.input->dtype());
+  ASSERT_EQ(loco::DataType::S8, graph.conv->dtype());
+  ASSERT_EQ(loco::DataType::S8, graph.output->dtype());
+  const auto input_scale = graph.input->quantparam()->scale[0];
+  const auto input_zp = graph.input->quantparam()->zerop[0];
+  EXPECT_GE(input_zp, -128);
+  EXPECT_LE(input_zp, 127);
+
+  // int32 bias whose scale is input_scale * weight_scale[c]
+  ASSERT_EQ(loco::DataType::S32, graph.bias->dtype());
+  auto bias_qparam = graph.bias->quantparam();
+  ASSERT_NE(nullptr, bias_qparam);
+  ASSERT_EQ(2, bias_qparam->scale.size());
+  for (uint32_t c = 0; c < 2; ++c)
+  {
+    const float bias_scale = input_scale * filter_qparam->scale[c];
+    EXPECT_FLOAT_EQ(bias_scale, bias_qparam->scale[c]);
+    EXPECT_EQ(0, bias_qparam->zerop[c]);
+    const float bias_value = c == 0 ? 0.5f : -0.5f;
+    EXPECT_EQ(static_cast<int32_t>(std::round(bias_value / bias_scale)),
+              graph.bias->at<loco::DataType::S32>(c));
+  }
+}
+
+TEST(QuantizeWithMinMaxPassTest, layer_wise_conv2d)
+{
+  QuantizeConv2DGraph graph;
+
+  luci::QuantizeWithMinMaxPass pass(loco::DataType::FLOAT32, loco::DataType::U8,
+                                    luci::QuantizationGranularity::LayerWise);
+  pass.run(graph.g.get());
+
+  ASSERT_EQ(loco::DataType::U8, graph.filter->dtype());
+  ASSERT_EQ(1, graph.filter->quantparam()->scale.size());
+  ASSERT_EQ(loco::DataType::U8, graph.input->dtype());
+  ASSERT_EQ(loco::DataType::U8, graph.output->dtype());
+  // Zero point of [-1, 1] is over the range of int8
+  EXPECT_EQ(128, graph.input->quantparam()->zerop[0]);
+  ASSERT_EQ(loco::DataType::S32, graph.bias->dtype());
+  ASSERT_EQ(1, graph.bias->quantparam()->scale.size());
+}
+
+TEST(QuantizeWithMinMaxPassTest, channel_wise_shared_weights)
+{
+  QuantizeConv2DGraph graph;
+
+  // Second Conv2D sharing the filter
+  auto conv = graph.g->nodes()->create<luci::CircleConv2D>();
+  conv->input(graph.conv);
+  conv->filter(graph.filter);
+  conv->bias(create_bias(graph.g.get()));
+  conv->dtype(loco::DataType::FLOAT32);
+  set_min_max(conv, -2.0f, 2.0f);
+  graph.output->from(conv);
+
+  luci::QuantizeWithMinMaxPass pass(loco::DataType::FLOAT32, loco::DataType::S8,
+                                    luci::QuantizationGranularity::ChannelWise);
+  pass.run(graph.g.get());
+
+  ASSERT_EQ(loco::DataType::S8, graph.filter->dtype());
+  ASSERT_EQ(2, graph.filter->quantparam()->scale.size());
+  EXPECT_EQ(0, graph.filter->quantparam()->quantized_dimension);
+}
+
+TEST(QuantizeWithMinMaxPassTest, channel_wise_shared_weights_of_different_dims_NEG)
+{
+  QuantizeConv2DGraph graph;
+
+  // DepthwiseConv2D sharing the filter, whose output channels are in dimension 3
+  auto dw_conv = graph.g->nodes()->create<luci::CircleDepthwiseConv2D>();
+  dw_conv->input(graph.conv);
+  dw_conv->filter(graph.filter);
+  dw_conv->bias(create_bias(graph.g.get()));
+  dw_conv->dtype(loco::DataType::FLOAT32);
+  set_min_max(dw_conv, -2.0f, 2.0f);
+  graph.output->from(dw_conv);
+
+  luci::QuantizeWithMinMaxPass pass(loco::DataType::FLOAT32, loco::DataType::S8,
+                                    luci::QuantizationGranularity::ChannelWise);
+  EXPECT_ANY_THROW(pass.run(graph.g.get()));
+}
+
+TEST(QuantizeWithMinMaxPassTest, channel_wise_uint8_NEG)
+{
+  QuantizeConv2DGraph graph;
+
+  luci::QuantizeWithMinMaxPass pass(loco::DataType::FLOAT32, loco::DataType::U8,
+                                    luci::QuantizationGranularity::ChannelWise);
+  EXPECT_ANY_THROW(pass.run(graph.g.get()));
+}
+
+TEST(QuantizeWithMinMaxPassTest, layer_wise_int8_NEG)
+{
+  QuantizeConv2DGraph graph;
+
+  luci::QuantizeWithMinMaxPass pass(loco::DataType::FLOAT32, loco::DataType::S8,
+                                    luci::QuantizationGranularity::LayerWise);
+  EXPECT_ANY_THROW(pass.run(graph.g.get()));
+}
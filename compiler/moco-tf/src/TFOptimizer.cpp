@@ -71,8 +71,8 @@ void TFOptimizer::optimize(loco::Graph *g) const
   phase.emplace_back(stdex::make_unique<moco::tf::TypeInferencePass>());
   /* TRANSFORM DECLARATION END */
 
-  ProgressReporter prog(g, logo::PhaseStrategy::Saturate);
-  logo::PhaseRunner<logo::PhaseStrategy::Saturate> phase_runner{g};
+  ProgressReporter prog(g, logo::PhaseStrategy::Worklist);
+  logo::PhaseRunner<logo::PhaseStrategy::Worklist> phase_runner{g};
   phase_runner.attach(&prog);
   phase_runner.run(phase);
 }
@@ -25,8 +25,10 @@ int entry(const int argc, char **argv)
   auto input_model_path = args.getInputModelFilePath();
   auto input_data_path = args.getInputDataFilePath();
   auto output_model_path = args.getOutputModelFilePath();
+  auto num_threads = args.getNumThreads();
+  auto minmax_options = args.getMinMaxOptions();
 
-  RecordMinMax rmm;
+  RecordMinMax rmm(num_threads, minmax_options);
 
   // Initialize interpreter and observer
   rmm.initialize(input_model_path);
@@ -17,6 +17,9 @@
 #ifndef __RECORD_MINMAX_ARGS_H__
 #define __RECORD_MINMAX_ARGS_H__
 
+#include "MinMaxComputer.h"
+
+#include <cstdint>
 #include <string>
 #include <boost/program_options.hpp>
 
@@ -34,6 +37,8 @@ public:
   const std::string &getInputModelFilePath(void) const { return _input_model_filepath; }
   const std::string &getInputDataFilePath(void) const { return _input_data_filepath; }
   const std::string &getOutputModelFilePath(void) const { return _output_model_filepath; }
+  uint32_t getNumThreads(void) const { return _num_threads; }
+  const MinMaxOptions &getMinMaxOptions(void) const { return _minmax_options; }
 
 private:
   void Initialize();
@@ -46,6 +51,8 @@ private:
   std::string _input_model_filepath;
   std::string _input_data_filepath;
   std::string _output_model_filepath;
+  uint32_t _num_threads = 1;
+  MinMaxOptions _minmax_options;
 };
 
 } // namespace record_minmax
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RECORD_MINMAX_HISTOGRAM_H__
+#define __RECORD_MINMAX_HISTOGRAM_H__
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace record_minmax
+{
+
+// Histogram of the values of a tensor over all records
+//
+// The bins have the same width, which is a power of 2, and start at multiples of the width. The
+// width is the smallest one whose bins cover the range of the values added so far. When the range
+// grows, pairs of adjacent bins are merged exactly, so the histogram keeps a fixed size however
+// many values are added. As the bins depend only on the range, histograms of parts of the values
+// merge into the same histogram in any order.
+class Histogram
+{
+public:
+  explicit Histogram(uint32_t num_bins = 2048) : _counts(num_bins, 0)
+  {
+    // Do nothing
+  }
+
+public:
+  /**
+   * @brief Add values whose min/max are already known
+   * @details min and max have to be finite. Values which are not finite are not counted.
+   */
+  void add(const float *data, int32_t size, float min, float max);
+
+  /**
+   * @brief Add the values of another histogram
+   */
+  void merge(const Histogram &other);
+
+  /**
+   * @brief Value below which the given percent of the added values are
+   */
+  float percentile(float percent) const;
+
+  uint64_t count() const { return _total; }
+
+private:
+  void expand(float min, float max);
+  int32_t fitExponent(float min, float max) const;
+
+private:
+  std::vector<uint64_t> _counts;
+  // Range of the values added so far, which is empty at first
+  float _min = std::numeric_limits<float>::infinity();
+  float _max = -std::numeric_limits<float>::infinity();
+  // Bin i holds the values in [(_first + i) * 2^_exponent, (_first + i + 1) * 2^_exponent)
+  int32_t _exponent = 0;
+  int64_t _first = 0;
+  uint64_t _total = 0;
+};
+
+} // namespace record_minmax
+
+#endif // __RECORD_MINMAX_HISTOGRAM_H__
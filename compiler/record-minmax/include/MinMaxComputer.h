@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RECORD_MINMAX_MINMAX_COMPUTER_H__
+#define __RECORD_MINMAX_MINMAX_COMPUTER_H__
+
+#include "MinMaxObserver.h"
+
+#include <string>
+#include <vector>
+
+namespace record_minmax
+{
+
+// How to determine the final min/max of an activation from the ones recorded
+enum class MinMaxMode
+{
+  // Percentiles of the min/max of records, which clip outlier records
+  Percentile,
+  // Exponential moving averages of the min/max of records, in order of record
+  MovingAverage,
+  // Percentiles of all the values of all records, which clip outlier values
+  // This falls back to Percentile for a tensor without finite values.
+  HistogramPercentile,
+};
+
+MinMaxMode toMinMaxMode(const std::string &name);
+
+struct MinMaxOptions
+{
+  MinMaxMode mode = MinMaxMode::Percentile;
+  // Percentiles of Percentile and HistogramPercentile modes, in [0, 100]
+  float min_percentile = 1.0f;
+  float max_percentile = 99.0f;
+  // Weight of the average so far in MovingAverage mode, in [0, 1)
+  float moving_average_decay = 0.9f;
+};
+
+/**
+ * @brief Value below which the given percent of values are, interpolated between the nearest ones
+ */
+float getNthPercentile(std::vector<float> values, float percent);
+
+/**
+ * @brief Exponential moving average of values in order, starting from the first value
+ */
+float getMovingAverage(const std::vector<float> &values, float decay);
+
+/**
+ * @brief Determine the final min/max of the tensor of node
+ * @details This throws an exception if the data required by the mode is not recorded
+ */
+void computeMinMax(const MinMaxOptions &options, const MinMaxMap &minmax_map,
+                   const luci::CircleNode *node, float *min, float *max);
+
+} // namespace record_minmax
+
+#endif // __RECORD_MINMAX_MINMAX_COMPUTER_H__
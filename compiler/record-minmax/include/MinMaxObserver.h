@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RECORD_MINMAX_MINMAX_OBSERVER_H__
+#define __RECORD_MINMAX_MINMAX_OBSERVER_H__
+
+#include "Histogram.h"
+
+#include <luci_interpreter/Interpreter.h>
+#include <luci_interpreter/core/Tensor.h>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace record_minmax
+{
+
+// Min/max of a tensor for each record, in ascending order of record
+struct MinMaxVectors
+{
+  std::vector<int32_t> record_vector;
+  std::vector<float> min_vector;
+  std::vector<float> max_vector;
+};
+
+class MinMaxMap
+{
+public:
+  /**
+   * @brief Record min/max of the tensor of node for a record
+   * @details Min/max of a node have to be recorded in ascending order of record
+   */
+  void recordMinMax(const luci::CircleNode *node, int32_t record_idx, float min, float max);
+
+  /**
+   * @brief Add the values of the tensor of node to its histogram
+   */
+  void recordHistogram(const luci::CircleNode *node, const float *data, int32_t size, float min,
+                       float max);
+
+  /**
+   * @brief Merge min/max and histograms recorded in another map, keeping ascending order of record
+   */
+  void merge(const MinMaxMap &other);
+
+  const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *getMap() const
+  {
+    return &_minmax_map;
+  }
+
+  const std::unordered_map<const luci::CircleNode *, Histogram> *getHistogramMap() const
+  {
+    return &_histogram_map;
+  }
+
+private:
+  std::unordered_map<const luci::CircleNode *, MinMaxVectors> _minmax_map;
+  std::unordered_map<const luci::CircleNode *, Histogram> _histogram_map;
+};
+
+// MinMaxObserver records min/max of the float activation tensors written by an interpreter, and
+// optionally their histograms. The tensors are read in place as soon as they are written.
+class MinMaxObserver : public luci_interpreter::ExecutionObserver
+{
+public:
+  explicit MinMaxObserver(bool record_histogram = false) : _record_histogram(record_histogram)
+  {
+    // Do nothing
+  }
+
+  /**
+   * @brief Set the record which the interpreter runs next
+   */
+  void setRecord(int32_t record_idx) { _record_idx = record_idx; }
+
+  void postTensorWrite(const luci::CircleNode *node,
+                       const luci_interpreter::Tensor *tensor) override;
+
+  const MinMaxMap *minMaxData() const { return &_minmax_data; }
+
+private:
+  bool _record_histogram;
+  int32_t _record_idx = 0;
+  MinMaxMap _minmax_data;
+};
+
+} // namespace record_minmax
+
+#endif // __RECORD_MINMAX_MINMAX_OBSERVER_H__
@@ -20,7 +20,11 @@
 #include <luci/IR/Module.h>
 #include <luci_interpreter/Interpreter.h>
 
+#include "MinMaxComputer.h"
+#include "MinMaxObserver.h"
+
 #include <memory>
+#include <vector>
 
 namespace record_minmax
 {
@@ -28,7 +32,15 @@ namespace record_minmax
 class RecordMinMax
 {
 public:
-  explicit RecordMinMax() = default;
+  /**
+   * @brief Records of input data are run by num_threads interpreters in parallel, and min/max of
+   *        activations are determined from the records as options tell
+   */
+  RecordMinMax(uint32_t num_threads, const MinMaxOptions &options)
+      : _num_threads(num_threads), _options(options)
+  {
+    // Do nothing
+  }
 
   ~RecordMinMax() = default;
 
@@ -39,8 +51,14 @@ public:
   void saveModel(const std::string &output_model_path);
 
 private:
+  uint32_t _num_threads;
+  MinMaxOptions _options;
   std::unique_ptr<luci::Module> _module;
-  std::unique_ptr<luci_interpreter::Interpreter> _interpreter;
+  // One interpreter more than threads, so that the next record is read while all threads run
+  std::vector<std::unique_ptr<luci_interpreter::Interpreter>> _interpreters;
+  std::vector<std::unique_ptr<MinMaxObserver>> _observers;
+  // Min/max merged from all the observers
+  MinMaxMap _minmax_data;
 };
 
 } // namespace record_minmax
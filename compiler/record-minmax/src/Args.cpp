@@ -16,7 +16,10 @@
 
 #include "Args.h"
 
+#include <algorithm>
 #include <iostream>
+#include <stdexcept>
+#include <thread>
 
 namespace record_minmax
 {
@@ -34,7 +37,19 @@ void Args::Initialize(void)
   desc.add_options()("help,h", "Print available options")(
       "input_model,i", po::value<std::string>()->default_value(""), "Input model filepath")(
       "input_data,d", po::value<std::string>()->default_value(""), "Input data filepath")(
-      "output_model,o", po::value<std::string>()->default_value(""), "Output model filepath");
+      "output_model,o", po::value<std::string>()->default_value(""), "Output model filepath")(
+      "num_threads,t",
+      po::value<uint32_t>()->default_value(std::max(1u, std::thread::hardware_concurrency())),
+      "Number of threads which run records in parallel")(
+      "mode", po::value<std::string>()->default_value("percentile"),
+      "How to determine min/max of an activation from the records: percentile, moving_average or "
+      "histogram_percentile")(
+      "min_percentile", po::value<float>()->default_value(1.0f),
+      "Percentile for min in percentile and histogram_percentile modes")(
+      "max_percentile", po::value<float>()->default_value(99.0f),
+      "Percentile for max in percentile and histogram_percentile modes")(
+      "moving_average_decay", po::value<float>()->default_value(0.9f),
+      "Weight of the average so far in moving_average mode");
 
   _positional.add("input_model", 1).add("input_data", 1).add("output_model", 1);
   _options.add(desc);
@@ -105,6 +120,46 @@ void Args::Parse(const int argc, char **argv)
       exit(EXIT_FAILURE);
     }
   }
+
+  if (vm.count("num_threads"))
+  {
+    _num_threads = vm["num_threads"].as<uint32_t>();
+
+    if (_num_threads == 0)
+    {
+      std::cerr << "Number of threads should be positive. Run with `--help` for usage."
+                << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+
+  try
+  {
+    _minmax_options.mode = toMinMaxMode(vm["mode"].as<std::string>());
+  }
+  catch (const std::runtime_error &e)
+  {
+    std::cerr << e.what() << ". Run with `--help` for usage." << std::endl;
+    exit(EXIT_FAILURE);
+  }
+
+  _minmax_options.min_percentile = vm["min_percentile"].as<float>();
+  _minmax_options.max_percentile = vm["max_percentile"].as<float>();
+  if (!(0.0f <= _minmax_options.min_percentile &&
+        _minmax_options.min_percentile <= _minmax_options.max_percentile &&
+        _minmax_options.max_percentile <= 100.0f))
+  {
+    std::cerr << "Percentiles should be 0 <= min_percentile <= max_percentile <= 100." << std::endl;
+    exit(EXIT_FAILURE);
+  }
+
+  _minmax_options.moving_average_decay = vm["moving_average_decay"].as<float>();
+  if (!(0.0f <= _minmax_options.moving_average_decay &&
+        _minmax_options.moving_average_decay < 1.0f))
+  {
+    std::cerr << "Decay of moving average should be in [0, 1)." << std::endl;
+    exit(EXIT_FAILURE);
+  }
 }
 
 } // namespace record_minmax
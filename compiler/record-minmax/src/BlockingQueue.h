@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RECORD_MINMAX_BLOCKING_QUEUE_H__
+#define __RECORD_MINMAX_BLOCKING_QUEUE_H__
+
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+
+namespace record_minmax
+{
+
+// BlockingQueue is a FIFO queue shared by threads, where pop waits until an element is pushed
+template <typename T> class BlockingQueue
+{
+public:
+  void push(T value)
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _queue.push(std::move(value));
+    }
+    _cond.notify_one();
+  }
+
+  T pop()
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _cond.wait(lock, [this] { return !_queue.empty(); });
+    T value = std::move(_queue.front());
+    _queue.pop();
+    return value;
+  }
+
+private:
+  std::mutex _mutex;
+  std::condition_variable _cond;
+  std::queue<T> _queue;
+};
+
+} // namespace record_minmax
+
+#endif // __RECORD_MINMAX_BLOCKING_QUEUE_H__
@@ -20,6 +20,7 @@
 
 #include <string>
 #include <cassert>
+#include <stdexcept>
 
 using Shape = luci_interpreter::Shape;
 using DataType = luci_interpreter::DataType;
@@ -75,6 +76,24 @@ void readTensorData(H5::DataSet &tensor, int64_t *buffer)
   tensor.read(buffer, H5::PredType::NATIVE_LONG);
 }
 
+void readTensorData(H5::DataSet &tensor, DataType dtype, void *buffer)
+{
+  switch (dtype)
+  {
+    case DataType::FLOAT32:
+      readTensorData(tensor, static_cast<float *>(buffer));
+      break;
+    case DataType::S32:
+      readTensorData(tensor, static_cast<int32_t *>(buffer));
+      break;
+    case DataType::S64:
+      readTensorData(tensor, static_cast<int64_t *>(buffer));
+      break;
+    default:
+      throw std::runtime_error{"Unsupported data type for input data (.h5)"};
+  }
+}
+
 } // namespace
 
 namespace record_minmax
@@ -98,20 +117,27 @@ void HDF5Importer::readTensor(int32_t record_idx, int32_t input_idx, DataType *d
   auto tensor_shape = tensor.getSpace();
   *shape = toInternalShape(tensor_shape);
 
-  switch (*dtype)
-  {
-    case DataType::FLOAT32:
-      readTensorData(tensor, static_cast<float *>(buffer));
-      break;
-    case DataType::S32:
-      readTensorData(tensor, static_cast<int32_t *>(buffer));
-      break;
-    case DataType::S64:
-      readTensorData(tensor, static_cast<int64_t *>(buffer));
-      break;
-    default:
-      throw std::runtime_error{"Unsupported data type for input data (.h5)"};
-  }
+  readTensorData(tensor, *dtype, buffer);
+}
+
+void HDF5Importer::readTensor(int32_t record_idx, int32_t input_idx, DataType dtype,
+                              const Shape &shape, void *buffer)
+{
+  auto record = _value_grp.openGroup(std::to_string(record_idx));
+  auto tensor = record.openDataSet(std::to_string(input_idx));
+
+  // Type check
+  if (toInternalDtype(tensor.getDataType()) != dtype)
+    throw std::runtime_error("Wrong input type.");
+
+  // Shape check
+  const Shape tensor_shape = toInternalShape(tensor.getSpace());
+  if (tensor_shape.num_dims() != shape.num_dims())
+    throw std::runtime_error("Input rank mismatch.");
+  if (tensor_shape != shape)
+    throw std::runtime_error("Input shape mismatch.");
+
+  readTensorData(tensor, dtype, buffer);
 }
 
 } // namespace record_minmax
@@ -63,6 +63,20 @@ public:
   void readTensor(int32_t record_idx, int32_t input_idx, DataType *dtype, Shape *shape,
                   void *buffer);
 
+  /**
+   * @brief Read tensor data from file and store it into buffer, after checking that the tensor
+   *        has the expected data type and shape
+   * @details This throws an exception if the data type or the shape does not match, so buffer
+   *          can be the memory of an input tensor of the model
+   * @param record_idx : index of the record
+   * @param input_idx : index of the input
+   * @param dtype : expected data type of the tensor
+   * @param shape : expected shape of the tensor
+   * @param buffer : pointer to write the tensor's data
+   */
+  void readTensor(int32_t record_idx, int32_t input_idx, DataType dtype, const Shape &shape,
+                  void *buffer);
+
   int32_t numRecords() { return _value_grp.getNumObjs(); }
 
   int32_t numInputs(int32_t record_idx);
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Histogram.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace
+{
+
+// Bits of a bin index, which keep every bin index and every value over the width exact in double
+constexpr int32_t kIndexBits = 40;
+// Exponent of the width of bins of zeros, which is below that of any other bins
+constexpr int32_t kMinExponent =
+    std::numeric_limits<float>::min_exponent - std::numeric_limits<float>::digits - kIndexBits;
+
+// Index of the bin of width 2^exponent which holds value
+int64_t binOf(double value, int32_t exponent)
+{
+  return static_cast<int64_t>(std::floor(std::ldexp(value, -exponent)));
+}
+
+// Index of the bin 2^shift times wider which holds the bin of index
+int64_t widerBin(int64_t index, int32_t shift)
+{
+  assert(shift >= 0);
+  if (shift > kIndexBits + 1)
+    return index < 0 ? -1 : 0;
+  const int64_t scale = int64_t{1} << shift;
+  // Round toward negative infinity
+  return index >= 0 ? index / scale : -((-index + scale - 1) / scale);
+}
+
+} // namespace
+
+namespace record_minmax
+{
+
+void Histogram::add(const float *data, int32_t size, float min, float max)
+{
+  if (size == 0)
+    return;
+
+  expand(min, max);
+  const double scale = std::ldexp(1.0, -_exponent);
+  const int64_t last = _counts.size() - 1;
+  for (int32_t i = 0; i < size; ++i)
+  {
+    // NaN has no bin, and infinity is out of any range
+    if (!std::isfinite(data[i]))
+      continue;
+    // Clamp the values out of [min, max], which the caller should not pass
+    const int64_t index = static_cast<int64_t>(std::floor(data[i] * scale)) - _first;
+    _counts[std::min(std::max(index, int64_t{0}), last)]++;
+    _total++;
+  }
+}
+
+void Histogram::merge(const Histogram &other)
+{
+  if (other._min > other._max)
+    return;
+
+  expand(other._min, other._max);
+  // The range of this covers that of other, so the bins of this are as wide as or wider than those
+  assert(_exponent >= other._exponent);
+  for (uint32_t i = 0; i < other._counts.size(); ++i)
+  {
+    if (other._counts[i] == 0)
+      continue;
+    const int64_t index = widerBin(other._first + i, _exponent - other._exponent) - _first;
+    assert(index >= 0 && index < static_cast<int64_t>(_counts.size()));
+    _counts[index] += other._counts[i];
+  }
+  _total += other._total;
+}
+
+float Histogram::percentile(float percent) const
+{
+  if (_total == 0)
+    throw std::runtime_error("Percentile of an empty histogram.");
+
+  const double target = std::min(std::max(percent, 0.0f), 100.0f) / 100.0 * _total;
+  uint64_t cumulative = 0;
+  for (uint32_t i = 0; i < _counts.size(); ++i)
+  {
+    if (_counts[i] > 0 && cumulative + _counts[i] >= target)
+    {
+      // Values are assumed to be uniform in a bin, which may reach out of the range
+      const double fraction = (target - cumulative) / _counts[i];
+      const float value = static_cast<float>(std::ldexp(_first + i + fraction, _exponent));
+      return std::min(std::max(value, _min), _max);
+    }
+    cumulative += _counts[i];
+  }
+  return _max;
+}
+
+void Histogram::expand(float min, float max)
+{
+  assert(std::isfinite(min) && std::isfinite(max) && min <= max);
+  const float new_min = std::min(_min, min);
+  const float new_max = std::max(_max, max);
+  if (new_min == _min && new_max == _max)
+    return;
+
+  const int32_t exponent = fitExponent(new_min, new_max);
+  const int64_t first = binOf(new_min, exponent);
+  if (_total > 0)
+  {
+    // Bins only get wider as the range grows, and each old bin falls in a new bin as a whole
+    assert(exponent >= _exponent);
+    std::vector<uint64_t> counts(_counts.size(), 0);
+    for (uint32_t i = 0; i < _counts.size(); ++i)
+    {
+      if (_counts[i] == 0)
+        continue;
+      const int64_t index = widerBin(_first + i, exponent - _exponent) - first;
+      assert(index >= 0 && index < static_cast<int64_t>(counts.size()));
+      counts[index] += _counts[i];
+    }
+    _counts.swap(counts);
+  }
+
+  _min = new_min;
+  _max = new_max;
+  _exponent = exponent;
+  _first = first;
+}
+
+int32_t Histogram::fitExponent(float min, float max) const
+{
+  const double num_bins = _counts.size();
+
+  // Narrower bins would have indices out of kIndexBits
+  const float magnitude = std::max(std::abs(min), std::abs(max));
+  int32_t exponent = magnitude > 0.0f ? std::ilogb(magnitude) - kIndexBits : kMinExponent;
+  // Bins narrower than (max - min) / num_bins cannot cover the range, so start from there
+  const double range = static_cast<double>(max) - min;
+  if (range > 0.0)
+    exponent = std::max(exponent, std::ilogb(range / num_bins));
+
+  while (binOf(max, exponent) - binOf(min, exponent) >= num_bins)
+    ++exponent;
+  return exponent;
+}
+
+} // namespace record_minmax
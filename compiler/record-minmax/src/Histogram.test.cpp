@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Histogram.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace record_minmax;
+
+namespace
+{
+
+// Values of i / size for i in [0, size)
+std::vector<float> uniform_values(int32_t size)
+{
+  std::vector<float> values(size);
+  for (int32_t i = 0; i < size; ++i)
+    values[i] = static_cast<float>(i) / size;
+  return values;
+}
+
+} // namespace
+
+TEST(HistogramTest, percentile_of_uniform_values)
+{
+  const auto values = uniform_values(10000);
+
+  Histogram histogram;
+  histogram.add(values.data(), values.size(), values.front(), values.back());
+
+  ASSERT_EQ(10000, histogram.count());
+  EXPECT_NEAR(0.01f, histogram.percentile(1.0f), 1e-3f);
+  EXPECT_NEAR(0.5f, histogram.percentile(50.0f), 1e-3f);
+  EXPECT_NEAR(0.99f, histogram.percentile(99.0f), 1e-3f);
+}
+
+TEST(HistogramTest, expand_range_upward_and_downward)
+{
+  Histogram histogram(4);
+
+  const std::vector<float> values{0.0f, 1.0f, 2.0f, 3.0f};
+  histogram.add(values.data(), values.size(), 0.0f, 3.0f);
+
+  const float upper_value = 7.0f;
+  histogram.add(&upper_value, 1, upper_value, upper_value);
+
+  const float lower_value = -5.0f;
+  histogram.add(&lower_value, 1, lower_value, lower_value);
+
+  ASSERT_EQ(6, histogram.count());
+  // Values out of the first range are still covered
+  ASSERT_LE(histogram.percentile(0.0f), lower_value);
+  ASSERT_GE(histogram.percentile(100.0f), upper_value);
+  // Four of six values are in [0, 3], which falls in a bin of the expanded range
+  ASSERT_GE(histogram.percentile(50.0f), -5.0f);
+  ASSERT_LE(histogram.percentile(50.0f), 7.0f);
+}
+
+TEST(HistogramTest, merge)
+{
+  const auto values = uniform_values(10000);
+  const size_t half = values.size() / 2;
+
+  Histogram lhs;
+  lhs.add(values.data(), half, values.front(), values[half - 1]);
+  Histogram rhs;
+  rhs.add(values.data() + half, values.size() - half, values[half], values.back());
+
+  lhs.merge(rhs);
+
+  ASSERT_EQ(10000, lhs.count());
+  EXPECT_NEAR(0.01f, lhs.percentile(1.0f), 1e-3f);
+  EXPECT_NEAR(0.99f, lhs.percentile(99.0f), 1e-3f);
+}
+
+TEST(HistogramTest, merge_in_any_order)
+{
+  // Parts of values with different ranges, as recorded by different interpreters
+  const std::vector<std::vector<float>> parts{
+      {0.1f, 0.2f, 0.3f}, {-4.5f, 2.0f}, {1000.0f, 7.25f, -0.5f}, {0.0f}, {-0.001f, 0.001f}};
+
+  auto add_part = [](Histogram &histogram, const std::vector<float> &part) {
+    const auto minmax = std::minmax_element(part.begin(), part.end());
+    histogram.add(part.data(), part.size(), *minmax.first, *minmax.second);
+  };
+
+  // All parts to one histogram
+  Histogram expected(16);
+  for (const auto &part : parts)
+    add_part(expected, part);
+
+  // Each part to its own histogram, merged in an order and in the reverse order
+  Histogram forward(16);
+  Histogram backward(16);
+  for (uint32_t i = 0; i < parts.size(); ++i)
+  {
+    Histogram lhs(16);
+    add_part(lhs, parts[i]);
+    forward.merge(lhs);
+
+    Histogram rhs(16);
+    add_part(rhs, parts[parts.size() - 1 - i]);
+    backward.merge(rhs);
+  }
+
+  ASSERT_EQ(expected.count(), forward.count());
+  ASSERT_EQ(expected.count(), backward.count());
+  for (float percent = 0.0f; percent <= 100.0f; percent += 2.5f)
+  {
+    ASSERT_EQ(expected.percentile(percent), forward.percentile(percent));
+    ASSERT_EQ(expected.percentile(percent), backward.percentile(percent));
+  }
+}
+
+TEST(HistogramTest, percentile_in_range)
+{
+  const std::vector<float> values{1.0f, 1.0f, 1.0f};
+
+  Histogram histogram;
+  histogram.add(values.data(), values.size(), 1.0f, 1.0f);
+
+  ASSERT_EQ(1.0f, histogram.percentile(0.0f));
+  ASSERT_EQ(1.0f, histogram.percentile(100.0f));
+}
+
+TEST(HistogramTest, merge_empty)
+{
+  const std::vector<float> values{-1.0f, 1.0f};
+
+  Histogram lhs;
+  lhs.merge(Histogram{});
+  ASSERT_EQ(0, lhs.count());
+
+  lhs.add(values.data(), values.size(), -1.0f, 1.0f);
+  lhs.merge(Histogram{});
+  ASSERT_EQ(2, lhs.count());
+
+  Histogram rhs;
+  rhs.merge(lhs);
+  ASSERT_EQ(2, rhs.count());
+}
+
+TEST(HistogramTest, skip_non_finite_values)
+{
+  const std::vector<float> values{0.0f, std::numeric_limits<float>::quiet_NaN(), 1.0f,
+                                  std::numeric_limits<float>::infinity()};
+
+  Histogram histogram;
+  histogram.add(values.data(), values.size(), 0.0f, 1.0f);
+
+  ASSERT_EQ(2, histogram.count());
+  ASSERT_TRUE(std::isfinite(histogram.percentile(100.0f)));
+}
+
+TEST(HistogramTest, percentile_of_empty_histogram_NEG)
+{
+  Histogram histogram;
+
+  EXPECT_ANY_THROW(histogram.percentile(50.0f));
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MinMaxComputer.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <stdexcept>
+
+namespace record_minmax
+{
+
+MinMaxMode toMinMaxMode(const std::string &name)
+{
+  if (name == "percentile")
+    return MinMaxMode::Percentile;
+  if (name == "moving_average")
+    return MinMaxMode::MovingAverage;
+  if (name == "histogram_percentile")
+    return MinMaxMode::HistogramPercentile;
+  throw std::runtime_error("Unsupported min/max mode: " + name);
+}
+
+float getNthPercentile(std::vector<float> values, float percent)
+{
+  if (values.empty())
+    throw std::runtime_error("Percentile of no values.");
+  if (percent < 0.0f || percent > 100.0f)
+    throw std::runtime_error("Percentile should be in [0, 100].");
+
+  const float position = percent / 100.0f * (values.size() - 1);
+  const size_t lower = static_cast<size_t>(std::floor(position));
+  const size_t upper = std::min(lower + 1, values.size() - 1);
+
+  // Only the two elements around the position have to be sorted
+  std::nth_element(values.begin(), values.begin() + lower, values.end());
+  const float lower_value = values[lower];
+  const float upper_value =
+      upper == lower ? lower_value : *std::min_element(values.begin() + upper, values.end());
+
+  return lower_value + (upper_value - lower_value) * (position - lower);
+}
+
+float getMovingAverage(const std::vector<float> &values, float decay)
+{
+  if (values.empty())
+    throw std::runtime_error("Moving average of no values.");
+  if (decay < 0.0f || decay >= 1.0f)
+    throw std::runtime_error("Decay of moving average should be in [0, 1).");
+
+  float average = values[0];
+  for (size_t i = 1; i < values.size(); ++i)
+    average = decay * average + (1.0f - decay) * values[i];
+  return average;
+}
+
+void computeMinMax(const MinMaxOptions &options, const MinMaxMap &minmax_map,
+                   const luci::CircleNode *node, float *min, float *max)
+{
+  const auto &vectors_map = *minmax_map.getMap();
+  const auto vectors_it = vectors_map.find(node);
+  if (vectors_it == vectors_map.end())
+    throw std::runtime_error("Min/max of \"" + node->name() + "\" is not recorded.");
+  const MinMaxVectors &vectors = vectors_it->second;
+
+  switch (options.mode)
+  {
+    case MinMaxMode::Percentile:
+      *min = getNthPercentile(vectors.min_vector, options.min_percentile);
+      *max = getNthPercentile(vectors.max_vector, options.max_percentile);
+      break;
+    case MinMaxMode::MovingAverage:
+      *min = getMovingAverage(vectors.min_vector, options.moving_average_decay);
+      *max = getMovingAverage(vectors.max_vector, options.moving_average_decay);
+      break;
+    case MinMaxMode::HistogramPercentile:
+    {
+      const auto &histogram_map = *minmax_map.getHistogramMap();
+      const auto histogram_it = histogram_map.find(node);
+      if (histogram_it == histogram_map.end() || histogram_it->second.count() == 0)
+      {
+        // No record has finite values, so fall back to the percentiles of the min/max of records
+        *min = getNthPercentile(vectors.min_vector, options.min_percentile);
+        *max = getNthPercentile(vectors.max_vector, options.max_percentile);
+        break;
+      }
+      *min = histogram_it->second.percentile(options.min_percentile);
+      *max = histogram_it->second.percentile(options.max_percentile);
+      break;
+    }
+    default:
+      throw std::runtime_error("Unsupported min/max mode.");
+  }
+  assert(*min <= *max);
+}
+
+} // namespace record_minmax
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MinMaxComputer.h"
+
+#include <luci/IR/Nodes/CircleAdd.h>
+
+#include <gtest/gtest.h>
+
+using namespace record_minmax;
+
+TEST(MinMaxComputerTest, nth_percentile)
+{
+  const std::vector<float> values{4.0f, 0.0f, 3.0f, 1.0f, 2.0f};
+
+  ASSERT_FLOAT_EQ(0.0f, getNthPercentile(values, 0.0f));
+  ASSERT_FLOAT_EQ(4.0f, getNthPercentile(values, 100.0f));
+  ASSERT_FLOAT_EQ(2.0f, getNthPercentile(values, 50.0f));
+  // Interpolated between 0 and 1
+  ASSERT_FLOAT_EQ(0.4f, getNthPercentile(values, 10.0f));
+  // Interpolated between 3 and 4
+  ASSERT_FLOAT_EQ(3.96f, getNthPercentile(values, 99.0f));
+}
+
+TEST(MinMaxComputerTest, nth_percentile_single_value)
+{
+  ASSERT_FLOAT_EQ(1.5f, getNthPercentile({1.5f}, 0.0f));
+  ASSERT_FLOAT_EQ(1.5f, getNthPercentile({1.5f}, 99.0f));
+}
+
+TEST(MinMaxComputerTest, nth_percentile_NEG)
+{
+  EXPECT_ANY_THROW(getNthPercentile({}, 50.0f));
+  EXPECT_ANY_THROW(getNthPercentile({1.0f}, -1.0f));
+  EXPECT_ANY_THROW(getNthPercentile({1.0f}, 101.0f));
+}
+
+TEST(MinMaxComputerTest, moving_average)
+{
+  // 1 -> 0.5 * 1 + 0.5 * 3 = 2 -> 0.5 * 2 + 0.5 * 6 = 4
+  ASSERT_FLOAT_EQ(4.0f, getMovingAverage({1.0f, 3.0f, 6.0f}, 0.5f));
+  // The average follows the last value without decay
+  ASSERT_FLOAT_EQ(6.0f, getMovingAverage({1.0f, 3.0f, 6.0f}, 0.0f));
+  ASSERT_FLOAT_EQ(1.0f, getMovingAverage({1.0f}, 0.9f));
+}
+
+TEST(MinMaxComputerTest, moving_average_NEG)
+{
+  EXPECT_ANY_THROW(getMovingAverage({}, 0.5f));
+  EXPECT_ANY_THROW(getMovingAverage({1.0f}, 1.0f));
+  EXPECT_ANY_THROW(getMovingAverage({1.0f}, -0.1f));
+}
+
+TEST(MinMaxComputerTest, compute_minmax_by_mode)
+{
+  luci::CircleAdd node;
+
+  MinMaxMap minmax_map;
+  minmax_map.recordMinMax(&node, 0, -1.0f, 1.0f);
+  minmax_map.recordMinMax(&node, 1, -3.0f, 3.0f);
+
+  MinMaxOptions options;
+  options.mode = MinMaxMode::MovingAverage;
+  options.moving_average_decay = 0.5f;
+
+  float min = 0.0f, max = 0.0f;
+  computeMinMax(options, minmax_map, &node, &min, &max);
+  ASSERT_FLOAT_EQ(-2.0f, min);
+  ASSERT_FLOAT_EQ(2.0f, max);
+
+  options.mode = MinMaxMode::Percentile;
+  options.min_percentile = 0.0f;
+  options.max_percentile = 100.0f;
+  computeMinMax(options, minmax_map, &node, &min, &max);
+  ASSERT_FLOAT_EQ(-3.0f, min);
+  ASSERT_FLOAT_EQ(3.0f, max);
+}
+
+TEST(MinMaxComputerTest, compute_minmax_by_histogram)
+{
+  luci::CircleAdd node;
+  const std::vector<float> values{-1.0f, 0.0f, 1.0f};
+
+  MinMaxMap minmax_map;
+  minmax_map.recordMinMax(&node, 0, -1.0f, 1.0f);
+  minmax_map.recordHistogram(&node, values.data(), values.size(), -1.0f, 1.0f);
+
+  MinMaxOptions options;
+  options.mode = MinMaxMode::HistogramPercentile;
+  options.min_percentile = 0.0f;
+  options.max_percentile = 100.0f;
+
+  float min = 0.0f, max = 0.0f;
+  computeMinMax(options, minmax_map, &node, &min, &max);
+  ASSERT_FLOAT_EQ(-1.0f, min);
+  ASSERT_FLOAT_EQ(1.0f, max);
+}
+
+TEST(MinMaxComputerTest, compute_minmax_without_histogram)
+{
+  luci::CircleAdd node;
+
+  // Histograms are not recorded for records without finite values
+  MinMaxMap minmax_map;
+  minmax_map.recordMinMax(&node, 0, -1.0f, 1.0f);
+  minmax_map.recordMinMax(&node, 1, -3.0f, 3.0f);
+
+  MinMaxOptions options;
+  options.mode = MinMaxMode::HistogramPercentile;
+  options.min_percentile = 0.0f;
+  options.max_percentile = 100.0f;
+
+  // Fall back to the percentiles of the min/max of records
+  float min = 0.0f, max = 0.0f;
+  computeMinMax(options, minmax_map, &node, &min, &max);
+  ASSERT_FLOAT_EQ(-3.0f, min);
+  ASSERT_FLOAT_EQ(3.0f, max);
+}
+
+TEST(MinMaxComputerTest, compute_minmax_not_recorded_NEG)
+{
+  luci::CircleAdd node;
+  MinMaxMap minmax_map;
+  MinMaxOptions options;
+
+  float min = 0.0f, max = 0.0f;
+  EXPECT_ANY_THROW(computeMinMax(options, minmax_map, &node, &min, &max));
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MinMaxObserver.h"
+
+#include <cassert>
+#include <cmath>
+
+using DataType = luci_interpreter::DataType;
+
+namespace
+{
+
+// Min/max of data whose size is positive
+void computeMinMax(const float *data, int32_t size, float *min, float *max)
+{
+  // Independent lanes break the dependency between iterations, so that the loop is vectorized.
+  // The conditional expressions have the semantics of SIMD min/max instructions.
+  constexpr int32_t kLanes = 16;
+  float lane_min[kLanes];
+  float lane_max[kLanes];
+  for (int32_t l = 0; l < kLanes; ++l)
+  {
+    lane_min[l] = data[0];
+    lane_max[l] = data[0];
+  }
+
+  int32_t i = 0;
+  for (; i + kLanes <= size; i += kLanes)
+  {
+    for (int32_t l = 0; l < kLanes; ++l)
+    {
+      const float value = data[i + l];
+      lane_min[l] = value < lane_min[l] ? value : lane_min[l];
+      lane_max[l] = value > lane_max[l] ? value : lane_max[l];
+    }
+  }
+  for (; i < size; ++i)
+  {
+    lane_min[0] = data[i] < lane_min[0] ? data[i] : lane_min[0];
+    lane_max[0] = data[i] > lane_max[0] ? data[i] : lane_max[0];
+  }
+
+  *min = lane_min[0];
+  *max = lane_max[0];
+  for (int32_t l = 1; l < kLanes; ++l)
+  {
+    *min = lane_min[l] < *min ? lane_min[l] : *min;
+    *max = lane_max[l] > *max ? lane_max[l] : *max;
+  }
+}
+
+} // namespace
+
+namespace record_minmax
+{
+
+void MinMaxMap::recordMinMax(const luci::CircleNode *node, int32_t record_idx, float min,
+                             float max)
+{
+  MinMaxVectors &vectors = _minmax_map[node];
+  assert(vectors.record_vector.empty() || vectors.record_vector.back() < record_idx);
+  vectors.record_vector.push_back(record_idx);
+  vectors.min_vector.push_back(min);
+  vectors.max_vector.push_back(max);
+}
+
+void MinMaxMap::recordHistogram(const luci::CircleNode *node, const float *data, int32_t size,
+                                float min, float max)
+{
+  _histogram_map[node].add(data, size, min, max);
+}
+
+void MinMaxMap::merge(const MinMaxMap &other)
+{
+  for (const auto &node_histogram : other._histogram_map)
+    _histogram_map[node_histogram.first].merge(node_histogram.second);
+
+  for (const auto &node_vectors : other._minmax_map)
+  {
+    const MinMaxVectors &rhs = node_vectors.second;
+    const MinMaxVectors lhs = std::move(_minmax_map[node_vectors.first]);
+    MinMaxVectors &merged = _minmax_map[node_vectors.first];
+    merged = MinMaxVectors{};
+
+    size_t l = 0, r = 0;
+    while (l < lhs.record_vector.size() || r < rhs.record_vector.size())
+    {
+      const bool take_lhs = r == rhs.record_vector.size() ||
+                            (l < lhs.record_vector.size() &&
+                             lhs.record_vector[l] < rhs.record_vector[r]);
+      const MinMaxVectors &from = take_lhs ? lhs : rhs;
+      const size_t i = take_lhs ? l++ : r++;
+      merged.record_vector.push_back(from.record_vector[i]);
+      merged.min_vector.push_back(from.min_vector[i]);
+      merged.max_vector.push_back(from.max_vector[i]);
+    }
+  }
+}
+
+void MinMaxObserver::postTensorWrite(const luci::CircleNode *node,
+                                     const luci_interpreter::Tensor *tensor)
+{
+  // Min/max of constants are not activation statistics
+  if (node->opcode() == luci::CircleOpcode::CONST)
+    return;
+
+  // Only float tensors are quantized
+  if (tensor->element_type() != DataType::FLOAT32)
+    return;
+
+  const float *data = tensor->data<float>();
+  const int32_t num_elements = tensor->shape().num_elements();
+  if (num_elements == 0)
+    return;
+
+  float min{}, max{};
+  computeMinMax(data, num_elements, &min, &max);
+  _minmax_data.recordMinMax(node, _record_idx, min, max);
+
+  // Histograms cannot cover infinite values
+  if (_record_histogram && std::isfinite(min) && std::isfinite(max))
+    _minmax_data.recordHistogram(node, data, num_elements, min, max);
+}
+
+} // namespace record_minmax
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MinMaxObserver.h"
+
+#include <luci/IR/Nodes/CircleAdd.h>
+#include <luci/IR/Nodes/CircleConst.h>
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <memory>
+
+using namespace record_minmax;
+
+namespace
+{
+
+std::unique_ptr<luci_interpreter::Tensor> make_tensor(luci_interpreter::DataType dtype,
+                                                      const std::vector<float> &values)
+{
+  auto tensor = std::make_unique<luci_interpreter::Tensor>(
+      dtype, luci_interpreter::Shape{static_cast<int32_t>(values.size())},
+      luci_interpreter::AffineQuantization{}, "");
+  if (dtype == luci_interpreter::DataType::FLOAT32)
+    tensor->writeData(values.data(), values.size() * sizeof(float));
+  return tensor;
+}
+
+} // namespace
+
+TEST(MinMaxMapTest, merge_keeps_record_order)
+{
+  luci::CircleAdd node;
+
+  // Records are distributed to two interpreters in turn
+  MinMaxMap lhs;
+  lhs.recordMinMax(&node, 0, -0.0f, 0.0f);
+  lhs.recordMinMax(&node, 2, -2.0f, 2.0f);
+  lhs.recordMinMax(&node, 3, -3.0f, 3.0f);
+
+  MinMaxMap rhs;
+  rhs.recordMinMax(&node, 1, -1.0f, 1.0f);
+  rhs.recordMinMax(&node, 4, -4.0f, 4.0f);
+
+  lhs.merge(rhs);
+
+  const auto &vectors = lhs.getMap()->at(&node);
+  ASSERT_EQ(std::vector<int32_t>({0, 1, 2, 3, 4}), vectors.record_vector);
+  ASSERT_EQ(std::vector<float>({-0.0f, -1.0f, -2.0f, -3.0f, -4.0f}), vectors.min_vector);
+  ASSERT_EQ(std::vector<float>({0.0f, 1.0f, 2.0f, 3.0f, 4.0f}), vectors.max_vector);
+}
+
+TEST(MinMaxMapTest, merge_nodes_of_one_side)
+{
+  luci::CircleAdd node_a;
+  luci::CircleAdd node_b;
+
+  MinMaxMap lhs;
+  lhs.recordMinMax(&node_a, 0, -1.0f, 1.0f);
+
+  MinMaxMap rhs;
+  rhs.recordMinMax(&node_b, 1, -2.0f, 2.0f);
+
+  lhs.merge(rhs);
+
+  ASSERT_EQ(2, lhs.getMap()->size());
+  ASSERT_EQ(std::vector<int32_t>({0}), lhs.getMap()->at(&node_a).record_vector);
+  ASSERT_EQ(std::vector<int32_t>({1}), lhs.getMap()->at(&node_b).record_vector);
+  ASSERT_EQ(std::vector<float>({-2.0f}), lhs.getMap()->at(&node_b).min_vector);
+}
+
+TEST(MinMaxMapTest, merge_empty_NEG)
+{
+  luci::CircleAdd node;
+
+  MinMaxMap lhs;
+  lhs.recordMinMax(&node, 0, -1.0f, 1.0f);
+
+  lhs.merge(MinMaxMap{});
+
+  ASSERT_EQ(1, lhs.getMap()->size());
+  ASSERT_EQ(std::vector<int32_t>({0}), lhs.getMap()->at(&node).record_vector);
+}
+
+TEST(MinMaxObserverTest, record_minmax_of_float_tensors)
+{
+  luci::CircleAdd node;
+  // More values than the lanes of the observer, with the min/max in the remainder
+  std::vector<float> values(37, 0.5f);
+  values[35] = -2.0f;
+  values[36] = 3.0f;
+  auto tensor = make_tensor(luci_interpreter::DataType::FLOAT32, values);
+
+  MinMaxObserver observer;
+  observer.setRecord(0);
+  observer.postTensorWrite(&node, tensor.get());
+  observer.setRecord(1);
+  observer.postTensorWrite(&node, tensor.get());
+
+  const auto &vectors = observer.minMaxData()->getMap()->at(&node);
+  ASSERT_EQ(std::vector<int32_t>({0, 1}), vectors.record_vector);
+  ASSERT_EQ(std::vector<float>({-2.0f, -2.0f}), vectors.min_vector);
+  ASSERT_EQ(std::vector<float>({3.0f, 3.0f}), vectors.max_vector);
+  ASSERT_TRUE(observer.minMaxData()->getHistogramMap()->empty());
+}
+
+TEST(MinMaxObserverTest, record_histogram)
+{
+  luci::CircleAdd node;
+  auto tensor = make_tensor(luci_interpreter::DataType::FLOAT32,
+                            {0.0f, std::numeric_limits<float>::quiet_NaN(), 1.0f});
+
+  MinMaxObserver observer(true);
+  observer.postTensorWrite(&node, tensor.get());
+
+  const auto &histogram = observer.minMaxData()->getHistogramMap()->at(&node);
+  ASSERT_EQ(2, histogram.count());
+}
+
+TEST(MinMaxObserverTest, skip_constant_and_non_float_tensors_NEG)
+{
+  luci::CircleConst const_node;
+  luci::CircleAdd int_node;
+  auto float_tensor = make_tensor(luci_interpreter::DataType::FLOAT32, {1.0f});
+  auto int_tensor = make_tensor(luci_interpreter::DataType::S32, {1.0f});
+
+  MinMaxObserver observer(true);
+  observer.postTensorWrite(&const_node, float_tensor.get());
+  observer.postTensorWrite(&int_node, int_tensor.get());
+
+  ASSERT_TRUE(observer.minMaxData()->getMap()->empty());
+  ASSERT_TRUE(observer.minMaxData()->getHistogramMap()->empty());
+}
@@ -15,54 +15,23 @@
  */
 
 #include "RecordMinMax.h"
+#include "BlockingQueue.h"
 #include "CircleExpContract.h"
 #include "HDF5Importer.h"
 
 #include <luci/Importer.h>
 #include <luci/CircleExporter.h>
 
+#include <exception>
 #include <fstream>
+#include <iostream>
+#include <mutex>
 #include <stdexcept>
+#include <thread>
 
 using Shape = luci_interpreter::Shape;
 using DataType = luci_interpreter::DataType;
 
-namespace
-{
-
-/**
- * @brief  getTensorSize will return size in bytes
- */
-template <typename NodeT> size_t getTensorSize(const NodeT *node)
-{
-  uint32_t tensor_size = loco::size(node->dtype());
-  for (uint32_t i = 0; i < node->rank(); ++i)
-    tensor_size *= node->dim(i).value();
-  return tensor_size;
-}
-
-/**
- * @brief  verifyTypeShape checks the type and the shape of CircleInput
- *         This throws an exception if type or shape does not match
- */
-bool verifyTypeShape(const luci::CircleInput *input_node, const DataType &dtype, const Shape &shape)
-{
-  // Type check
-  if (dtype != input_node->dtype())
-    throw std::runtime_error("Wrong input type.");
-
-  if (shape.num_dims() != input_node->rank())
-    throw std::runtime_error("Input rank mismatch.");
-
-  for (uint32_t i = 0; i < shape.num_dims(); i++)
-  {
-    if (shape.dim(i) != input_node->dim(i).value())
-      throw std::runtime_error("Input shape mismatch.");
-  }
-}
-
-} // namespace
-
 namespace record_minmax
 {
 
@@ -83,10 +52,22 @@ void RecordMinMax::initialize(const std::string &input_model_path)
     throw std::runtime_error("ERROR: Failed to load '" + input_model_path + "'");
   }
 
-  // Initialize interpreter
-  _interpreter = std::make_unique<luci_interpreter::Interpreter>(_module.get());
+  // Initialize interpreters and observers
+  for (uint32_t i = 0; i < _num_threads + 1; ++i)
+  {
+    _interpreters.push_back(std::make_unique<luci_interpreter::Interpreter>(_module.get()));
+    const bool record_histogram = _options.mode == MinMaxMode::HistogramPercentile;
+    _observers.push_back(std::make_unique<MinMaxObserver>(record_histogram));
+    _interpreters.back()->attachObserver(_observers.back().get());
+  }
 
-  // TODO: Attach observer to the interpreter
+  const auto &memory_stats = _interpreters.front()->memoryStats();
+  std::cout << "Peak memory of tensors: " << memory_stats.peak_size() << " bytes per interpreter x "
+            << _interpreters.size() << " interpreters (" << memory_stats.static_size
+            << " bytes of inputs and outputs, " << memory_stats.arena_size
+            << " bytes of intermediates which take " << memory_stats.intermediate_size
+            << " bytes without planning), and " << memory_stats.constant_size
+            << " bytes of constants shared by the interpreters" << std::endl;
 }
 
 void RecordMinMax::profileData(const std::string &input_data_path)
@@ -98,39 +79,102 @@ void RecordMinMax::profileData(const std::string &input_data_path)
   const auto input_nodes = loco::input_nodes(_module->graph());
   const auto num_inputs = input_nodes.size();
 
-  for (int32_t record_idx = 0; record_idx < num_records; record_idx++)
+  // Interpreters are passed around by their indices. This thread reads a record into the input
+  // tensors of an idle interpreter, and a worker thread runs the interpreter and makes it idle
+  // again. HDF5 is accessed only by this thread.
+  const int32_t stop = -1;
+  BlockingQueue<int32_t> idle_queue;
+  BlockingQueue<int32_t> ready_queue;
+  for (uint32_t i = 0; i < _interpreters.size(); ++i)
+    idle_queue.push(i);
+
+  std::mutex error_mutex;
+  std::exception_ptr error;
+  auto failed = [&]() {
+    std::lock_guard<std::mutex> lock(error_mutex);
+    return error != nullptr;
+  };
+  auto fail = [&](std::exception_ptr e) {
+    std::lock_guard<std::mutex> lock(error_mutex);
+    if (error == nullptr)
+      error = e;
+  };
+
+  std::vector<std::thread> workers;
+  for (uint32_t i = 0; i < _num_threads; ++i)
   {
-    if (num_inputs != importer.numInputs(record_idx))
-      throw std::runtime_error("Wrong number of inputs.");
+    workers.emplace_back([&]() {
+      for (int32_t idx = ready_queue.pop(); idx != stop; idx = ready_queue.pop())
+      {
+        try
+        {
+          _interpreters[idx]->interpret();
+        }
+        catch (...)
+        {
+          fail(std::current_exception());
+        }
+        idle_queue.push(idx);
+      }
+    });
+  }
 
-    for (int32_t input_idx = 0; input_idx < num_inputs; input_idx++)
+  try
+  {
+    for (int32_t record_idx = 0; record_idx < num_records && !failed(); record_idx++)
     {
-      const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
-      assert(input_node->index() == input_idx);
-      DataType dtype;
-      Shape shape(input_node->rank());
-      std::vector<char> input_data(getTensorSize(input_node));
-      importer.readTensor(record_idx, input_idx, &dtype, &shape, input_data.data());
-
-      // Check the type and the shape of the input data is valid
-      verifyTypeShape(input_node, dtype, shape);
-
-      // TODO: Input data is copied twice (file -> buffer (input_data) -> interpreter inputs)
-      //       We can redcue the copy by directly writing data from file to interpreter inputs
-      _interpreter->writeInputTensor(input_node, input_data.data(), input_data.size());
+      if (num_inputs != importer.numInputs(record_idx))
+        throw std::runtime_error("Wrong number of inputs.");
+
+      const int32_t idx = idle_queue.pop();
+      _observers[idx]->setRecord(record_idx);
+      for (int32_t input_idx = 0; input_idx < num_inputs; input_idx++)
+      {
+        const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
+        assert(input_node->index() == input_idx);
+        auto *tensor = _interpreters[idx]->getInputTensor(input_node);
+
+        // Read input data directly into the input tensor, after checking its type and shape
+        importer.readTensor(record_idx, input_idx, tensor->element_type(), tensor->shape(),
+                            tensor->data<void>());
+      }
+      ready_queue.push(idx);
     }
-
-    _interpreter->interpret();
   }
+  catch (...)
+  {
+    fail(std::current_exception());
+  }
+
+  for (uint32_t i = 0; i < _num_threads; ++i)
+    ready_queue.push(stop);
+  for (auto &worker : workers)
+    worker.join();
+
+  if (error != nullptr)
+    std::rethrow_exception(error);
+
+  // Each observer has min/max of the records run by its interpreter
+  for (const auto &observer : _observers)
+    _minmax_data.merge(*observer->minMaxData());
 
-  // TODO: Determine the final min/max for each activation
-  //       E.g., using clipping, averaging
+  // Determine the final min/max of each activation, which QuantizeWithMinMaxPass takes
+  for (const auto &node_vectors : *_minmax_data.getMap())
+  {
+    float min{}, max{};
+    computeMinMax(_options, _minmax_data, node_vectors.first, &min, &max);
+
+    auto quantparam = std::make_unique<luci::CircleQuantParam>();
+    quantparam->min.push_back(min);
+    quantparam->max.push_back(max);
+    // The nodes are of the module, which RecordMinMax owns
+    auto *node = const_cast<luci::CircleNode *>(node_vectors.first);
+    node->quantparam(std::move(quantparam));
+  }
 }
 
 void RecordMinMax::saveModel(const std::string &output_model_path)
 {
-  // TODO: Write min/max data to activation tensors in CircleNodes
-
   // Export to output Circle file
   luci::CircleExporter exporter;
   CircleExpContract contract(_module.get(), output_model_path);
@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_FP16_TENSOR_UTILS_H__
+#define __NNFW_CKER_FP16_TENSOR_UTILS_H__
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define CKER_FP16_F16C
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#define CKER_FP16_NEON
+#include <arm_neon.h>
+#endif
+
+// Weights stored as IEEE 754 half precision, given as raw bits (uint16_t), are converted to float
+// right before they are multiplied. The conversion uses F16C on x86 when the CPU supports it and
+// NEON on arm64, and falls back to portable code otherwise.
+
+namespace nnfw
+{
+namespace cker
+{
+
+inline float Fp16ToFp32(uint16_t h)
+{
+  const uint32_t sign = static_cast<uint32_t>(h & 0x8000) << 16;
+  uint32_t exponent = (h >> 10) & 0x1f;
+  uint32_t mantissa = h & 0x3ff;
+
+  uint32_t bits;
+  if (exponent == 0x1f)
+  {
+    // Inf or NaN
+    bits = sign | 0x7f800000 | (mantissa << 13);
+  }
+  else if (exponent != 0)
+  {
+    bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+  }
+  else if (mantissa == 0)
+  {
+    bits = sign;
+  }
+  else
+  {
+    // Subnormal half is a normal float
+    exponent = 113;
+    while ((mantissa & 0x400) == 0)
+    {
+      mantissa <<= 1;
+      exponent--;
+    }
+    bits = sign | (exponent << 23) | ((mantissa & 0x3ff) << 13);
+  }
+
+  float f;
+  std::memcpy(&f, &bits, sizeof(f));
+  return f;
+}
+
+// Round to nearest even, as F16C and NEON do
+inline uint16_t Fp32ToFp16(float f)
+{
+  uint32_t bits;
+  std::memcpy(&bits, &f, sizeof(bits));
+  const uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+  const uint32_t abs_bits = bits & 0x7fffffff;
+
+  if (abs_bits >= 0x7f800000)
+  {
+    // Inf or NaN, keeping NaN quiet
+    return sign | 0x7c00 | (abs_bits > 0x7f800000 ? 0x200 : 0);
+  }
+  if (abs_bits >= 0x477ff000)
+  {
+    // Overflow after rounding
+    return sign | 0x7c00;
+  }
+  if (abs_bits < 0x38800000)
+  {
+    // Subnormal half or zero
+    if (abs_bits < 0x33000000)
+      return sign;
+    const uint32_t shift = 126 - (abs_bits >> 23);
+    const uint32_t mantissa = (abs_bits & 0x7fffff) | 0x800000;
+    uint32_t half = mantissa >> shift;
+    const uint32_t rest = mantissa & ((1u << shift) - 1);
+    const uint32_t halfway = 1u << (shift - 1);
+    if (rest > halfway || (rest == halfway && (half & 1)))
+      half++;
+    return sign | static_cast<uint16_t>(half);
+  }
+
+  uint32_t half = ((abs_bits >> 13) - (112 << 10));
+  const uint32_t rest = abs_bits & 0x1fff;
+  if (rest > 0x1000 || (rest == 0x1000 && (half & 1)))
+    half++;
+  return sign | static_cast<uint16_t>(half);
+}
+
+inline void PortableFp16ToFp32(const uint16_t *from, float *to, int size)
+{
+  for (int i = 0; i < size; ++i)
+  {
+    to[i] = Fp16ToFp32(from[i]);
+  }
+}
+
+#ifdef CKER_FP16_F16C
+__attribute__((target("avx,f16c"))) inline void F16CFp16ToFp32(const uint16_t *from, float *to,
+                                                               int size)
+{
+  int i = 0;
+  for (; i + 8 <= size; i += 8)
+  {
+    const __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i *>(from + i));
+    _mm256_storeu_ps(to + i, _mm256_cvtph_ps(h));
+  }
+  PortableFp16ToFp32(from + i, to + i, size - i);
+}
+
+inline bool HasF16C()
+{
+  static const bool has_f16c = __builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c");
+  return has_f16c;
+}
+#endif
+
+#ifdef CKER_FP16_NEON
+inline void NeonFp16ToFp32(const uint16_t *from, float *to, int size)
+{
+  int i = 0;
+  for (; i + 4 <= size; i += 4)
+  {
+    vst1q_f32(to + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(from + i))));
+  }
+  PortableFp16ToFp32(from + i, to + i, size - i);
+}
+#endif
+
+inline void Fp16ToFp32(const uint16_t *from, float *to, int size)
+{
+#if defined(CKER_FP16_F16C)
+  if (HasF16C())
+  {
+    F16CFp16ToFp32(from, to, size);
+    return;
+  }
+#elif defined(CKER_FP16_NEON)
+  NeonFp16ToFp32(from, to, size);
+  return;
+#endif
+  PortableFp16ToFp32(from, to, size);
+}
+
+inline void Fp32ToFp16(const float *from, uint16_t *to, int size)
+{
+  for (int i = 0; i < size; ++i)
+  {
+    to[i] = Fp32ToFp16(from[i]);
+  }
+}
+
+/**
+ * @brief Buffer for weights converted to float, shared by all kernels of a thread so that
+ *        converted weights do not stay resident for each layer
+ * @note  Kernels convert weights panel by panel into it, so it holds a panel of weights and the
+ *        inputs multiplied with it, and never the whole weights of a layer
+ */
+inline std::vector<float> &Fp16ConversionScratch()
+{
+  static thread_local std::vector<float> scratch;
+  return scratch;
+}
+
+inline float Fp16DotProduct(const float *lhs, const float *rhs, int size)
+{
+  // Independent accumulators let the compiler keep them in a vector register
+  constexpr int kLanes = 8;
+  float acc[kLanes] = {0.0f};
+  int i = 0;
+  for (; i + kLanes <= size; i += kLanes)
+  {
+    for (int l = 0; l < kLanes; ++l)
+    {
+      acc[l] += lhs[i + l] * rhs[i + l];
+    }
+  }
+  float sum = 0.0f;
+  for (int l = 0; l < kLanes; ++l)
+  {
+    sum += acc[l];
+  }
+  for (; i < size; ++i)
+  {
+    sum += lhs[i] * rhs[i];
+  }
+  return sum;
+}
+
+/**
+ * @brief result[b * m_rows + r] += matrix[r] . vectors[b] with matrix stored as fp16
+ * @note  Rows are converted in panels small enough to stay in L1 cache, and each panel is
+ *        multiplied with all batches before the next one is converted. So the matrix is read
+ *        from memory only once, at half the size of float.
+ */
+inline void Fp16MatrixBatchVectorMultiplyAccumulate(const uint16_t *matrix, int m_rows, int m_cols,
+                                                    const float *vectors, int n_batch,
+                                                    float *result)
+{
+  constexpr int kPanelSize = 4096; // 16KB of float
+  const int panel_rows = std::max(1, std::min(m_rows, kPanelSize / std::max(1, m_cols)));
+
+  std::vector<float> &panel = Fp16ConversionScratch();
+  panel.resize(static_cast<size_t>(panel_rows) * m_cols);
+
+  for (int row_begin = 0; row_begin < m_rows; row_begin += panel_rows)
+  {
+    const int rows = std::min(panel_rows, m_rows - row_begin);
+    Fp16ToFp32(matrix + static_cast<size_t>(row_begin) * m_cols, panel.data(), rows * m_cols);
+
+    for (int b = 0; b < n_batch; ++b)
+    {
+      const float *vector = vectors + static_cast<size_t>(b) * m_cols;
+      float *result_in_batch = result + static_cast<size_t>(b) * m_rows + row_begin;
+      for (int r = 0; r < rows; ++r)
+      {
+        result_in_batch[r] += Fp16DotProduct(panel.data() + static_cast<size_t>(r) * m_cols,
+                                             vector, m_cols);
+      }
+    }
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_FP16_TENSOR_UTILS_H__
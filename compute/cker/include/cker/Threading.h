@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_THREADING_H__
+#define __NNFW_CKER_THREADING_H__
+
+#include <atomic>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace threading
+{
+
+/**
+ * @brief Function which returns the number of threads a kernel may use
+ */
+using NumThreadsFunc = int (*)(void);
+
+inline std::atomic<NumThreadsFunc> &NumThreadsFuncRef()
+{
+  static std::atomic<NumThreadsFunc> func{nullptr};
+  return func;
+}
+
+/**
+ * @brief Let the caller of cker decide the number of threads for intra-op parallelism, so that
+ *        Eigen and ruy paths follow its thread budget
+ */
+inline void SetNumThreadsFunc(NumThreadsFunc func) { NumThreadsFuncRef() = func; }
+
+/**
+ * @brief Get the number of threads a kernel may use
+ *
+ * @param default_num_threads Value to be returned if it is not decided by the caller of cker
+ */
+inline int GetNumThreads(int default_num_threads)
+{
+  auto func = NumThreadsFuncRef().load();
+  return func != nullptr ? func() : default_num_threads;
+}
+
+} // namespace threading
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_THREADING_H__
@@ -33,6 +33,8 @@ enum class FusedActivationFunctionType
   kRelu6 = 1,
   kRelu1 = 2,
   kRelu = 3,
+  kTanh = 4,
+  kSigmoid = 5,
 };
 enum class PaddingType
 {
@@ -147,6 +149,8 @@ struct ConvParams
   float float_activation_min;
   float float_activation_max;
   bool is_replaced_weights{false};
+  // Whether the weights stay unchanged at the same address, so that a GEMM may cache its packing
+  bool lhs_cacheable{false};
 };
 
 struct ComparisonParams
@@ -248,6 +252,8 @@ struct FullyConnectedParams
   // float activation params.
   float float_activation_min;
   float float_activation_max;
+  // Whether the weights stay unchanged at the same address, so that a GEMM may cache its packing
+  bool lhs_cacheable{false};
   // FullyConnectedWeightsFormat weights_format;
 };
 
@@ -287,6 +293,20 @@ struct TransposeConvParams
   float float_activation_max;
 };
 
+struct LSTMParams
+{
+  // Activation of cell input and cell output
+  FusedActivationFunctionType activation;
+  // Clipping thresholds of cell state and projection output, where 0 disables clipping
+  float cell_clip;
+  float proj_clip;
+};
+
+struct RNNParams
+{
+  FusedActivationFunctionType activation;
+};
+
 struct SliceParams
 {
   int8_t begin_count;
@@ -22,6 +22,7 @@
 
 #include <Eigen/Core>
 #include <thread>
+#include "cker/Threading.h"
 #include "cker/eigen/eigen_spatial_convolutions.h"
 
 #ifdef EIGEN_USE_THREADS
@@ -110,7 +111,19 @@ struct EigenContext
 inline const Eigen::ThreadPoolDevice *GetThreadPoolDevice()
 {
   auto &ctx = EigenContext::GetEigenContext();
-  return ctx.device.get();
+  const int num_threads = threading::GetNumThreads(ctx.device->numThreads());
+  if (num_threads >= ctx.device->numThreads())
+  {
+    return ctx.device.get();
+  }
+
+  // Use only a part of the threadpool, which is shared with kernels running on other threads
+  thread_local std::unique_ptr<Eigen::ThreadPoolDevice> device;
+  if (device == nullptr || device->numThreads() != num_threads)
+  {
+    device.reset(new Eigen::ThreadPoolDevice(ctx.thread_pool_wrapper.get(), num_threads));
+  }
+  return device.get();
 }
 
 } // namespace eigen_support
@@ -20,6 +20,8 @@
 
 #include <public/gemmlowp.h>
 
+#include "cker/Threading.h"
+
 #include <memory>
 #include <thread>
 
@@ -35,21 +37,13 @@ struct GemmContext
   std::unique_ptr<gemmlowp::GemmContext> gemm_context;
   constexpr static int default_num_threadpool_threads = 4;
 
-  GemmContext()
-  {
-    int num_threads = std::thread::hardware_concurrency() / 2;
-    if (num_threads == 0)
-    {
-      num_threads = default_num_threadpool_threads;
-    }
-
-    gemm_context.reset(new gemmlowp::GemmContext());
-    gemm_context->set_max_num_threads(num_threads);
-  }
+  GemmContext() { gemm_context.reset(new gemmlowp::GemmContext()); }
 
   static inline GemmContext &GetGemmLowpContext()
   {
-    static GemmContext instance;
+    // gemmlowp::GemmContext must not be used by multiple threads at the same time. Give each thread
+    // its own one so that kernels on different threads do not race.
+    static thread_local GemmContext instance;
     return instance;
   }
 };
@@ -57,6 +51,9 @@ struct GemmContext
 inline gemmlowp::GemmContext *GetGemmLowpContext()
 {
   auto &ctx = GemmContext::GetGemmLowpContext();
+  // The share of the thread budget changes as kernels on other threads start and finish
+  ctx.gemm_context->set_max_num_threads(
+      threading::GetNumThreads(GemmContext::default_num_threadpool_threads));
   return ctx.gemm_context.get();
 }
 
@@ -19,6 +19,7 @@
 #define __NNFW_CKER_BINARY_ARITHMETIC_OPS_H__
 
 #include <functional>
+#include <stdexcept>
 #include "cker/operation/optimized/BinaryArithmeticOps.h"
 #include "cker/operation/reference/BinaryArithmeticOps.h"
 #include "cker/Shape.h"
@@ -229,6 +230,31 @@ inline void BinaryArithmeticOp(const BinaryArithmeticOpParam &params, const Shap
   }
 }
 
+template <>
+inline void BinaryArithmeticOp(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
+                               const uint8_t *input1_data, const Shape &input2_shape,
+                               const uint8_t *input2_data, const Shape &output_shape,
+                               uint8_t *output_data)
+{
+  switch (params.type)
+  {
+    case nnfw::cker::BinaryArithmeticOpType::ADD:
+      optimized::Add(params, input1_shape, input1_data, input2_shape, input2_data, output_shape,
+                     output_data);
+      break;
+    case nnfw::cker::BinaryArithmeticOpType::SUB:
+      optimized::Sub(params, input1_shape, input1_data, input2_shape, input2_data, output_shape,
+                     output_data);
+      break;
+    case nnfw::cker::BinaryArithmeticOpType::MUL:
+      optimized::Mul(params, input1_shape, input1_data, input2_shape, input2_data, output_shape,
+                     output_data);
+      break;
+    default:
+      throw std::runtime_error{"BinaryArithmeticOp: Unsupported operation for quant8"};
+  }
+}
+
 template <typename T>
 inline void BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const Shape &input1_shape,
                                         const T *input1_data, const Shape &input2_shape,
@@ -270,6 +296,31 @@ inline void BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const S
   }
 }
 
+template <>
+inline void BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const Shape &input1_shape,
+                                        const uint8_t *input1_data, const Shape &input2_shape,
+                                        const uint8_t *input2_data, const Shape &output_shape,
+                                        uint8_t *output_data)
+{
+  switch (params.type)
+  {
+    case nnfw::cker::BinaryArithmeticOpType::ADD:
+      optimized::BroadcastAddDispatch(params, input1_shape, input1_data, input2_shape, input2_data,
+                                      output_shape, output_data);
+      break;
+    case nnfw::cker::BinaryArithmeticOpType::SUB:
+      optimized::BroadcastSubDispatch(params, input1_shape, input1_data, input2_shape, input2_data,
+                                      output_shape, output_data);
+      break;
+    case nnfw::cker::BinaryArithmeticOpType::MUL:
+      optimized::BroadcastMulDispatch(params, input1_shape, input1_data, input2_shape, input2_data,
+                                      output_shape, output_data);
+      break;
+    default:
+      throw std::runtime_error{"BroadcastBinaryArithmeticOp: Unsupported operation for quant8"};
+  }
+}
+
 } // namespace cker
 } // namespace nnfw
 
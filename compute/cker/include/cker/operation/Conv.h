@@ -23,6 +23,10 @@
 #include "cker/Utils.h"
 #include "cker/operation/reference/Conv.h"
 #include "cker/operation/optimized/Conv.h"
+#include "cker/operation/optimized/ConvInt8.h"
+#include "cker/operation/optimized/Fp16Conv.h"
+#include <cassert>
+#include <memory>
 #include <vector>
 
 namespace nnfw
@@ -73,14 +77,30 @@ public:
       {
         const auto output_depth = filter_shape.Dims(0);
         const Shape hwcn_filter_shape{filter_shape.FlatSize() / output_depth, output_depth};
-        _modified_filter_data.resize(hwcn_filter_shape.FlatSize());
-        TransposeFloatTensor(filter_data, hwcn_filter_shape, &_modified_filter_data[0]);
+        auto modified_filter_data = std::make_shared<std::vector<float>>();
+        modified_filter_data->resize(hwcn_filter_shape.FlatSize());
+        TransposeFloatTensor(filter_data, hwcn_filter_shape, &(*modified_filter_data)[0]);
+        _modified_filter_data = modified_filter_data;
         is_replaced_weights = true;
       }
       _prepared = true;
     }
   }
 
+  // float with filter already transposed by another Conv of the same filter
+  void prepare(const std::shared_ptr<const std::vector<float>> &modified_filter_data)
+  {
+    assert(modified_filter_data != nullptr);
+    _modified_filter_data = modified_filter_data;
+    _prepared = true;
+  }
+
+  // Transposed float filter, which is shared with other Convs of the same filter
+  const std::shared_ptr<const std::vector<float>> &modifiedFilterData() const
+  {
+    return _modified_filter_data;
+  }
+
   void prepareQuant(const Shape &input_shape, const Shape &kernel_shape, const Shape &output_shape,
                     uint32_t stride_width, uint32_t stride_height)
   {
@@ -109,8 +129,9 @@ public:
         prepare(filter_shape, filter_data, params.padding_type, not_used_condition);
         _prepared = true;
       }
-      multithreaded::Conv(params, input_shape, input_data, filter_shape, &_modified_filter_data[0],
-                          bias_shape, bias_data, output_shape, output_data);
+      multithreaded::Conv(params, input_shape, input_data, filter_shape,
+                          _modified_filter_data->data(), bias_shape, bias_data, output_shape,
+                          output_data);
     }
     else
     {
@@ -120,6 +141,15 @@ public:
     }
   }
 
+  // float with filter stored as fp16 in OHWI, which is converted to float panel by panel
+  void operator()(const ConvParams &params, const Shape &input_shape, const float *input_data,
+                  const Shape &filter_shape, const uint16_t *filter_data, const Shape &bias_shape,
+                  const float *bias_data, const Shape &output_shape, float *output_data)
+  {
+    multithreaded::Fp16Conv(params, input_shape, input_data, filter_shape, filter_data, bias_shape,
+                            bias_data, output_shape, output_data);
+  }
+
   void operator()(const ConvParams &params, const Shape &input_shape, const uint8_t *input_data,
                   const Shape &filter_shape, const uint8_t *filter_data, const Shape &bias_shape,
                   const int32_t *bias_data, const Shape &output_shape, uint8_t *output_data)
@@ -137,8 +167,30 @@ public:
     }
   }
 
+  // int8 with symmetric filter, requantized with the multiplier of each output channel
+  void operator()(const ConvParams &params, const int32_t *output_multiplier,
+                  const int *output_shift, const Shape &input_shape, const int8_t *input_data,
+                  const Shape &filter_shape, const int8_t *filter_data, const Shape &bias_shape,
+                  const int32_t *bias_data, const Shape &output_shape, int8_t *output_data)
+  {
+    if (_prepared)
+    {
+      // im2col only copies bytes, so its buffer is shared with uint8
+      int8_t *im2col_raw_data = reinterpret_cast<int8_t *>(_im2col_data.data());
+      optimized::ConvPerChannel(params, output_multiplier, output_shift, input_shape, input_data,
+                                filter_shape, filter_data, bias_shape, bias_data, output_shape,
+                                output_data, _im2col_shape, im2col_raw_data);
+    }
+    else
+    {
+      reference::ConvPerChannel(params, output_multiplier, output_shift, input_shape, input_data,
+                                filter_shape, filter_data, bias_shape, bias_data, output_shape,
+                                output_data);
+    }
+  }
+
 private:
-  std::vector<float> _modified_filter_data;
+  std::shared_ptr<const std::vector<float>> _modified_filter_data;
   std::vector<uint8_t> _im2col_data;
   Shape _im2col_shape;
   bool _need_im2col;
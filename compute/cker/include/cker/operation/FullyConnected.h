@@ -22,6 +22,17 @@
 #include "cker/Types.h"
 #include "cker/Utils.h"
 #include "cker/TensorUtils.h"
+#include "cker/Fp16TensorUtils.h"
+#include "cker/operation/reference/FullyConnected.h"
+#include "cker/operation/optimized/ConvInt8.h"
+#ifdef USE_RUY_GEMV
+#include "cker/ruy/RuySupport.h"
+
+#include <ruy/ruy.h>
+#else
+#include "cker/gemmlowp/GEMMSupport.h"
+#include "cker/operation/optimized/Conv.h"
+#endif
 
 namespace nnfw
 {
@@ -82,6 +93,35 @@ inline void FullyConnected(const FullyConnectedParams &params, const Shape &inpu
   ApplyActivationToVector(output_data, batch_size * num_units, params.activation, output_data);
 }
 
+// float with weights stored as fp16, which are converted to float while being multiplied
+inline void FullyConnected(const FullyConnectedParams &params, const Shape &input_shape,
+                           const float *input_data, const Shape &weights_shape,
+                           const uint16_t *weights_data, const Shape &, const float *bias_data,
+                           const Shape &, float *output_data)
+{
+  int total_input_size = input_shape.FlatSize();
+  int input_size = weights_shape.Dims(1);
+  const int batch_size = total_input_size / input_size;
+  const int num_units = weights_shape.Dims(0);
+
+  // Output = bias if bias tensor exists.
+  if (bias_data)
+  {
+    VectorBatchVectorAssign(bias_data, num_units, batch_size, output_data);
+  }
+  else
+  {
+    ZeroVector(output_data, batch_size * num_units);
+  }
+
+  // Compute output += weight * input
+  Fp16MatrixBatchVectorMultiplyAccumulate(weights_data, num_units, input_size, input_data,
+                                          batch_size, output_data);
+
+  // Apply activation function
+  ApplyActivationToVector(output_data, batch_size * num_units, params.activation, output_data);
+}
+
 inline void FullyConnected(const FullyConnectedParams &params, const Shape &input_shape,
                            const uint8_t *input_data, const Shape &filter_shape,
                            const uint8_t *filter_data, const Shape &bias_shape,
@@ -99,41 +139,115 @@ inline void FullyConnected(const FullyConnectedParams &params, const Shape &inpu
   const int32_t output_activation_max = params.quantized_activation_max;
   assert(filter_shape.DimensionsCount() >= 2);
   assert(output_shape.DimensionsCount() >= 1);
-
   assert(output_activation_min <= output_activation_max);
-  // TODO(benoitjacob): This really should be:
-  //     const int batches = ArraySize(output_dims, 1);
-  // but the current --variable_batch hack consists in overwriting the 3rd
-  // dimension with the runtime batch size, as we don't keep track for each
-  // array of which dimension is the batch dimension in it.
+
   const int output_dim_count = output_shape.DimensionsCount();
   const int filter_dim_count = filter_shape.DimensionsCount();
   const int batches = FlatSizeSkipDim(output_shape, output_dim_count - 1);
   const int output_depth =
       MatchingDim(filter_shape, filter_dim_count - 2, output_shape, output_dim_count - 1);
   const int accum_depth = filter_shape.Dims(filter_dim_count - 1);
-  for (int b = 0; b < batches; ++b)
+
+  // output(output_depth x batches) = filter(output_depth x accum_depth) * input(accum_depth x
+  // batches), with the zero points, bias, requantization and clamp handled by the GEMM
+#ifdef USE_RUY_GEMV
+  MatrixParams<uint8_t> lhs_params;
+  lhs_params.order = Order::kRowMajor;
+  lhs_params.rows = output_depth;
+  lhs_params.cols = accum_depth;
+  lhs_params.zero_point = static_cast<uint8_t>(-filter_offset);
+  lhs_params.cacheable = params.lhs_cacheable;
+
+  MatrixParams<uint8_t> rhs_params;
+  rhs_params.order = Order::kColMajor;
+  rhs_params.rows = accum_depth;
+  rhs_params.cols = batches;
+  rhs_params.zero_point = static_cast<uint8_t>(-input_offset);
+
+  MatrixParams<uint8_t> dst_params;
+  dst_params.order = Order::kColMajor;
+  dst_params.rows = output_depth;
+  dst_params.cols = batches;
+  dst_params.zero_point = static_cast<uint8_t>(output_offset);
+
+  GemmParams<int32_t, uint8_t> gemm_params;
+  gemm_params.bias = bias_data;
+  gemm_params.clamp_min = static_cast<uint8_t>(output_activation_min);
+  gemm_params.clamp_max = static_cast<uint8_t>(output_activation_max);
+  gemm_params.multiplier_fixedpoint = output_multiplier;
+  gemm_params.multiplier_exponent = output_shift;
+
+  ruy::Context *ruy_context = ruy_support::GetRuyContext();
+
+  ruy::Matrix<uint8_t> ruy_lhs;
+  ruy::Matrix<uint8_t> ruy_rhs;
+  ruy::Matrix<uint8_t> ruy_dst;
+  ruy_support::MakeRuyMatrix(lhs_params, filter_data, &ruy_lhs);
+  ruy_support::MakeRuyMatrix(rhs_params, input_data, &ruy_rhs);
+  ruy_support::MakeRuyMatrix(dst_params, output_data, &ruy_dst);
+
+  ruy::BasicSpec<int32_t, uint8_t> ruy_spec;
+  ruy_support::MakeRuySpec(gemm_params, &ruy_spec);
+
+  constexpr ruy::Path kRuyPath = ruy::kAllPaths;
+  ruy::Mul<kRuyPath>(ruy_lhs, ruy_rhs, ruy_spec, ruy_context, &ruy_dst);
+#else
+  gemmlowp::GemmContext *gemm_context = gemm_support::GetGemmLowpContext();
+
+  gemmlowp::MatrixMap<const uint8_t, gemmlowp::MapOrder::RowMajor> filter_matrix(
+      filter_data, output_depth, accum_depth);
+  gemmlowp::MatrixMap<const uint8_t, gemmlowp::MapOrder::ColMajor> input_matrix(
+      input_data, accum_depth, batches);
+  gemmlowp::MatrixMap<uint8_t, gemmlowp::MapOrder::ColMajor> output_matrix(
+      output_data, output_depth, batches);
+  if (bias_data)
   {
-    for (int out_c = 0; out_c < output_depth; ++out_c)
-    {
-      int32_t acc = 0;
-      for (int d = 0; d < accum_depth; ++d)
-      {
-        int32_t input_val = input_data[b * accum_depth + d];
-        int32_t filter_val = filter_data[out_c * accum_depth + d];
-        acc += (filter_val + filter_offset) * (input_val + input_offset);
-      }
-      if (bias_data)
-      {
-        acc += bias_data[out_c];
-      }
-      acc = MultiplyByQuantizedMultiplier(acc, output_multiplier, output_shift);
-      acc += output_offset;
-      acc = std::max(acc, output_activation_min);
-      acc = std::min(acc, output_activation_max);
-      output_data[out_c + output_depth * b] = static_cast<uint8_t>(acc);
-    }
+    const auto &output_pipeline = optimized::GemmlowpOutputPipeline::MakeExp(
+        bias_data, output_depth, output_offset, output_multiplier, output_shift,
+        output_activation_min, output_activation_max);
+    gemmlowp::GemmWithOutputPipeline<uint8_t, uint8_t, gemmlowp::DefaultL8R8BitDepthParams>(
+        gemm_context, filter_matrix, input_matrix, &output_matrix, filter_offset, input_offset,
+        output_pipeline);
   }
+  else
+  {
+    const auto &output_pipeline = optimized::GemmlowpOutputPipeline::MakeExpWithoutBias(
+        output_offset, output_multiplier, output_shift, output_activation_min,
+        output_activation_max);
+    gemmlowp::GemmWithOutputPipeline<uint8_t, uint8_t, gemmlowp::DefaultL8R8BitDepthParams>(
+        gemm_context, filter_matrix, input_matrix, &output_matrix, filter_offset, input_offset,
+        output_pipeline);
+  }
+#endif
+}
+
+// int8 with symmetric filter, requantized with the multiplier of each output channel
+inline void FullyConnectedPerChannel(const FullyConnectedParams &params,
+                                     const int32_t *output_multiplier, const int *output_shift,
+                                     const Shape &input_shape, const int8_t *input_data,
+                                     const Shape &filter_shape, const int8_t *filter_data,
+                                     const Shape &bias_shape, const int32_t *bias_data,
+                                     const Shape &output_shape, int8_t *output_data)
+{
+  UNUSED_RELEASE(input_shape);
+  UNUSED_RELEASE(bias_shape);
+  assert(filter_shape.DimensionsCount() >= 2);
+  assert(output_shape.DimensionsCount() >= 1);
+  assert(params.quantized_activation_min <= params.quantized_activation_max);
+
+  const int output_dim_count = output_shape.DimensionsCount();
+  const int filter_dim_count = filter_shape.DimensionsCount();
+  const int batches = FlatSizeSkipDim(output_shape, output_dim_count - 1);
+  const int output_depth =
+      MatchingDim(filter_shape, filter_dim_count - 2, output_shape, output_dim_count - 1);
+  const int accum_depth = filter_shape.Dims(filter_dim_count - 1);
+
+  // output(output_depth x batches) = filter(output_depth x accum_depth) * input(accum_depth x
+  // batches)
+  optimized::GemmPerChannel(output_multiplier, output_shift, params.input_offset,
+                            params.output_offset, params.quantized_activation_min,
+                            params.quantized_activation_max, output_depth, accum_depth, batches,
+                            filter_data, params.lhs_cacheable, input_data, bias_data, output_data);
 }
 
 inline void FullyConnectedHybrid(const FullyConnectedParams &params, const Shape &input_shape,
@@ -0,0 +1,392 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_LSTM_H__
+#define __NNFW_CKER_LSTM_H__
+
+#include "cker/Types.h"
+#include "cker/TensorUtils.h"
+#include "cker/operation/optimized/Recurrent.h"
+
+#include <cstring>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+enum LSTMGate
+{
+  kLSTMInputGate = 0,
+  kLSTMForgetGate = 1,
+  kLSTMCellGate = 2,
+  kLSTMOutputGate = 3,
+  kLSTMNumGates = 4,
+};
+
+/**
+ * Weights of LSTM, which are float or int8 of hybrid LSTM, indexed by LSTMGate
+ *
+ * Optional ones are nullptr if they do not exist. Input gate weights and bias are nullptr with
+ * CIFG (coupled input and forget gate), and peephole weights of cell gate are always nullptr.
+ * Scales are used only for int8 weights.
+ */
+template <typename T> struct LSTMWeights
+{
+  const T *input_to_gate[kLSTMNumGates];
+  const T *recurrent_to_gate[kLSTMNumGates];
+  const T *cell_to_gate[kLSTMNumGates];
+  const float *gate_bias[kLSTMNumGates];
+  const T *projection;
+  const float *projection_bias;
+  float input_to_gate_scale[kLSTMNumGates];
+  float recurrent_to_gate_scale[kLSTMNumGates];
+  float cell_to_gate_scale[kLSTMNumGates];
+  float projection_scale;
+};
+
+/**
+ * One step of LSTM, which computes all gates of all batches by one GEMM
+ *
+ * Weights of gates are concatenated, and those of float LSTM are also concatenated with recurrent
+ * weights to be multiplied with [input, output_state_in] of each batch. The concatenated weights
+ * are made on every run, unless prepare() is called for constant weights.
+ *
+ * States are updated in place, that is, output_state_in and cell_state_in may be the same
+ * buffers as output_state_out and cell_state_out respectively. The scratch buffer, which is
+ * [n_batch, n_cell * 4] or [n_batch, n_cell * 3] with CIFG, keeps the gates.
+ */
+class LSTM
+{
+public:
+  LSTM() : _use_cifg(false), _n_cell(0), _prepared(false) {}
+
+  void prepare(const LSTMWeights<float> &weights, int n_input, int n_cell, int n_output)
+  {
+    fuseWeights(weights, n_input, n_cell, n_output);
+    _prepared = true;
+  }
+
+  void prepare(const LSTMWeights<int8_t> &weights, int n_input, int n_cell, int n_output)
+  {
+    fuseWeights(weights, n_input, n_cell, n_output);
+    _prepared = true;
+  }
+
+  void operator()(const LSTMParams &params, const LSTMWeights<float> &weights, int n_batch,
+                  int n_input, int n_cell, int n_output, const float *input_data,
+                  const float *output_state_in, const float *cell_state_in, float *scratch_buffer,
+                  float *output_state_out, float *cell_state_out, float *output_data)
+  {
+    if (!_prepared)
+    {
+      fuseWeights(weights, n_input, n_cell, n_output);
+    }
+
+    const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
+    const int depth = n_input + n_output;
+    _concat.resize(n_batch * depth);
+    optimized::ConcatRecurrentInput(input_data, n_input, output_state_in, n_output, n_batch,
+                                    _concat.data());
+    optimized::RecurrentGemm(device, _concat.data(), n_batch, depth, _weights.data(), numRows(),
+                             _bias.data(), scratch_buffer);
+
+    const float *peephole[kLSTMNumGates];
+    for (int gate = 0; gate < kLSTMNumGates; ++gate)
+    {
+      peephole[gate] = weights.cell_to_gate[gate];
+    }
+    float *hidden = weights.projection ? hiddenBuffer(n_batch, n_cell) : output_state_out;
+    updateCell(params, peephole, n_batch, n_cell, cell_state_in, scratch_buffer, cell_state_out,
+               hidden);
+
+    if (weights.projection)
+    {
+      optimized::RecurrentGemm(device, hidden, n_batch, n_cell, weights.projection, n_output,
+                               weights.projection_bias, output_state_out);
+      optimized::ClipVector(output_state_out, n_batch * n_output, params.proj_clip);
+    }
+    copyOutput(output_state_out, n_batch * n_output, output_data);
+  }
+
+  void operator()(const LSTMParams &params, const LSTMWeights<int8_t> &weights, int n_batch,
+                  int n_input, int n_cell, int n_output, const float *input_data,
+                  const float *output_state_in, const float *cell_state_in, float *scratch_buffer,
+                  float *output_state_out, float *cell_state_out, float *output_data)
+  {
+    if (!_prepared)
+    {
+      fuseWeights(weights, n_input, n_cell, n_output);
+    }
+
+    // Gates = bias + input_to_gate * input + recurrent_to_gate * output_state_in
+    const int n_gates = numGates();
+    for (int b = 0; b < n_batch; ++b)
+    {
+      std::memcpy(scratch_buffer + b * numRows(), _bias.data(), numRows() * sizeof(float));
+    }
+    _scales.resize(n_batch);
+    _quantized.resize(n_batch * std::max(n_input, std::max(n_cell, n_output)));
+    if (optimized::QuantizeRecurrentInput(input_data, n_batch, n_input, _quantized.data(),
+                                          _scales.data()))
+    {
+      optimized::HybridGateMatMulAccumulate(_input_weights_quant.data(), _input_scales, n_gates,
+                                            n_cell, n_input, _quantized.data(), _scales.data(),
+                                            n_batch, _temp_arena, scratch_buffer);
+    }
+    if (optimized::QuantizeRecurrentInput(output_state_in, n_batch, n_output, _quantized.data(),
+                                          _scales.data()))
+    {
+      optimized::HybridGateMatMulAccumulate(_recurrent_weights_quant.data(), _recurrent_scales,
+                                            n_gates, n_cell, n_output, _quantized.data(),
+                                            _scales.data(), n_batch, _temp_arena,
+                                            scratch_buffer);
+    }
+
+    const float *peephole[kLSTMNumGates] = {nullptr, nullptr, nullptr, nullptr};
+    for (int gate = 0; gate < kLSTMNumGates; ++gate)
+    {
+      if (weights.cell_to_gate[gate])
+      {
+        peephole[gate] = _peephole.data() + gate * n_cell;
+      }
+    }
+    float *hidden = weights.projection ? hiddenBuffer(n_batch, n_cell) : output_state_out;
+    updateCell(params, peephole, n_batch, n_cell, cell_state_in, scratch_buffer, cell_state_out,
+               hidden);
+
+    if (weights.projection)
+    {
+      for (int b = 0; b < n_batch; ++b)
+      {
+        if (weights.projection_bias)
+        {
+          std::memcpy(output_state_out + b * n_output, weights.projection_bias,
+                      n_output * sizeof(float));
+        }
+        else
+        {
+          ZeroVector(output_state_out + b * n_output, n_output);
+        }
+      }
+      if (optimized::QuantizeRecurrentInput(hidden, n_batch, n_cell, _quantized.data(),
+                                            _scales.data()))
+      {
+        optimized::HybridGateMatMulAccumulate(weights.projection, &weights.projection_scale, 1,
+                                              n_output, n_cell, _quantized.data(),
+                                              _scales.data(), n_batch, _temp_arena,
+                                              output_state_out);
+      }
+      optimized::ClipVector(output_state_out, n_batch * n_output, params.proj_clip);
+    }
+    copyOutput(output_state_out, n_batch * n_output, output_data);
+  }
+
+private:
+  int numGates() const { return _use_cifg ? kLSTMNumGates - 1 : kLSTMNumGates; }
+  int numRows() const { return numGates() * _n_cell; }
+
+  // Gates which exist in concatenated weights, in the order of LSTMGate
+  template <typename T> int presentGates(const T *const *gate_weights, const T **present)
+  {
+    int n_gates = 0;
+    for (int gate = 0; gate < kLSTMNumGates; ++gate)
+    {
+      if (gate != kLSTMInputGate || !_use_cifg)
+      {
+        present[n_gates++] = gate_weights[gate];
+      }
+    }
+    return n_gates;
+  }
+
+  template <typename T> void fuseCommon(const LSTMWeights<T> &weights, int n_cell)
+  {
+    _use_cifg = (weights.input_to_gate[kLSTMInputGate] == nullptr);
+    _n_cell = n_cell;
+    _bias.assign(numRows(), 0.f);
+    int row = 0;
+    for (int gate = 0; gate < kLSTMNumGates; ++gate)
+    {
+      if (gate == kLSTMInputGate && _use_cifg)
+      {
+        continue;
+      }
+      if (weights.gate_bias[gate])
+      {
+        std::memcpy(_bias.data() + row, weights.gate_bias[gate], n_cell * sizeof(float));
+      }
+      row += n_cell;
+    }
+  }
+
+  void fuseWeights(const LSTMWeights<float> &weights, int n_input, int n_cell, int n_output)
+  {
+    fuseCommon(weights, n_cell);
+    const int depth = n_input + n_output;
+    const float *present[kLSTMNumGates];
+    const int n_gates = presentGates(weights.input_to_gate, present);
+    _weights.resize(numRows() * depth);
+    optimized::ConcatGateWeights(present, n_gates, n_cell, n_input, depth, _weights.data());
+    presentGates(weights.recurrent_to_gate, present);
+    optimized::ConcatGateWeights(present, n_gates, n_cell, n_output, depth,
+                                 _weights.data() + n_input);
+  }
+
+  void fuseWeights(const LSTMWeights<int8_t> &weights, int n_input, int n_cell, int n_output)
+  {
+    fuseCommon(weights, n_cell);
+    const int8_t *present[kLSTMNumGates];
+    const int n_gates = presentGates(weights.input_to_gate, present);
+    _input_weights_quant.resize(numRows() * n_input);
+    optimized::ConcatGateWeights(present, n_gates, n_cell, n_input, n_input,
+                                 _input_weights_quant.data());
+    presentGates(weights.recurrent_to_gate, present);
+    _recurrent_weights_quant.resize(numRows() * n_output);
+    optimized::ConcatGateWeights(present, n_gates, n_cell, n_output, n_output,
+                                 _recurrent_weights_quant.data());
+
+    int n_scales = 0;
+    for (int gate = 0; gate < kLSTMNumGates; ++gate)
+    {
+      if (gate != kLSTMInputGate || !_use_cifg)
+      {
+        _input_scales[n_scales] = weights.input_to_gate_scale[gate];
+        _recurrent_scales[n_scales] = weights.recurrent_to_gate_scale[gate];
+        ++n_scales;
+      }
+    }
+
+    // Peephole weights are applied elementwise, so they are just dequantized
+    _peephole.assign(kLSTMNumGates * n_cell, 0.f);
+    for (int gate = 0; gate < kLSTMNumGates; ++gate)
+    {
+      const int8_t *cell_to_gate = weights.cell_to_gate[gate];
+      if (cell_to_gate)
+      {
+        for (int i = 0; i < n_cell; ++i)
+        {
+          _peephole[gate * n_cell + i] = cell_to_gate[i] * weights.cell_to_gate_scale[gate];
+        }
+      }
+    }
+  }
+
+  float *hiddenBuffer(int n_batch, int n_cell)
+  {
+    _hidden.resize(n_batch * n_cell);
+    return _hidden.data();
+  }
+
+  // Activates gates, which are computed in scratch_buffer, and updates cell state. Then computes
+  // hidden state before projection.
+  void updateCell(const LSTMParams &params, const float *const *peephole, int n_batch,
+                  int n_cell, const float *cell_state_in, float *scratch_buffer,
+                  float *cell_state_out, float *hidden)
+  {
+    for (int b = 0; b < n_batch; ++b)
+    {
+      float *gates = scratch_buffer + b * numRows();
+      float *input_gate = _use_cifg ? nullptr : gates;
+      float *forget_gate = gates + (_use_cifg ? 0 : n_cell);
+      float *cell_gate = forget_gate + n_cell;
+      float *output_gate = cell_gate + n_cell;
+      const float *c_prev = cell_state_in + b * n_cell;
+      float *c = cell_state_out + b * n_cell;
+      float *h = hidden + b * n_cell;
+
+      if (peephole[kLSTMForgetGate])
+      {
+        for (int i = 0; i < n_cell; ++i)
+        {
+          forget_gate[i] += peephole[kLSTMForgetGate][i] * c_prev[i];
+        }
+      }
+      optimized::ApplyRecurrentActivation(FusedActivationFunctionType::kSigmoid, forget_gate,
+                                          n_cell);
+      if (!_use_cifg)
+      {
+        if (peephole[kLSTMInputGate])
+        {
+          for (int i = 0; i < n_cell; ++i)
+          {
+            input_gate[i] += peephole[kLSTMInputGate][i] * c_prev[i];
+          }
+        }
+        optimized::ApplyRecurrentActivation(FusedActivationFunctionType::kSigmoid, input_gate,
+                                            n_cell);
+      }
+      optimized::ApplyRecurrentActivation(params.activation, cell_gate, n_cell);
+
+      // c_prev may be the same as c, but each element is read before it is written
+      for (int i = 0; i < n_cell; ++i)
+      {
+        const float input_weight = _use_cifg ? 1.f - forget_gate[i] : input_gate[i];
+        c[i] = forget_gate[i] * c_prev[i] + input_weight * cell_gate[i];
+      }
+      optimized::ClipVector(c, n_cell, params.cell_clip);
+
+      if (peephole[kLSTMOutputGate])
+      {
+        for (int i = 0; i < n_cell; ++i)
+        {
+          output_gate[i] += peephole[kLSTMOutputGate][i] * c[i];
+        }
+      }
+      optimized::ApplyRecurrentActivation(FusedActivationFunctionType::kSigmoid, output_gate,
+                                          n_cell);
+
+      // Cell gate is no longer needed, so it keeps activated cell state
+      std::memcpy(cell_gate, c, n_cell * sizeof(float));
+      optimized::ApplyRecurrentActivation(params.activation, cell_gate, n_cell);
+      for (int i = 0; i < n_cell; ++i)
+      {
+        h[i] = output_gate[i] * cell_gate[i];
+      }
+    }
+  }
+
+  static void copyOutput(const float *output_state, int size, float *output_data)
+  {
+    if (output_data != output_state)
+    {
+      std::memcpy(output_data, output_state, size * sizeof(float));
+    }
+  }
+
+private:
+  bool _use_cifg;
+  int _n_cell;
+  std::vector<float> _bias;
+  std::vector<float> _weights;
+  std::vector<int8_t> _input_weights_quant;
+  std::vector<int8_t> _recurrent_weights_quant;
+  float _input_scales[kLSTMNumGates];
+  float _recurrent_scales[kLSTMNumGates];
+  std::vector<float> _peephole;
+  std::vector<float> _concat;
+  std::vector<float> _hidden;
+  std::vector<int8_t> _quantized;
+  std::vector<float> _scales;
+  optimized::HybridGateTempArena _temp_arena;
+  bool _prepared;
+};
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_LSTM_H__
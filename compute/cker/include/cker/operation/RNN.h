@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_RNN_H__
+#define __NNFW_CKER_RNN_H__
+
+#include "cker/Types.h"
+#include "cker/TensorUtils.h"
+#include "cker/operation/optimized/Recurrent.h"
+
+#include <cstring>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * One step of basic RNN, which computes
+ *   hidden_state_out = activation(weights * input + recurrent_weights * hidden_state_in + bias)
+ *
+ * Float weights are concatenated with recurrent weights so that the step is one GEMM with
+ * [input, hidden_state_in] of each batch. The concatenated weights are made on every run, unless
+ * prepare() is called for constant weights. Int8 weights of hybrid RNN are used as they are.
+ *
+ * hidden_state_in may be the same buffer as hidden_state_out.
+ */
+class RNN
+{
+public:
+  RNN() : _prepared(false) {}
+
+  void prepare(const float *weights_data, const float *recurrent_weights_data, int n_input,
+               int n_unit)
+  {
+    fuseWeights(weights_data, recurrent_weights_data, n_input, n_unit);
+    _prepared = true;
+  }
+
+  void operator()(const RNNParams &params, int n_batch, int n_input, int n_unit,
+                  const float *input_data, const float *weights_data,
+                  const float *recurrent_weights_data, const float *bias_data,
+                  const float *hidden_state_in, float *hidden_state_out, float *output_data)
+  {
+    if (!_prepared)
+    {
+      fuseWeights(weights_data, recurrent_weights_data, n_input, n_unit);
+    }
+
+    const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
+    const int depth = n_input + n_unit;
+    _concat.resize(n_batch * depth);
+    optimized::ConcatRecurrentInput(input_data, n_input, hidden_state_in, n_unit, n_batch,
+                                    _concat.data());
+    optimized::RecurrentGemm(device, _concat.data(), n_batch, depth, _weights.data(), n_unit,
+                             bias_data, hidden_state_out);
+    finish(params, n_batch * n_unit, hidden_state_out, output_data);
+  }
+
+  void operator()(const RNNParams &params, int n_batch, int n_input, int n_unit,
+                  const float *input_data, const int8_t *weights_data, float weights_scale,
+                  const int8_t *recurrent_weights_data, float recurrent_weights_scale,
+                  const float *bias_data, const float *hidden_state_in, float *hidden_state_out,
+                  float *output_data)
+  {
+    // Quantize both sources before hidden_state_out, which may be hidden_state_in, is written
+    _quantized.resize(n_batch * (n_input + n_unit));
+    _scales.resize(n_batch * 2);
+    int8_t *quantized_input = _quantized.data();
+    int8_t *quantized_state = _quantized.data() + n_batch * n_input;
+    float *input_scales = _scales.data();
+    float *state_scales = _scales.data() + n_batch;
+    const bool has_input = optimized::QuantizeRecurrentInput(input_data, n_batch, n_input,
+                                                             quantized_input, input_scales);
+    const bool has_state = optimized::QuantizeRecurrentInput(hidden_state_in, n_batch, n_unit,
+                                                             quantized_state, state_scales);
+
+    for (int b = 0; b < n_batch; ++b)
+    {
+      if (bias_data)
+      {
+        std::memcpy(hidden_state_out + b * n_unit, bias_data, n_unit * sizeof(float));
+      }
+      else
+      {
+        ZeroVector(hidden_state_out + b * n_unit, n_unit);
+      }
+    }
+    if (has_input)
+    {
+      optimized::HybridGateMatMulAccumulate(weights_data, &weights_scale, 1, n_unit, n_input,
+                                            quantized_input, input_scales, n_batch, _temp_arena,
+                                            hidden_state_out);
+    }
+    if (has_state)
+    {
+      optimized::HybridGateMatMulAccumulate(recurrent_weights_data, &recurrent_weights_scale, 1,
+                                            n_unit, n_unit, quantized_state, state_scales,
+                                            n_batch, _temp_arena, hidden_state_out);
+    }
+    finish(params, n_batch * n_unit, hidden_state_out, output_data);
+  }
+
+private:
+  void fuseWeights(const float *weights_data, const float *recurrent_weights_data, int n_input,
+                   int n_unit)
+  {
+    const int depth = n_input + n_unit;
+    _weights.resize(n_unit * depth);
+    optimized::ConcatGateWeights(&weights_data, 1, n_unit, n_input, depth, _weights.data());
+    optimized::ConcatGateWeights(&recurrent_weights_data, 1, n_unit, n_unit, depth,
+                                 _weights.data() + n_input);
+  }
+
+  static void finish(const RNNParams &params, int size, float *hidden_state_out,
+                     float *output_data)
+  {
+    optimized::ApplyRecurrentActivation(params.activation, hidden_state_out, size);
+    if (output_data != hidden_state_out)
+    {
+      std::memcpy(output_data, hidden_state_out, size * sizeof(float));
+    }
+  }
+
+private:
+  std::vector<float> _weights;
+  std::vector<float> _concat;
+  std::vector<int8_t> _quantized;
+  std::vector<float> _scales;
+  optimized::HybridGateTempArena _temp_arena;
+  bool _prepared;
+};
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_RNN_H__
@@ -21,89 +21,136 @@
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
+#include "cker/operation/reference/TransposeConv.h"
+#include "cker/operation/optimized/TransposeConv.h"
+
+#include <vector>
 
 namespace nnfw
 {
 namespace cker
 {
 
-inline void TransposeConv(const TransposeConvParams &params, const Shape &input_shape,
-                          const float *input_data, const Shape &filter_shape,
-                          const float *filter_data, const Shape &output_shape, float *output_data)
+/**
+ * TransposeConv as GEMM of input and filter followed by col2im, which are multithreaded
+ *
+ * The filter is reordered for GEMM on every run, unless prepare() is called for a constant filter.
+ */
+class TransposeConv
 {
+public:
+  TransposeConv() : _prepared(false) {}
+
+  void prepare(const Shape &filter_shape, const float *filter_data)
+  {
+    _filter.resize(filter_shape.FlatSize());
+    optimized::TransposeConvReorderFilter(filter_shape, filter_data, 0.f, _filter.data());
+    _prepared = true;
+  }
 
-  const int stride_width = params.stride_width;
-  const int stride_height = params.stride_height;
-  const int pad_width = params.padding_values.width;
-  const int pad_height = params.padding_values.height;
-
-  assert(input_shape.DimensionsCount() == 4);
-  assert(filter_shape.DimensionsCount() == 4);
-  assert(output_shape.DimensionsCount() == 4);
-
-  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
-  const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
-  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
-  const int input_height = input_shape.Dims(1);
-  const int input_width = input_shape.Dims(2);
-  const int filter_height = filter_shape.Dims(1);
-  const int filter_width = filter_shape.Dims(2);
-  const int output_height = output_shape.Dims(1);
-  const int output_width = output_shape.Dims(2);
-
-  // Although transpose convolution simplifies to convolution with transposed
-  // weights for strides of 1, non-unitary striding complicates matters. To
-  // keep this reference implementation as clear as possible, we use a
-  // "scatter" access pattern, where we loop through all the input elements,
-  // computing their influence on the output, rather than looping through the
-  // output elements in the typical "gather" access pattern of a conv. We
-  // therefore must initialize the output array to zero.
-  const int num_elements = output_shape.FlatSize();
-  for (int i = 0; i < num_elements; i++)
+  void prepareQuant(const Shape &filter_shape, const uint8_t *filter_data, int32_t weights_offset)
   {
-    output_data[i] = 0.0f;
+    _filter_quant.resize(filter_shape.FlatSize());
+    optimized::TransposeConvReorderFilter(filter_shape, filter_data, weights_offset,
+                                          _filter_quant.data());
+    _prepared = true;
+  }
+
+  void operator()(const TransposeConvParams &params, const Shape &input_shape,
+                  const float *input_data, const Shape &filter_shape, const float *filter_data,
+                  const Shape &output_shape, float *output_data)
+  {
+    if (!_prepared)
+    {
+      _filter.resize(filter_shape.FlatSize());
+      optimized::TransposeConvReorderFilter(filter_shape, filter_data, 0.f, _filter.data());
+    }
+
+    const int num_input_pixels = input_shape.FlatSize() / input_shape.Dims(3);
+    const int filter_height = filter_shape.Dims(1);
+    const int filter_width = filter_shape.Dims(2);
+    const int num_filter_rows = filter_shape.FlatSize() / filter_shape.Dims(3);
+    const int output_row_size = output_shape.Dims(2) * output_shape.Dims(3);
+    assert(MatchingDim(input_shape, 3, filter_shape, 3) > 0);
+    assert(MatchingDim(filter_shape, 0, output_shape, 3) > 0);
+    assert(MatchingDim(input_shape, 0, output_shape, 0) > 0);
+
+    const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
+
+    _col.resize(static_cast<size_t>(num_input_pixels) * num_filter_rows);
+    optimized::TransposeConvGemm(device, input_data, num_input_pixels, input_shape.Dims(3),
+                                 _filter.data(), num_filter_rows, _col.data());
+
+    optimized::TransposeConvForEachRow(
+        device, params, filter_height, filter_width, output_shape, sizeof(float), [&](int row) {
+          optimized::TransposeConvCol2ImRow(params, input_shape, filter_height, filter_width,
+                                            output_shape, _col.data(), row,
+                                            output_data + row * output_row_size);
+        });
   }
 
-  // Loop through input elements one at a time.
-  for (int batch = 0; batch < batches; ++batch)
+  void operator()(const TransposeConvParams &params, const Shape &input_shape,
+                  const uint8_t *input_data, const Shape &filter_shape, const uint8_t *filter_data,
+                  const Shape &output_shape, uint8_t *output_data)
   {
-    for (int in_y = 0; in_y < input_height; ++in_y)
+    if (!_prepared)
+    {
+      _filter_quant.resize(filter_shape.FlatSize());
+      optimized::TransposeConvReorderFilter(filter_shape, filter_data, params.weights_offset,
+                                            _filter_quant.data());
+    }
+
+    const int num_input_pixels = input_shape.FlatSize() / input_shape.Dims(3);
+    const int filter_height = filter_shape.Dims(1);
+    const int filter_width = filter_shape.Dims(2);
+    const int num_filter_rows = filter_shape.FlatSize() / filter_shape.Dims(3);
+    const int output_row_size = output_shape.Dims(2) * output_shape.Dims(3);
+    assert(MatchingDim(input_shape, 3, filter_shape, 3) > 0);
+    assert(MatchingDim(filter_shape, 0, output_shape, 3) > 0);
+    assert(MatchingDim(input_shape, 0, output_shape, 0) > 0);
+
+    const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
+
+    // GEMM in int32 with offsets applied, which does not overflow for uint8 values unless
+    // input_depth * filter_height * filter_width exceeds 2^15
+    _input_quant.resize(input_shape.FlatSize());
+    for (size_t i = 0; i < _input_quant.size(); ++i)
     {
-      for (int in_x = 0; in_x < input_width; ++in_x)
-      {
-        for (int in_channel = 0; in_channel < input_depth; ++in_channel)
-        {
-          // Loop through the output elements it will influence
-          const int out_x_origin = (in_x * stride_width) - pad_width;
-          const int out_y_origin = (in_y * stride_height) - pad_height;
-          for (int filter_y = 0; filter_y < filter_height; ++filter_y)
+      _input_quant[i] = static_cast<int32_t>(input_data[i]) + params.input_offset;
+    }
+    _col_quant.resize(static_cast<size_t>(num_input_pixels) * num_filter_rows);
+    optimized::TransposeConvGemm(device, _input_quant.data(), num_input_pixels,
+                                 input_shape.Dims(3), _filter_quant.data(), num_filter_rows,
+                                 _col_quant.data());
+
+    _acc_quant.resize(output_shape.FlatSize());
+    optimized::TransposeConvForEachRow(
+        device, params, filter_height, filter_width, output_shape, sizeof(int32_t), [&](int row) {
+          int32_t *acc_row = _acc_quant.data() + row * output_row_size;
+          optimized::TransposeConvCol2ImRow(params, input_shape, filter_height, filter_width,
+                                            output_shape, _col_quant.data(), row, acc_row);
+          uint8_t *output_row = output_data + row * output_row_size;
+          for (int i = 0; i < output_row_size; ++i)
           {
-            for (int filter_x = 0; filter_x < filter_width; ++filter_x)
-            {
-              for (int out_channel = 0; out_channel < output_depth; ++out_channel)
-              {
-                // Compute output element location
-                const int out_x = out_x_origin + filter_x;
-                const int out_y = out_y_origin + filter_y;
-                // We cannot accumulate out of bounds
-                if ((out_x >= 0) && (out_x < output_width) && (out_y >= 0) &&
-                    (out_y < output_height))
-                {
-                  float input_value =
-                      input_data[Offset(input_shape, batch, in_y, in_x, in_channel)];
-                  float filter_value = filter_data[Offset(filter_shape, out_channel, filter_y,
-                                                          filter_x, in_channel)];
-                  output_data[Offset(output_shape, batch, out_y, out_x, out_channel)] +=
-                      input_value * filter_value;
-                }
-              }
-            }
+            int32_t acc = MultiplyByQuantizedMultiplier(acc_row[i], params.output_multiplier,
+                                                        params.output_shift);
+            acc += params.output_offset;
+            acc = std::max(acc, params.quantized_activation_min);
+            acc = std::min(acc, params.quantized_activation_max);
+            output_row[i] = static_cast<uint8_t>(acc);
           }
-        }
-      }
-    }
+        });
   }
-}
+
+private:
+  std::vector<float> _filter;
+  std::vector<int32_t> _filter_quant;
+  std::vector<float> _col;
+  std::vector<int32_t> _input_quant;
+  std::vector<int32_t> _col_quant;
+  std::vector<int32_t> _acc_quant;
+  bool _prepared;
+};
 
 } // namespace cker
 } // namespace nnfw
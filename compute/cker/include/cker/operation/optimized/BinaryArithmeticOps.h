@@ -468,6 +468,345 @@ inline void BroadcastMulDispatch(const BinaryArithmeticOpParam &params, const Sh
                        output_data);
 }
 
+// Parameters of quantized operations with input1 and input2 swapped, for the broadcast where the
+// second input broadcasts fast
+inline BinaryArithmeticOpParam SwitchInputParams(const BinaryArithmeticOpParam &params)
+{
+  BinaryArithmeticOpParam switched_params = params;
+  switched_params.input1_offset = params.input2_offset;
+  switched_params.input1_multiplier = params.input2_multiplier;
+  switched_params.input1_shift = params.input2_shift;
+  switched_params.input2_offset = params.input1_offset;
+  switched_params.input2_multiplier = params.input1_multiplier;
+  switched_params.input2_shift = params.input1_shift;
+  return switched_params;
+}
+
+// Fivefold broadcast of quantized operations, which is the same as BroadcastAddFivefold except
+// that the parameters of inputs are switched together with the inputs.
+// 'elementwise' computes sections of input1 and input2, and 'scalar_broadcast' computes an element
+// of input1 with a section of input2.
+template <typename T, typename ElementwiseFn, typename ScalarBroadcastFn>
+inline void BroadcastFivefoldQuant(const BinaryArithmeticOpParam &unswitched_params,
+                                   const T *unswitched_input1_data,
+                                   const T *unswitched_input2_data, T *output_data,
+                                   ElementwiseFn elementwise, ScalarBroadcastFn scalar_broadcast)
+{
+  const bool use_unswitched =
+      unswitched_params.broadcast_category == BroadcastableOpCategory::kFirstInputBroadcastsFast;
+  const BinaryArithmeticOpParam switched_params = SwitchInputParams(unswitched_params);
+  const BinaryArithmeticOpParam &params = use_unswitched ? unswitched_params : switched_params;
+
+  const T *input1_data = use_unswitched ? unswitched_input1_data : unswitched_input2_data;
+  const T *input2_data = use_unswitched ? unswitched_input2_data : unswitched_input1_data;
+
+  T *output_data_ptr = output_data;
+  const T *input1_data_ptr = input1_data;
+  const T *input2_data_reset = input2_data;
+  int y0 = params.broadcast_shape[0];
+  int y1 = params.broadcast_shape[1];
+  int y2 = params.broadcast_shape[2];
+  int y3 = params.broadcast_shape[3];
+  int y4 = params.broadcast_shape[4];
+  if (y4 > 1)
+  {
+    for (int i0 = 0; i0 < y0; ++i0)
+    {
+      const T *input2_data_ptr = nullptr;
+      for (int i1 = 0; i1 < y1; ++i1)
+      {
+        input2_data_ptr = input2_data_reset;
+        for (int i2 = 0; i2 < y2; ++i2)
+        {
+          for (int i3 = 0; i3 < y3; ++i3)
+          {
+            elementwise(y4, params, input1_data_ptr, input2_data_ptr, output_data_ptr);
+            input2_data_ptr += y4;
+            output_data_ptr += y4;
+          }
+          input1_data_ptr += y4;
+        }
+      }
+      input2_data_reset = input2_data_ptr;
+    }
+  }
+  else
+  {
+    for (int i0 = 0; i0 < y0; ++i0)
+    {
+      const T *input2_data_ptr = nullptr;
+      for (int i1 = 0; i1 < y1; ++i1)
+      {
+        input2_data_ptr = input2_data_reset;
+        for (int i2 = 0; i2 < y2; ++i2)
+        {
+          scalar_broadcast(y3, params, *input1_data_ptr, input2_data_ptr, output_data_ptr);
+          input2_data_ptr += y3;
+          output_data_ptr += y3;
+          ++input1_data_ptr;
+        }
+      }
+      input2_data_reset = input2_data_ptr;
+    }
+  }
+}
+
+// Quantized Add rescales both inputs to a common scale with 'left_shift' bits of headroom, adds
+// them and rescales the sum to the output scale. Quantized Sub is Add whose input2_multiplier is
+// negated.
+inline int32_t ScaleQuant8AddInput(int32_t value, int32_t offset, int32_t multiplier, int32_t shift,
+                                   int32_t left_shift)
+{
+  return MultiplyByQuantizedMultiplier((value + offset) * (1 << left_shift), multiplier, shift);
+}
+
+inline uint8_t Quant8Output(const BinaryArithmeticOpParam &params, int32_t raw)
+{
+  const int32_t output =
+      MultiplyByQuantizedMultiplier(raw, params.output_multiplier, params.output_shift) +
+      params.output_offset;
+  return static_cast<uint8_t>(ActivationFunctionWithMinMax(
+      output, params.quantized_activation_min, params.quantized_activation_max));
+}
+
+inline uint8_t Quant8Add(const BinaryArithmeticOpParam &params, uint8_t input1, uint8_t input2)
+{
+  const int32_t scaled_input1 =
+      ScaleQuant8AddInput(input1, params.input1_offset, params.input1_multiplier,
+                          params.input1_shift, params.left_shift);
+  const int32_t scaled_input2 =
+      ScaleQuant8AddInput(input2, params.input2_offset, params.input2_multiplier,
+                          params.input2_shift, params.left_shift);
+  return Quant8Output(params, scaled_input1 + scaled_input2);
+}
+
+inline uint8_t Quant8Mul(const BinaryArithmeticOpParam &params, uint8_t input1, uint8_t input2)
+{
+  return Quant8Output(params, (input1 + params.input1_offset) * (input2 + params.input2_offset));
+}
+
+#ifdef USE_NEON
+inline int32x4_t MultiplyByQuantizedMultiplierX4(int32x4_t x, int32_t quantized_multiplier,
+                                                 int shift)
+{
+  const int left_shift = shift > 0 ? shift : 0;
+  const int right_shift = shift > 0 ? 0 : -shift;
+  x = vshlq_s32(x, vdupq_n_s32(left_shift));
+  return gemmlowp::RoundingDivideByPOT(vqrdmulhq_n_s32(x, quantized_multiplier), right_shift);
+}
+
+// Rescales raw results to the output scale, and narrows them with saturation and activation
+inline uint8x8_t Quant8OutputX8(const BinaryArithmeticOpParam &params, int32x4_t raw_low,
+                                int32x4_t raw_high)
+{
+  const int32x4_t low =
+      MultiplyByQuantizedMultiplierX4(raw_low, params.output_multiplier, params.output_shift);
+  const int32x4_t high =
+      MultiplyByQuantizedMultiplierX4(raw_high, params.output_multiplier, params.output_shift);
+  const int16x8_t output = vqaddq_s16(vcombine_s16(vqmovn_s32(low), vqmovn_s32(high)),
+                                      vdupq_n_s16(params.output_offset));
+  const uint8x8_t output_activation_min_vector = vdup_n_u8(params.quantized_activation_min);
+  const uint8x8_t output_activation_max_vector = vdup_n_u8(params.quantized_activation_max);
+  return vmax_u8(output_activation_min_vector,
+                 vmin_u8(output_activation_max_vector, vqmovun_s16(output)));
+}
+
+// Loads 8 elements with the offset added
+inline int16x8_t LoadQuant8X8(const uint8_t *data, int32_t offset)
+{
+  return vaddq_s16(vreinterpretq_s16_u16(vmovl_u8(vld1_u8(data))), vdupq_n_s16(offset));
+}
+
+inline int32x4_t ScaleQuant8AddInputX4(int16x4_t value, int32_t multiplier, int32_t shift,
+                                       int32_t left_shift)
+{
+  return MultiplyByQuantizedMultiplierX4(vshlq_s32(vmovl_s16(value), vdupq_n_s32(left_shift)),
+                                         multiplier, shift);
+}
+#endif // NEON
+
+inline void AddElementwiseQuant8(int size, const BinaryArithmeticOpParam &params,
+                                 const uint8_t *input1_data, const uint8_t *input2_data,
+                                 uint8_t *output_data)
+{
+  int i = 0;
+#ifdef USE_NEON
+  for (; i <= size - 8; i += 8)
+  {
+    const int16x8_t input1_val = LoadQuant8X8(input1_data + i, params.input1_offset);
+    const int16x8_t input2_val = LoadQuant8X8(input2_data + i, params.input2_offset);
+    const int32x4_t x11 = ScaleQuant8AddInputX4(vget_low_s16(input1_val), params.input1_multiplier,
+                                                params.input1_shift, params.left_shift);
+    const int32x4_t x12 = ScaleQuant8AddInputX4(vget_high_s16(input1_val), params.input1_multiplier,
+                                                params.input1_shift, params.left_shift);
+    const int32x4_t x21 = ScaleQuant8AddInputX4(vget_low_s16(input2_val), params.input2_multiplier,
+                                                params.input2_shift, params.left_shift);
+    const int32x4_t x22 = ScaleQuant8AddInputX4(vget_high_s16(input2_val), params.input2_multiplier,
+                                                params.input2_shift, params.left_shift);
+    vst1_u8(output_data + i, Quant8OutputX8(params, vaddq_s32(x11, x21), vaddq_s32(x12, x22)));
+  }
+#endif // NEON
+
+  for (; i < size; ++i)
+  {
+    output_data[i] = Quant8Add(params, input1_data[i], input2_data[i]);
+  }
+}
+
+// Scalar-broadcast quantized add, where the broadcast value is rescaled only once
+inline void AddScalarBroadcastQuant8(int size, const BinaryArithmeticOpParam &params,
+                                     uint8_t broadcast_value, const uint8_t *input2_data,
+                                     uint8_t *output_data)
+{
+  const int32_t scaled_input1 =
+      ScaleQuant8AddInput(broadcast_value, params.input1_offset, params.input1_multiplier,
+                          params.input1_shift, params.left_shift);
+  int i = 0;
+#ifdef USE_NEON
+  const int32x4_t scaled_input1_dup = vdupq_n_s32(scaled_input1);
+  for (; i <= size - 8; i += 8)
+  {
+    const int16x8_t input2_val = LoadQuant8X8(input2_data + i, params.input2_offset);
+    const int32x4_t x21 = ScaleQuant8AddInputX4(vget_low_s16(input2_val), params.input2_multiplier,
+                                                params.input2_shift, params.left_shift);
+    const int32x4_t x22 = ScaleQuant8AddInputX4(vget_high_s16(input2_val), params.input2_multiplier,
+                                                params.input2_shift, params.left_shift);
+    vst1_u8(output_data + i, Quant8OutputX8(params, vaddq_s32(scaled_input1_dup, x21),
+                                            vaddq_s32(scaled_input1_dup, x22)));
+  }
+#endif // NEON
+
+  for (; i < size; ++i)
+  {
+    const int32_t scaled_input2 =
+        ScaleQuant8AddInput(input2_data[i], params.input2_offset, params.input2_multiplier,
+                            params.input2_shift, params.left_shift);
+    output_data[i] = Quant8Output(params, scaled_input1 + scaled_input2);
+  }
+}
+
+inline void MulElementwiseQuant8(int size, const BinaryArithmeticOpParam &params,
+                                 const uint8_t *input1_data, const uint8_t *input2_data,
+                                 uint8_t *output_data)
+{
+  int i = 0;
+#ifdef USE_NEON
+  for (; i <= size - 8; i += 8)
+  {
+    const int16x8_t input1_val = LoadQuant8X8(input1_data + i, params.input1_offset);
+    const int16x8_t input2_val = LoadQuant8X8(input2_data + i, params.input2_offset);
+    const int32x4_t p1 = vmull_s16(vget_low_s16(input1_val), vget_low_s16(input2_val));
+    const int32x4_t p2 = vmull_s16(vget_high_s16(input1_val), vget_high_s16(input2_val));
+    vst1_u8(output_data + i, Quant8OutputX8(params, p1, p2));
+  }
+#endif // NEON
+
+  for (; i < size; ++i)
+  {
+    output_data[i] = Quant8Mul(params, input1_data[i], input2_data[i]);
+  }
+}
+
+inline void MulScalarBroadcastQuant8(int size, const BinaryArithmeticOpParam &params,
+                                     uint8_t broadcast_value, const uint8_t *input2_data,
+                                     uint8_t *output_data)
+{
+  const int32_t input1_val = broadcast_value + params.input1_offset;
+  int i = 0;
+#ifdef USE_NEON
+  for (; i <= size - 8; i += 8)
+  {
+    const int16x8_t input2_val = LoadQuant8X8(input2_data + i, params.input2_offset);
+    const int32x4_t p1 = vmull_n_s16(vget_low_s16(input2_val), input1_val);
+    const int32x4_t p2 = vmull_n_s16(vget_high_s16(input2_val), input1_val);
+    vst1_u8(output_data + i, Quant8OutputX8(params, p1, p2));
+  }
+#endif // NEON
+
+  for (; i < size; ++i)
+  {
+    output_data[i] = Quant8Output(params, input1_val * (input2_data[i] + params.input2_offset));
+  }
+}
+
+inline void Add(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
+                const uint8_t *input1_data, const Shape &input2_shape, const uint8_t *input2_data,
+                const Shape &output_shape, uint8_t *output_data)
+{
+  const int flat_size = MatchingElementsSize(input1_shape, input2_shape, output_shape);
+  AddElementwiseQuant8(flat_size, params, input1_data, input2_data, output_data);
+}
+
+inline void BroadcastAddDispatch(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
+                                 const uint8_t *input1_data, const Shape &input2_shape,
+                                 const uint8_t *input2_data, const Shape &output_shape,
+                                 uint8_t *output_data)
+{
+  if (params.broadcast_category == BroadcastableOpCategory::kGenericBroadcast)
+  {
+    const std::function<uint8_t(const uint8_t &, const uint8_t &)> fn =
+        [&params](const uint8_t &a, const uint8_t &b) -> uint8_t {
+      return Quant8Add(params, a, b);
+    };
+    reference::BroadcastBinaryArithmeticOpSlow(params, input1_shape, input1_data, input2_shape,
+                                               input2_data, output_shape, output_data, fn);
+    return;
+  }
+  BroadcastFivefoldQuant(params, input1_data, input2_data, output_data, AddElementwiseQuant8,
+                         AddScalarBroadcastQuant8);
+}
+
+inline BinaryArithmeticOpParam NegateInput2Params(const BinaryArithmeticOpParam &params)
+{
+  BinaryArithmeticOpParam negated_params = params;
+  negated_params.input2_multiplier = -params.input2_multiplier;
+  return negated_params;
+}
+
+inline void Sub(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
+                const uint8_t *input1_data, const Shape &input2_shape, const uint8_t *input2_data,
+                const Shape &output_shape, uint8_t *output_data)
+{
+  Add(NegateInput2Params(params), input1_shape, input1_data, input2_shape, input2_data,
+      output_shape, output_data);
+}
+
+inline void BroadcastSubDispatch(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
+                                 const uint8_t *input1_data, const Shape &input2_shape,
+                                 const uint8_t *input2_data, const Shape &output_shape,
+                                 uint8_t *output_data)
+{
+  BroadcastAddDispatch(NegateInput2Params(params), input1_shape, input1_data, input2_shape,
+                       input2_data, output_shape, output_data);
+}
+
+inline void Mul(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
+                const uint8_t *input1_data, const Shape &input2_shape, const uint8_t *input2_data,
+                const Shape &output_shape, uint8_t *output_data)
+{
+  const int flat_size = MatchingElementsSize(input1_shape, input2_shape, output_shape);
+  MulElementwiseQuant8(flat_size, params, input1_data, input2_data, output_data);
+}
+
+inline void BroadcastMulDispatch(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
+                                 const uint8_t *input1_data, const Shape &input2_shape,
+                                 const uint8_t *input2_data, const Shape &output_shape,
+                                 uint8_t *output_data)
+{
+  if (params.broadcast_category == BroadcastableOpCategory::kGenericBroadcast)
+  {
+    const std::function<uint8_t(const uint8_t &, const uint8_t &)> fn =
+        [&params](const uint8_t &a, const uint8_t &b) -> uint8_t {
+      return Quant8Mul(params, a, b);
+    };
+    reference::BroadcastBinaryArithmeticOpSlow(params, input1_shape, input1_data, input2_shape,
+                                               input2_data, output_shape, output_data, fn);
+    return;
+  }
+  BroadcastFivefoldQuant(params, input1_data, input2_data, output_data, MulElementwiseQuant8,
+                         MulScalarBroadcastQuant8);
+}
+
 } // namespace optimized
 } // namespace cker
 } // namespace nnfw
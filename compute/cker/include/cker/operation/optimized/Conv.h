@@ -67,6 +67,25 @@ struct GemmlowpOutputPipeline
     return std::make_tuple(bias_addition_stage, quantize_down_stage, clamp_stage,
                            saturating_cast_stage);
   }
+
+  typedef std::tuple<gemmlowp::OutputStageScaleInt32ByFixedPointAndExponent,
+                     gemmlowp::OutputStageClamp, gemmlowp::OutputStageSaturatingCastToUint8>
+      PipelineWithoutBias;
+  static PipelineWithoutBias MakeExpWithoutBias(int32_t output_offset, int32_t output_multiplier,
+                                                int output_left_shift,
+                                                int32_t output_activation_min,
+                                                int32_t output_activation_max)
+  {
+    gemmlowp::OutputStageScaleInt32ByFixedPointAndExponent quantize_down_stage;
+    quantize_down_stage.result_offset_after_shift = output_offset;
+    quantize_down_stage.result_fixedpoint_multiplier = output_multiplier;
+    quantize_down_stage.result_exponent = output_left_shift;
+    gemmlowp::OutputStageClamp clamp_stage;
+    clamp_stage.min = output_activation_min;
+    clamp_stage.max = output_activation_max;
+    gemmlowp::OutputStageSaturatingCastToUint8 saturating_cast_stage;
+    return std::make_tuple(quantize_down_stage, clamp_stage, saturating_cast_stage);
+  }
 };
 
 inline void AddBiasAndEvalActivationFunction(float output_activation_min,
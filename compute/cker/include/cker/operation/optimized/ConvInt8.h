@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ * Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_CONV_INT8_H__
+#define __NNFW_CKER_OPTIMIZED_CONV_INT8_H__
+
+#include "OptimizedUtils.h"
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/operation/reference/Conv.h"
+#ifdef USE_RUY_GEMV
+#include "cker/ruy/RuySupport.h"
+
+#include <ruy/ruy.h>
+#endif
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+// Computes output(output_depth x cols) = filter(output_depth x depth) * input(depth x cols) of
+// int8, where bias, the zero point of input and the requantization of each output channel are
+// fused into the GEMM
+inline void GemmPerChannel(const int32_t *output_multiplier, const int *output_shift,
+                           int32_t input_offset, int32_t output_offset,
+                           int32_t output_activation_min, int32_t output_activation_max,
+                           int output_depth, int depth, int cols, const int8_t *filter_data,
+                           bool filter_cacheable, const int8_t *input_data,
+                           const int32_t *bias_data, int8_t *output_data)
+{
+#ifdef USE_RUY_GEMV
+  MatrixParams<int8_t> lhs_params;
+  lhs_params.order = Order::kRowMajor;
+  lhs_params.rows = output_depth;
+  lhs_params.cols = depth;
+  // Symmetric filter
+  lhs_params.zero_point = 0;
+  lhs_params.cacheable = filter_cacheable;
+
+  MatrixParams<int8_t> rhs_params;
+  rhs_params.order = Order::kColMajor;
+  rhs_params.rows = depth;
+  rhs_params.cols = cols;
+  rhs_params.zero_point = static_cast<int8_t>(-input_offset);
+
+  MatrixParams<int8_t> dst_params;
+  dst_params.order = Order::kColMajor;
+  dst_params.rows = output_depth;
+  dst_params.cols = cols;
+  dst_params.zero_point = static_cast<int8_t>(output_offset);
+
+  GemmParams<int32_t, int8_t, QuantizationFlavor::kIntegerWithPerRowMultiplier> gemm_params;
+  gemm_params.bias = bias_data;
+  gemm_params.clamp_min = static_cast<int8_t>(output_activation_min);
+  gemm_params.clamp_max = static_cast<int8_t>(output_activation_max);
+  gemm_params.multiplier_fixedpoint_perchannel = output_multiplier;
+  gemm_params.multiplier_exponent_perchannel = output_shift;
+
+  ruy::Context *ruy_context = ruy_support::GetRuyContext();
+
+  ruy::Matrix<int8_t> ruy_lhs;
+  ruy::Matrix<int8_t> ruy_rhs;
+  ruy::Matrix<int8_t> ruy_dst;
+  ruy_support::MakeRuyMatrix(lhs_params, filter_data, &ruy_lhs);
+  ruy_support::MakeRuyMatrix(rhs_params, input_data, &ruy_rhs);
+  ruy_support::MakeRuyMatrix(dst_params, output_data, &ruy_dst);
+
+  ruy::BasicSpec<int32_t, int8_t> ruy_spec;
+  ruy_support::MakeRuySpec(gemm_params, &ruy_spec);
+
+  constexpr ruy::Path kRuyPath = ruy::kAllPaths;
+  ruy::Mul<kRuyPath>(ruy_lhs, ruy_rhs, ruy_spec, ruy_context, &ruy_dst);
+#else
+  // Without ruy, accumulate a column at a time, which is still cache friendly as both operands
+  // are contiguous along depth
+  UNUSED_RELEASE(filter_cacheable);
+  for (int col = 0; col < cols; ++col)
+  {
+    const int8_t *input_col = input_data + col * depth;
+    for (int out_c = 0; out_c < output_depth; ++out_c)
+    {
+      const int8_t *filter_row = filter_data + out_c * depth;
+      int32_t acc = 0;
+      for (int d = 0; d < depth; ++d)
+      {
+        acc += static_cast<int32_t>(filter_row[d]) * (input_col[d] + input_offset);
+      }
+      if (bias_data)
+      {
+        acc += bias_data[out_c];
+      }
+      acc = MultiplyByQuantizedMultiplier(acc, output_multiplier[out_c], output_shift[out_c]);
+      acc += output_offset;
+      acc = std::max(acc, output_activation_min);
+      acc = std::min(acc, output_activation_max);
+      output_data[col * output_depth + out_c] = static_cast<int8_t>(acc);
+    }
+  }
+#endif
+}
+
+inline void ConvPerChannel(const ConvParams &params, const int32_t *output_multiplier,
+                           const int *output_shift, const Shape &input_shape,
+                           const int8_t *input_data, const Shape &filter_shape,
+                           const int8_t *filter_data, const Shape &bias_shape,
+                           const int32_t *bias_data, const Shape &output_shape,
+                           int8_t *output_data, const Shape &im2col_shape, int8_t *im2col_data)
+{
+  const int stride_width = params.stride_width;
+  const int stride_height = params.stride_height;
+  const int dilation_width_factor = params.dilation_width_factor;
+  const int dilation_height_factor = params.dilation_height_factor;
+  const int32_t input_offset = params.input_offset;
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+
+  if (dilation_width_factor != 1 || dilation_height_factor != 1)
+  {
+    // TODO Support dilated im2col
+    reference::ConvPerChannel(params, output_multiplier, output_shift, input_shape, input_data,
+                              filter_shape, filter_data, bias_shape, bias_data, output_shape,
+                              output_data);
+    return;
+  }
+
+  const int8_t *gemm_input_data = nullptr;
+  const Shape *gemm_input_shape = nullptr;
+  const int filter_width = filter_shape.Dims(2);
+  const int filter_height = filter_shape.Dims(1);
+  const bool need_im2col =
+      stride_width != 1 || stride_height != 1 || filter_width != 1 || filter_height != 1;
+  if (need_im2col)
+  {
+    assert(im2col_data);
+    const int8_t input_zero_point = static_cast<int8_t>(-input_offset);
+    // Padding is filled with the input zero point, which is zero in real numbers
+    Im2col(params, filter_height, filter_width, static_cast<uint8_t>(input_zero_point),
+           input_shape, input_data, im2col_shape, im2col_data);
+    gemm_input_data = im2col_data;
+    gemm_input_shape = &im2col_shape;
+  }
+  else
+  {
+    gemm_input_data = input_data;
+    gemm_input_shape = &input_shape;
+  }
+
+  const int gemm_input_rows = gemm_input_shape->Dims(3);
+  const int gemm_input_cols =
+      gemm_input_shape->Dims(0) * gemm_input_shape->Dims(1) * gemm_input_shape->Dims(2);
+  const int filter_rows = filter_shape.Dims(0);
+  const int filter_cols = filter_shape.Dims(1) * filter_shape.Dims(2) * filter_shape.Dims(3);
+  const int output_rows = output_shape.Dims(3);
+  const int output_cols = output_shape.Dims(0) * output_shape.Dims(1) * output_shape.Dims(2);
+  assert(output_rows == filter_rows);
+  assert(output_cols == gemm_input_cols);
+  assert(filter_cols == gemm_input_rows);
+  assert(bias_data == nullptr || bias_shape.FlatSize() == output_rows);
+  UNUSED_RELEASE(filter_rows);
+  UNUSED_RELEASE(filter_cols);
+  UNUSED_RELEASE(gemm_input_cols);
+  UNUSED_RELEASE(bias_shape);
+
+  GemmPerChannel(output_multiplier, output_shift, input_offset, params.output_offset,
+                 params.quantized_activation_min, params.quantized_activation_max, output_rows,
+                 gemm_input_rows, output_cols, filter_data, params.lhs_cacheable, gemm_input_data,
+                 bias_data, output_data);
+}
+
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_CONV_INT8_H__
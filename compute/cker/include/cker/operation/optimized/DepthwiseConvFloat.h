@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_DEPTHWISE_CONV_FLOAT_H__
+#define __NNFW_CKER_OPTIMIZED_DEPTHWISE_CONV_FLOAT_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/eigen/EigenSupport.h"
+
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+// Eigen packet of float, which is mapped to SSE/AVX or NEON registers according to the target
+using FloatPacket = Eigen::internal::packet_traits<float>::type;
+constexpr int kFloatPacketSize = Eigen::internal::packet_traits<float>::size;
+
+inline FloatPacket FloatActivation(const FloatPacket &x, const FloatPacket &act_min,
+                                   const FloatPacket &act_max)
+{
+  return Eigen::internal::pmin(Eigen::internal::pmax(x, act_min), act_max);
+}
+
+// Computes an output pixel from the given filter taps, where input_ptrs[i] and filter_ptrs[i]
+// point to the first channel of the i-th tap. The bounds of taps are checked by the caller once
+// per pixel instead of once per channel.
+inline void FloatDepthwiseConvPixel(int input_depth, int depth_multiplier, int num_taps,
+                                    const float *const *input_ptrs,
+                                    const float *const *filter_ptrs, const float *bias_data,
+                                    float output_activation_min, float output_activation_max,
+                                    float *output_ptr)
+{
+  const FloatPacket act_min = Eigen::internal::pset1<FloatPacket>(output_activation_min);
+  const FloatPacket act_max = Eigen::internal::pset1<FloatPacket>(output_activation_max);
+
+  if (depth_multiplier == 1)
+  {
+    // Vectorize over channels
+    int c = 0;
+    for (; c <= input_depth - kFloatPacketSize; c += kFloatPacketSize)
+    {
+      FloatPacket acc = Eigen::internal::pset1<FloatPacket>(0.f);
+      for (int t = 0; t < num_taps; ++t)
+      {
+        acc = Eigen::internal::pmadd(Eigen::internal::ploadu<FloatPacket>(input_ptrs[t] + c),
+                                     Eigen::internal::ploadu<FloatPacket>(filter_ptrs[t] + c), acc);
+      }
+      if (bias_data)
+      {
+        acc = Eigen::internal::padd(acc, Eigen::internal::ploadu<FloatPacket>(bias_data + c));
+      }
+      Eigen::internal::pstoreu(output_ptr + c, FloatActivation(acc, act_min, act_max));
+    }
+    for (; c < input_depth; ++c)
+    {
+      float total = 0.f;
+      for (int t = 0; t < num_taps; ++t)
+      {
+        total += input_ptrs[t][c] * filter_ptrs[t][c];
+      }
+      const float bias_value = bias_data ? bias_data[c] : 0.f;
+      output_ptr[c] = ActivationFunctionWithMinMax(total + bias_value, output_activation_min,
+                                                   output_activation_max);
+    }
+    return;
+  }
+
+  // Vectorize over depth multiplier, broadcasting an input value
+  for (int ic = 0; ic < input_depth; ++ic)
+  {
+    const int oc_base = ic * depth_multiplier;
+    int m = 0;
+    for (; m <= depth_multiplier - kFloatPacketSize; m += kFloatPacketSize)
+    {
+      const int oc = oc_base + m;
+      FloatPacket acc = Eigen::internal::pset1<FloatPacket>(0.f);
+      for (int t = 0; t < num_taps; ++t)
+      {
+        acc = Eigen::internal::pmadd(Eigen::internal::pset1<FloatPacket>(input_ptrs[t][ic]),
+                                     Eigen::internal::ploadu<FloatPacket>(filter_ptrs[t] + oc),
+                                     acc);
+      }
+      if (bias_data)
+      {
+        acc = Eigen::internal::padd(acc, Eigen::internal::ploadu<FloatPacket>(bias_data + oc));
+      }
+      Eigen::internal::pstoreu(output_ptr + oc, FloatActivation(acc, act_min, act_max));
+    }
+    for (; m < depth_multiplier; ++m)
+    {
+      const int oc = oc_base + m;
+      float total = 0.f;
+      for (int t = 0; t < num_taps; ++t)
+      {
+        total += input_ptrs[t][ic] * filter_ptrs[t][oc];
+      }
+      const float bias_value = bias_data ? bias_data[oc] : 0.f;
+      output_ptr[oc] = ActivationFunctionWithMinMax(total + bias_value, output_activation_min,
+                                                    output_activation_max);
+    }
+  }
+}
+
+// Computes output pixels of a row whose 3x3 receptive fields are all inside of the input, with
+// depth multiplier 1 and no dilation. input_ptr points to the top-left tap of the first pixel.
+template <int kStride>
+inline void FloatDepthwiseConv3x3Row(int depth, int input_row_size, const float *input_ptr,
+                                     const float *filter_data, const float *bias_data,
+                                     float output_activation_min, float output_activation_max,
+                                     int num_output_pixels, float *output_ptr)
+{
+  const FloatPacket act_min = Eigen::internal::pset1<FloatPacket>(output_activation_min);
+  const FloatPacket act_max = Eigen::internal::pset1<FloatPacket>(output_activation_max);
+
+  for (int i = 0; i < num_output_pixels; ++i)
+  {
+    const float *in = input_ptr + i * kStride * depth;
+    float *out = output_ptr + i * depth;
+
+    int c = 0;
+    for (; c <= depth - kFloatPacketSize; c += kFloatPacketSize)
+    {
+      FloatPacket acc = Eigen::internal::pset1<FloatPacket>(0.f);
+      for (int fy = 0; fy < 3; ++fy)
+      {
+        const float *in_row = in + fy * input_row_size + c;
+        const float *filter_row = filter_data + fy * 3 * depth + c;
+        for (int fx = 0; fx < 3; ++fx)
+        {
+          const FloatPacket input = Eigen::internal::ploadu<FloatPacket>(in_row + fx * depth);
+          const FloatPacket filter = Eigen::internal::ploadu<FloatPacket>(filter_row + fx * depth);
+          acc = Eigen::internal::pmadd(input, filter, acc);
+        }
+      }
+      if (bias_data)
+      {
+        acc = Eigen::internal::padd(acc, Eigen::internal::ploadu<FloatPacket>(bias_data + c));
+      }
+      Eigen::internal::pstoreu(out + c, FloatActivation(acc, act_min, act_max));
+    }
+    for (; c < depth; ++c)
+    {
+      float total = 0.f;
+      for (int fy = 0; fy < 3; ++fy)
+      {
+        for (int fx = 0; fx < 3; ++fx)
+        {
+          total +=
+              in[fy * input_row_size + fx * depth + c] * filter_data[(fy * 3 + fx) * depth + c];
+        }
+      }
+      const float bias_value = bias_data ? bias_data[c] : 0.f;
+      out[c] = ActivationFunctionWithMinMax(total + bias_value, output_activation_min,
+                                            output_activation_max);
+    }
+  }
+}
+
+// Computes output rows in [thread_start, thread_end), where a row is indexed by
+// (batch * output_height + out_y)
+inline void DepthwiseConvImpl(const DepthwiseConvParams &params, const Shape &input_shape,
+                              const float *input_data, const Shape &filter_shape,
+                              const float *filter_data, const float *bias_data,
+                              const Shape &output_shape, float *output_data, int thread_start,
+                              int thread_end)
+{
+  const int stride_width = params.stride_width;
+  const int stride_height = params.stride_height;
+  const int dilation_width_factor = params.dilation_width_factor;
+  const int dilation_height_factor = params.dilation_height_factor;
+  const int pad_width = params.padding_values.width;
+  const int pad_height = params.padding_values.height;
+  const int depth_multiplier = params.depth_multiplier;
+  const float output_activation_min = params.float_activation_min;
+  const float output_activation_max = params.float_activation_max;
+
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_depth = input_shape.Dims(3);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int output_depth = output_shape.Dims(3);
+  const int input_row_size = input_width * input_depth;
+
+  const bool use_3x3_kernel = filter_height == 3 && filter_width == 3 && depth_multiplier == 1 &&
+                              dilation_width_factor == 1 && dilation_height_factor == 1 &&
+                              stride_width == stride_height &&
+                              (stride_width == 1 || stride_width == 2);
+
+  // Range of out_x whose receptive field is inside of the input horizontally
+  int interior_x_begin = 0;
+  int interior_x_end = 0;
+  if (use_3x3_kernel)
+  {
+    while (interior_x_begin < output_width && interior_x_begin * stride_width - pad_width < 0)
+      ++interior_x_begin;
+    interior_x_end = output_width;
+    while (interior_x_end > interior_x_begin &&
+           (interior_x_end - 1) * stride_width - pad_width + 2 >= input_width)
+      --interior_x_end;
+  }
+
+  std::vector<const float *> input_ptrs(filter_height * filter_width);
+  std::vector<const float *> filter_ptrs(filter_height * filter_width);
+
+  for (int row = thread_start; row < thread_end; ++row)
+  {
+    const int b = row / output_height;
+    const int out_y = row % output_height;
+    const int in_y_origin = (out_y * stride_height) - pad_height;
+    float *output_row_ptr = output_data + Offset(output_shape, b, out_y, 0, 0);
+
+    int out_x = 0;
+    while (out_x < output_width)
+    {
+      if (use_3x3_kernel && out_x == interior_x_begin && interior_x_begin < interior_x_end &&
+          in_y_origin >= 0 && in_y_origin + 2 < input_height)
+      {
+        const int in_x_origin = (out_x * stride_width) - pad_width;
+        const float *input_ptr = input_data + Offset(input_shape, b, in_y_origin, in_x_origin, 0);
+        const int num_pixels = interior_x_end - interior_x_begin;
+        float *output_ptr = output_row_ptr + out_x * output_depth;
+        if (stride_width == 1)
+        {
+          FloatDepthwiseConv3x3Row<1>(input_depth, input_row_size, input_ptr, filter_data,
+                                      bias_data, output_activation_min, output_activation_max,
+                                      num_pixels, output_ptr);
+        }
+        else
+        {
+          FloatDepthwiseConv3x3Row<2>(input_depth, input_row_size, input_ptr, filter_data,
+                                      bias_data, output_activation_min, output_activation_max,
+                                      num_pixels, output_ptr);
+        }
+        out_x = interior_x_end;
+        continue;
+      }
+
+      // Collect the taps inside of the input
+      const int in_x_origin = (out_x * stride_width) - pad_width;
+      int num_taps = 0;
+      for (int filter_y = 0; filter_y < filter_height; ++filter_y)
+      {
+        const int in_y = in_y_origin + dilation_height_factor * filter_y;
+        if (in_y < 0 || in_y >= input_height)
+          continue;
+        for (int filter_x = 0; filter_x < filter_width; ++filter_x)
+        {
+          const int in_x = in_x_origin + dilation_width_factor * filter_x;
+          if (in_x < 0 || in_x >= input_width)
+            continue;
+          input_ptrs[num_taps] = input_data + Offset(input_shape, b, in_y, in_x, 0);
+          filter_ptrs[num_taps] = filter_data + Offset(filter_shape, 0, filter_y, filter_x, 0);
+          ++num_taps;
+        }
+      }
+
+      FloatDepthwiseConvPixel(input_depth, depth_multiplier, num_taps, input_ptrs.data(),
+                              filter_ptrs.data(), bias_data, output_activation_min,
+                              output_activation_max, output_row_ptr + out_x * output_depth);
+      ++out_x;
+    }
+  }
+}
+
+} // namespace optimized
+
+namespace multithreaded
+{
+
+inline void DepthwiseConv(const DepthwiseConvParams &params, const Shape &input_shape,
+                          const float *input_data, const Shape &filter_shape,
+                          const float *filter_data, const Shape &bias_shape, const float *bias_data,
+                          const Shape &output_shape, float *output_data)
+{
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int output_depth = MatchingDim(filter_shape, 3, output_shape, 3);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  assert(output_depth == input_shape.Dims(3) * params.depth_multiplier);
+  assert(bias_data == nullptr || bias_shape.FlatSize() == output_depth);
+  UNUSED_RELEASE(bias_shape);
+
+  // Partition output rows among threads
+  const int num_rows = batches * output_height;
+  const double row_macs = static_cast<double>(output_width) * output_depth * filter_shape.Dims(1) *
+                          filter_shape.Dims(2);
+  const Eigen::TensorOpCost row_cost(row_macs * sizeof(float),
+                                     output_width * output_depth * sizeof(float), row_macs * 2);
+
+  const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
+  device.parallelFor(num_rows, row_cost, [&](Eigen::Index start, Eigen::Index end) {
+    optimized::DepthwiseConvImpl(params, input_shape, input_data, filter_shape, filter_data,
+                                 bias_data, output_shape, output_data, static_cast<int>(start),
+                                 static_cast<int>(end));
+  });
+}
+
+} // namespace multithreaded
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_DEPTHWISE_CONV_FLOAT_H__
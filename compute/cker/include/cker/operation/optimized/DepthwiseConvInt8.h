@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_DEPTHWISE_CONV_INT8_H__
+#define __NNFW_CKER_OPTIMIZED_DEPTHWISE_CONV_INT8_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/eigen/EigenSupport.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+// Accumulates a filter tap into the accumulators of all output channels of a pixel. The loops
+// run over contiguous channels so that the compiler vectorizes them.
+inline void Int8DepthwiseConvAccumulateTap(int input_depth, int depth_multiplier,
+                                           int32_t input_offset, const int8_t *input_ptr,
+                                           const int8_t *filter_ptr, int32_t *acc)
+{
+  if (depth_multiplier == 1)
+  {
+    for (int c = 0; c < input_depth; ++c)
+    {
+      acc[c] += static_cast<int32_t>(filter_ptr[c]) * (input_ptr[c] + input_offset);
+    }
+  }
+  else
+  {
+    for (int ic = 0; ic < input_depth; ++ic)
+    {
+      const int32_t input_val = input_ptr[ic] + input_offset;
+      for (int m = 0; m < depth_multiplier; ++m)
+      {
+        const int oc = ic * depth_multiplier + m;
+        acc[oc] += static_cast<int32_t>(filter_ptr[oc]) * input_val;
+      }
+    }
+  }
+}
+
+// Computes output rows [thread_start, thread_end), where a row is a pair of batch and out_y
+inline void DepthwiseConvPerChannelImpl(const DepthwiseConvParams &params,
+                                        const int32_t *output_multiplier, const int *output_shift,
+                                        const Shape &input_shape, const int8_t *input_data,
+                                        const Shape &filter_shape, const int8_t *filter_data,
+                                        const int32_t *bias_data, const Shape &output_shape,
+                                        int8_t *output_data, int thread_start, int thread_end)
+{
+  const int stride_width = params.stride_width;
+  const int stride_height = params.stride_height;
+  const int dilation_width_factor = params.dilation_width_factor;
+  const int dilation_height_factor = params.dilation_height_factor;
+  const int pad_width = params.padding_values.width;
+  const int pad_height = params.padding_values.height;
+  const int depth_multiplier = params.depth_multiplier;
+  const int32_t input_offset = params.input_offset;
+  const int32_t output_offset = params.output_offset;
+  const int32_t output_activation_min = params.quantized_activation_min;
+  const int32_t output_activation_max = params.quantized_activation_max;
+
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_depth = input_shape.Dims(3);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int output_depth = output_shape.Dims(3);
+
+  std::vector<int32_t> acc(output_depth);
+
+  for (int row = thread_start; row < thread_end; ++row)
+  {
+    const int b = row / output_height;
+    const int out_y = row % output_height;
+    const int in_y_origin = (out_y * stride_height) - pad_height;
+    int8_t *output_row_ptr = output_data + Offset(output_shape, b, out_y, 0, 0);
+
+    for (int out_x = 0; out_x < output_width; ++out_x)
+    {
+      if (bias_data)
+        std::copy(bias_data, bias_data + output_depth, acc.begin());
+      else
+        std::fill(acc.begin(), acc.end(), 0);
+
+      // Taps outside of the input add nothing as they are the input zero point
+      const int in_x_origin = (out_x * stride_width) - pad_width;
+      for (int filter_y = 0; filter_y < filter_height; ++filter_y)
+      {
+        const int in_y = in_y_origin + dilation_height_factor * filter_y;
+        if (in_y < 0 || in_y >= input_height)
+          continue;
+        for (int filter_x = 0; filter_x < filter_width; ++filter_x)
+        {
+          const int in_x = in_x_origin + dilation_width_factor * filter_x;
+          if (in_x < 0 || in_x >= input_width)
+            continue;
+          Int8DepthwiseConvAccumulateTap(
+              input_depth, depth_multiplier, input_offset,
+              input_data + Offset(input_shape, b, in_y, in_x, 0),
+              filter_data + Offset(filter_shape, 0, filter_y, filter_x, 0), acc.data());
+        }
+      }
+
+      int8_t *output_ptr = output_row_ptr + out_x * output_depth;
+      for (int oc = 0; oc < output_depth; ++oc)
+      {
+        int32_t value =
+            MultiplyByQuantizedMultiplier(acc[oc], output_multiplier[oc], output_shift[oc]);
+        value += output_offset;
+        value = std::max(value, output_activation_min);
+        value = std::min(value, output_activation_max);
+        output_ptr[oc] = static_cast<int8_t>(value);
+      }
+    }
+  }
+}
+
+} // namespace optimized
+
+namespace multithreaded
+{
+
+inline void DepthwiseConvPerChannel(const DepthwiseConvParams &params,
+                                    const int32_t *output_multiplier, const int *output_shift,
+                                    const Shape &input_shape, const int8_t *input_data,
+                                    const Shape &filter_shape, const int8_t *filter_data,
+                                    const Shape &bias_shape, const int32_t *bias_data,
+                                    const Shape &output_shape, int8_t *output_data)
+{
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  assert(params.quantized_activation_min <= params.quantized_activation_max);
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int output_depth = MatchingDim(filter_shape, 3, output_shape, 3);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  assert(output_depth == input_shape.Dims(3) * params.depth_multiplier);
+  assert(bias_data == nullptr || bias_shape.FlatSize() == output_depth);
+  UNUSED_RELEASE(bias_shape);
+
+  // Partition output rows among threads
+  const int num_rows = batches * output_height;
+  const double row_macs = static_cast<double>(output_width) * output_depth * filter_shape.Dims(1) *
+                          filter_shape.Dims(2);
+  const Eigen::TensorOpCost row_cost(row_macs * sizeof(int8_t), output_width * output_depth,
+                                     row_macs * 2);
+
+  const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
+  device.parallelFor(num_rows, row_cost, [&](Eigen::Index start, Eigen::Index end) {
+    optimized::DepthwiseConvPerChannelImpl(params, output_multiplier, output_shift, input_shape,
+                                           input_data, filter_shape, filter_data, bias_data,
+                                           output_shape, output_data, static_cast<int>(start),
+                                           static_cast<int>(end));
+  });
+}
+
+} // namespace multithreaded
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_DEPTHWISE_CONV_INT8_H__
@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_FP16_CONV_H__
+#define __NNFW_CKER_OPTIMIZED_FP16_CONV_H__
+
+#include "cker/Fp16TensorUtils.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/eigen/EigenSupport.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <vector>
+
+// Float convolutions whose filters are stored as fp16. Filters are converted to float in panels
+// right before they are multiplied, into the per-thread conversion scratch. So the scratch holds
+// a panel of filter rows and a tile of input patches, not the whole filter.
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+// Floats of a filter panel converted at once, 64KB to stay in L2 cache
+constexpr int kFp16ConvPanelSize = 16384;
+// Floats of input patches multiplied with a filter panel, 1MB. Smaller tiles convert each panel
+// again for more tiles and measured slower than the fp32 filter on 3x3 convolutions.
+constexpr int kFp16ConvTileSize = 262144;
+// Fewest filter rows of a panel and output pixels of a tile, so that they are still multiplied
+// as matrices when patches are large
+constexpr int kFp16ConvMinPanelRows = 64;
+constexpr int kFp16ConvMinTilePixels = 64;
+
+inline int Fp16ConvTilePixels(int patch_size, int num_pixels)
+{
+  return std::min(num_pixels,
+                  std::max(kFp16ConvMinTilePixels, kFp16ConvTileSize / std::max(1, patch_size)));
+}
+
+inline int Fp16ConvPanelRows(int patch_size, int output_depth)
+{
+  return std::min(output_depth,
+                  std::max(kFp16ConvMinPanelRows, kFp16ConvPanelSize / std::max(1, patch_size)));
+}
+
+/**
+ * @brief Conv of output pixels in [pixel_begin, pixel_end), where pixels are numbered over
+ *        batch, height and width of output
+ * @note  Input patches of a tile of output pixels are gathered first (im2col). Then the filter,
+ *        whose output channels are rows of patch size in OHWI, is converted panel by panel and
+ *        each panel is multiplied with all patches of the tile.
+ */
+inline void Fp16ConvImpl(const ConvParams &params, const Shape &input_shape,
+                         const float *input_data, const Shape &filter_shape,
+                         const uint16_t *filter_data, const float *bias_data,
+                         const Shape &output_shape, float *output_data, int pixel_begin,
+                         int pixel_end)
+{
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_depth = input_shape.Dims(3);
+  const int output_depth = filter_shape.Dims(0);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int patch_size = filter_height * filter_width * input_depth;
+
+  const int tile_pixels = Fp16ConvTilePixels(patch_size, pixel_end - pixel_begin);
+  const int panel_rows = Fp16ConvPanelRows(patch_size, output_depth);
+
+  std::vector<float> &scratch = Fp16ConversionScratch();
+  scratch.resize(static_cast<size_t>(tile_pixels + panel_rows) * patch_size);
+  float *tile = scratch.data();
+  float *panel = tile + static_cast<size_t>(tile_pixels) * patch_size;
+
+  for (int tile_begin = pixel_begin; tile_begin < pixel_end; tile_begin += tile_pixels)
+  {
+    const int pixels = std::min(tile_pixels, pixel_end - tile_begin);
+
+    for (int p = 0; p < pixels; ++p)
+    {
+      const int pixel = tile_begin + p;
+      const int out_x = pixel % output_width;
+      const int out_y = (pixel / output_width) % output_height;
+      const int batch = pixel / (output_width * output_height);
+      const int in_y_origin = out_y * params.stride_height - params.padding_values.height;
+      const int in_x_origin = out_x * params.stride_width - params.padding_values.width;
+
+      float *patch = tile + static_cast<size_t>(p) * patch_size;
+      for (int filter_y = 0; filter_y < filter_height; ++filter_y)
+      {
+        const int in_y = in_y_origin + params.dilation_height_factor * filter_y;
+        for (int filter_x = 0; filter_x < filter_width; ++filter_x)
+        {
+          const int in_x = in_x_origin + params.dilation_width_factor * filter_x;
+          float *dst = patch + (filter_y * filter_width + filter_x) * input_depth;
+          if (in_y >= 0 && in_y < input_height && in_x >= 0 && in_x < input_width)
+          {
+            const float *src =
+                input_data + ((static_cast<size_t>(batch) * input_height + in_y) * input_width +
+                              in_x) *
+                                 input_depth;
+            std::memcpy(dst, src, input_depth * sizeof(float));
+          }
+          else
+          {
+            std::fill(dst, dst + input_depth, 0.0f);
+          }
+        }
+      }
+    }
+
+    for (int row_begin = 0; row_begin < output_depth; row_begin += panel_rows)
+    {
+      const int rows = std::min(panel_rows, output_depth - row_begin);
+      Fp16ToFp32(filter_data + static_cast<size_t>(row_begin) * patch_size, panel,
+                 rows * patch_size);
+
+      // Columns of patches and of output are pixels, so output(rows x pixels) = panel^T * patches
+      Eigen::Map<const Eigen::MatrixXf> weights(panel, patch_size, rows);
+      Eigen::Map<const Eigen::MatrixXf> patches(tile, patch_size, pixels);
+      Eigen::Map<Eigen::MatrixXf, 0, Eigen::OuterStride<>> result(
+          output_data + static_cast<size_t>(tile_begin) * output_depth + row_begin, rows, pixels,
+          Eigen::OuterStride<>(output_depth));
+      result.noalias() = weights.transpose() * patches;
+    }
+
+    for (int p = 0; p < pixels; ++p)
+    {
+      float *output = output_data + static_cast<size_t>(tile_begin + p) * output_depth;
+      for (int channel = 0; channel < output_depth; ++channel)
+      {
+        const float value = bias_data ? output[channel] + bias_data[channel] : output[channel];
+        output[channel] = ActivationFunctionWithMinMax(value, params.float_activation_min,
+                                                       params.float_activation_max);
+      }
+    }
+  }
+}
+
+/**
+ * @brief DepthwiseConv of output rows in [row_begin, row_end), where rows are numbered over
+ *        batch and height of output
+ * @note  The filter is converted in blocks of output channels. Each block is applied to all
+ *        output pixels of the rows before the next one is converted.
+ */
+inline void Fp16DepthwiseConvImpl(const DepthwiseConvParams &params, const Shape &input_shape,
+                                  const float *input_data, const Shape &filter_shape,
+                                  const uint16_t *filter_data, const float *bias_data,
+                                  const Shape &output_shape, float *output_data, int row_begin,
+                                  int row_end)
+{
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_depth = input_shape.Dims(3);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int output_depth = output_shape.Dims(3);
+  const int depth_multiplier = params.depth_multiplier;
+  const int filter_size = filter_height * filter_width;
+
+  const int block_depth =
+      std::max(1, std::min(output_depth, kFp16ConvPanelSize / std::max(1, filter_size)));
+
+  std::vector<float> &scratch = Fp16ConversionScratch();
+  scratch.resize(static_cast<size_t>(filter_size + 1) * block_depth);
+  float *filter = scratch.data();
+  float *acc = filter + static_cast<size_t>(filter_size) * block_depth;
+
+  for (int depth_begin = 0; depth_begin < output_depth; depth_begin += block_depth)
+  {
+    const int depth = std::min(block_depth, output_depth - depth_begin);
+    for (int k = 0; k < filter_size; ++k)
+    {
+      Fp16ToFp32(filter_data + static_cast<size_t>(k) * output_depth + depth_begin,
+                 filter + k * depth, depth);
+    }
+
+    for (int row = row_begin; row < row_end; ++row)
+    {
+      const int batch = row / output_height;
+      const int out_y = row % output_height;
+      const int in_y_origin = out_y * params.stride_height - params.padding_values.height;
+      for (int out_x = 0; out_x < output_width; ++out_x)
+      {
+        const int in_x_origin = out_x * params.stride_width - params.padding_values.width;
+        if (bias_data)
+        {
+          std::copy(bias_data + depth_begin, bias_data + depth_begin + depth, acc);
+        }
+        else
+        {
+          std::fill(acc, acc + depth, 0.0f);
+        }
+
+        for (int filter_y = 0; filter_y < filter_height; ++filter_y)
+        {
+          const int in_y = in_y_origin + params.dilation_height_factor * filter_y;
+          if (in_y < 0 || in_y >= input_height)
+            continue;
+          for (int filter_x = 0; filter_x < filter_width; ++filter_x)
+          {
+            const int in_x = in_x_origin + params.dilation_width_factor * filter_x;
+            if (in_x < 0 || in_x >= input_width)
+              continue;
+            const float *input =
+                input_data + ((static_cast<size_t>(batch) * input_height + in_y) * input_width +
+                              in_x) *
+                                 input_depth;
+            const float *weights = filter + (filter_y * filter_width + filter_x) * depth;
+            if (depth_multiplier == 1)
+            {
+              const float *input_in_block = input + depth_begin;
+              for (int c = 0; c < depth; ++c)
+              {
+                acc[c] += input_in_block[c] * weights[c];
+              }
+            }
+            else
+            {
+              for (int c = 0; c < depth; ++c)
+              {
+                acc[c] += input[(depth_begin + c) / depth_multiplier] * weights[c];
+              }
+            }
+          }
+        }
+
+        float *output =
+            output_data +
+            ((static_cast<size_t>(batch) * output_height + out_y) * output_width + out_x) *
+                output_depth +
+            depth_begin;
+        for (int c = 0; c < depth; ++c)
+        {
+          output[c] = ActivationFunctionWithMinMax(acc[c], params.float_activation_min,
+                                                   params.float_activation_max);
+        }
+      }
+    }
+  }
+}
+
+} // namespace optimized
+
+namespace multithreaded
+{
+
+inline void Fp16Conv(const ConvParams &params, const Shape &input_shape, const float *input_data,
+                     const Shape &filter_shape, const uint16_t *filter_data,
+                     const Shape &bias_shape, const float *bias_data, const Shape &output_shape,
+                     float *output_data)
+{
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  assert(bias_data == nullptr || bias_shape.FlatSize() == filter_shape.Dims(0));
+  UNUSED_RELEASE(bias_shape);
+
+  const int num_pixels = MatchingDim(input_shape, 0, output_shape, 0) * output_shape.Dims(1) *
+                         output_shape.Dims(2);
+  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+  const int patch_size = filter_shape.Dims(1) * filter_shape.Dims(2) * filter_shape.Dims(3);
+  if (num_pixels == 0)
+    return;
+
+  // Partition tiles of output pixels among threads
+  const int tile_pixels = optimized::Fp16ConvTilePixels(patch_size, num_pixels);
+  const int num_tiles = (num_pixels + tile_pixels - 1) / tile_pixels;
+  const double tile_macs = static_cast<double>(tile_pixels) * patch_size * output_depth;
+  const Eigen::TensorOpCost tile_cost(tile_macs * sizeof(float) / tile_pixels,
+                                      tile_pixels * output_depth * sizeof(float), tile_macs * 2);
+
+  const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
+  device.parallelFor(num_tiles, tile_cost, [&](Eigen::Index start, Eigen::Index end) {
+    const int pixel_begin = static_cast<int>(start) * tile_pixels;
+    const int pixel_end = std::min(num_pixels, static_cast<int>(end) * tile_pixels);
+    optimized::Fp16ConvImpl(params, input_shape, input_data, filter_shape, filter_data, bias_data,
+                            output_shape, output_data, pixel_begin, pixel_end);
+  });
+}
+
+inline void Fp16DepthwiseConv(const DepthwiseConvParams &params, const Shape &input_shape,
+                              const float *input_data, const Shape &filter_shape,
+                              const uint16_t *filter_data, const Shape &bias_shape,
+                              const float *bias_data, const Shape &output_shape,
+                              float *output_data)
+{
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int output_depth = MatchingDim(filter_shape, 3, output_shape, 3);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  assert(output_depth == input_shape.Dims(3) * params.depth_multiplier);
+  assert(bias_data == nullptr || bias_shape.FlatSize() == output_depth);
+  UNUSED_RELEASE(bias_shape);
+
+  // Partition output rows among threads
+  const int num_rows = batches * output_height;
+  const double row_macs = static_cast<double>(output_width) * output_depth * filter_shape.Dims(1) *
+                          filter_shape.Dims(2);
+  const Eigen::TensorOpCost row_cost(row_macs * sizeof(float),
+                                     output_width * output_depth * sizeof(float), row_macs * 2);
+
+  const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
+  device.parallelFor(num_rows, row_cost, [&](Eigen::Index start, Eigen::Index end) {
+    optimized::Fp16DepthwiseConvImpl(params, input_shape, input_data, filter_shape, filter_data,
+                                     bias_data, output_shape, output_data,
+                                     static_cast<int>(start), static_cast<int>(end));
+  });
+}
+
+} // namespace multithreaded
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_FP16_CONV_H__
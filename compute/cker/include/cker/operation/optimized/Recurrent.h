@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_RECURRENT_H__
+#define __NNFW_CKER_OPTIMIZED_RECURRENT_H__
+
+#include "cker/Types.h"
+#include "cker/TensorUtils.h"
+#include "cker/eigen/EigenSupport.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+// Copies weights of gates, each of which is [n_unit, n_src], into rows of dst, whose stride is
+// dst_stride. Weights of several gates and sources are concatenated this way so that all of them
+// are multiplied by one GEMM.
+template <typename T>
+inline void ConcatGateWeights(const T *const *weights, int n_gates, int n_unit, int n_src,
+                              int dst_stride, T *dst)
+{
+  for (int gate = 0; gate < n_gates; ++gate)
+  {
+    for (int row = 0; row < n_unit; ++row)
+    {
+      std::memcpy(dst + (gate * n_unit + row) * dst_stride, weights[gate] + row * n_src,
+                  n_src * sizeof(T));
+    }
+  }
+}
+
+// Concatenates input and recurrent state of each batch into [n_batch, n_input + n_state]
+inline void ConcatRecurrentInput(const float *input, int n_input, const float *state, int n_state,
+                                 int n_batch, float *dst)
+{
+  const int depth = n_input + n_state;
+  for (int b = 0; b < n_batch; ++b)
+  {
+    std::memcpy(dst + b * depth, input + b * n_input, n_input * sizeof(float));
+    std::memcpy(dst + b * depth + n_input, state + b * n_state, n_state * sizeof(float));
+  }
+}
+
+// Computes out[n_batch, n_rows] = in[n_batch, depth] * weights[n_rows, depth]^T + bias, where bias
+// may be nullptr
+inline void RecurrentGemm(const Eigen::ThreadPoolDevice &device, const float *in, int n_batch,
+                          int depth, const float *weights, int n_rows, const float *bias,
+                          float *out)
+{
+  using ConstMatrix =
+      Eigen::TensorMap<Eigen::Tensor<const float, 2, Eigen::RowMajor, Eigen::DenseIndex>>;
+  using Matrix = Eigen::TensorMap<Eigen::Tensor<float, 2, Eigen::RowMajor, Eigen::DenseIndex>>;
+
+  ConstMatrix lhs(in, n_batch, depth);
+  ConstMatrix rhs(weights, n_rows, depth);
+  Matrix result(out, n_batch, n_rows);
+
+  Eigen::array<Eigen::IndexPair<Eigen::DenseIndex>, 1> dim_pair;
+  dim_pair[0] = Eigen::IndexPair<Eigen::DenseIndex>(1, 1);
+  result.device(device) = lhs.contract(rhs, dim_pair);
+
+  if (bias != nullptr)
+  {
+    for (int b = 0; b < n_batch; ++b)
+    {
+      float *out_batch = out + b * n_rows;
+      for (int i = 0; i < n_rows; ++i)
+      {
+        out_batch[i] += bias[i];
+      }
+    }
+  }
+}
+
+// Quantizes each batch of values symmetrically. Returns false if all values are zero, when
+// multiplication with them can be skipped.
+inline bool QuantizeRecurrentInput(const float *values, int n_batch, int size, int8_t *quantized,
+                                   float *scales)
+{
+  if (IsZeroVector(values, n_batch * size))
+  {
+    return false;
+  }
+  float unused_min, unused_max;
+  for (int b = 0; b < n_batch; ++b)
+  {
+    SymmetricQuantizeFloats(values + b * size, size, quantized + b * size, &unused_min,
+                            &unused_max, &scales[b]);
+  }
+  return true;
+}
+
+// Scratch buffers of HybridGateMatMulAccumulate, which are kept by its caller to be reused
+struct HybridGateTempArena
+{
+  std::vector<float> scaling_factors;
+  std::vector<int32_t> accum_scratch;
+};
+
+// Accumulates weights * quantized of each batch into result[n_batch, n_gates * n_unit], where
+// weights of gates are concatenated by ConcatGateWeights and gate_scales are their scales. If all
+// gates share a scale, which is common, the gates are multiplied at once. Otherwise they are
+// multiplied one by one since a scaling factor applies to a whole batch.
+inline void HybridGateMatMulAccumulate(const int8_t *weights, const float *gate_scales,
+                                       int n_gates, int n_unit, int n_src,
+                                       const int8_t *quantized, const float *batch_scales,
+                                       int n_batch, HybridGateTempArena &temp_arena,
+                                       float *result)
+{
+  const int n_rows = n_gates * n_unit;
+  const bool uniform_scale =
+      std::all_of(gate_scales, gate_scales + n_gates,
+                  [gate_scales](float scale) { return scale == gate_scales[0]; });
+  const int n_calls = uniform_scale ? 1 : n_batch * n_gates;
+  temp_arena.scaling_factors.resize(uniform_scale ? n_batch : 1);
+  float *scaling_factors = temp_arena.scaling_factors.data();
+#ifdef USE_RUY_GEMV
+  temp_arena.accum_scratch.resize(uniform_scale ? n_batch * n_rows : n_unit);
+  int32_t *scratch = temp_arena.accum_scratch.data();
+#endif
+
+  for (int call = 0; call < n_calls; ++call)
+  {
+    const int8_t *matrix = weights;
+    int m_rows = n_rows;
+    const int8_t *vectors = quantized;
+    int batches = n_batch;
+    float *dst = result;
+    if (uniform_scale)
+    {
+      for (int b = 0; b < n_batch; ++b)
+      {
+        scaling_factors[b] = batch_scales[b] * gate_scales[0];
+      }
+    }
+    else
+    {
+      const int b = call / n_gates;
+      const int gate = call % n_gates;
+      matrix = weights + gate * n_unit * n_src;
+      m_rows = n_unit;
+      vectors = quantized + b * n_src;
+      batches = 1;
+      dst = result + b * n_rows + gate * n_unit;
+      scaling_factors[0] = batch_scales[b] * gate_scales[gate];
+    }
+#ifdef USE_RUY_GEMV
+    MatrixBatchVectorMultiplyAccumulate(matrix, m_rows, n_src, vectors, scaling_factors, batches,
+                                        scratch, dst, /*result_stride=*/1);
+#else
+    MatrixBatchVectorMultiplyAccumulate(matrix, m_rows, n_src, vectors, scaling_factors, batches,
+                                        dst, /*result_stride=*/1);
+#endif
+  }
+}
+
+// Applies activation to values in place, where tanh and sigmoid are vectorized by Eigen
+inline void ApplyRecurrentActivation(FusedActivationFunctionType activation, float *data,
+                                     int size)
+{
+  Eigen::Map<Eigen::ArrayXf> values(data, size);
+  switch (activation)
+  {
+    case FusedActivationFunctionType::kTanh:
+      values = values.tanh();
+      break;
+    case FusedActivationFunctionType::kSigmoid:
+      values = values.unaryExpr(Eigen::internal::scalar_logistic_op<float>());
+      break;
+    default:
+      ApplyActivationToVector(data, size, activation, data);
+      break;
+  }
+}
+
+inline void ClipVector(float *data, int size, float clip)
+{
+  if (clip > 0.f)
+  {
+    for (int i = 0; i < size; ++i)
+    {
+      data[i] = std::max(-clip, std::min(clip, data[i]));
+    }
+  }
+}
+
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_RECURRENT_H__
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_TRANSPOSE_CONV_H__
+#define __NNFW_CKER_OPTIMIZED_TRANSPOSE_CONV_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/eigen/EigenSupport.h"
+
+#include <algorithm>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+// Reorders a filter of [output_depth, filter_height, filter_width, input_depth] into
+// [filter_height, filter_width, output_depth, input_depth], adding offset to each value. Then a
+// row of col buffer, which is made by GEMM with the filter, keeps output channels contiguous.
+template <typename SrcT, typename DstT>
+inline void TransposeConvReorderFilter(const Shape &filter_shape, const SrcT *filter_data,
+                                       DstT offset, DstT *reordered_data)
+{
+  const int output_depth = filter_shape.Dims(0);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int input_depth = filter_shape.Dims(3);
+
+  for (int out_channel = 0; out_channel < output_depth; ++out_channel)
+  {
+    for (int filter_y = 0; filter_y < filter_height; ++filter_y)
+    {
+      for (int filter_x = 0; filter_x < filter_width; ++filter_x)
+      {
+        const SrcT *src = filter_data + Offset(filter_shape, out_channel, filter_y, filter_x, 0);
+        DstT *dst = reordered_data +
+                    ((filter_y * filter_width + filter_x) * output_depth + out_channel) *
+                        input_depth;
+        for (int in_channel = 0; in_channel < input_depth; ++in_channel)
+        {
+          dst[in_channel] = static_cast<DstT>(src[in_channel]) + offset;
+        }
+      }
+    }
+  }
+}
+
+// Computes col[input pixels, filter_height * filter_width * output_depth] = input * filter^T,
+// where filter is reordered by TransposeConvReorderFilter
+template <typename T>
+inline void TransposeConvGemm(const Eigen::ThreadPoolDevice &device, const T *input_data,
+                              int num_input_pixels, int input_depth, const T *filter_data,
+                              int num_filter_rows, T *col_data)
+{
+  using ConstMatrix =
+      Eigen::TensorMap<Eigen::Tensor<const T, 2, Eigen::RowMajor, Eigen::DenseIndex>>;
+  using Matrix = Eigen::TensorMap<Eigen::Tensor<T, 2, Eigen::RowMajor, Eigen::DenseIndex>>;
+
+  ConstMatrix input(input_data, num_input_pixels, input_depth);
+  ConstMatrix filter(filter_data, num_filter_rows, input_depth);
+  Matrix col(col_data, num_input_pixels, num_filter_rows);
+
+  Eigen::array<Eigen::IndexPair<Eigen::DenseIndex>, 1> dim_pair;
+  dim_pair[0] = Eigen::IndexPair<Eigen::DenseIndex>(1, 1);
+  col.device(device) = input.contract(filter, dim_pair);
+}
+
+// Gathers values of an output row, indexed by (batch * output_height + out_y), from col buffer
+template <typename T>
+inline void TransposeConvCol2ImRow(const TransposeConvParams &params, const Shape &input_shape,
+                                   int filter_height, int filter_width, const Shape &output_shape,
+                                   const T *col_data, int row, T *output_row)
+{
+  const int stride_width = params.stride_width;
+  const int stride_height = params.stride_height;
+  const int pad_width = params.padding_values.width;
+  const int pad_height = params.padding_values.height;
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int output_depth = output_shape.Dims(3);
+  const int col_row_size = filter_height * filter_width * output_depth;
+
+  const int batch = row / output_height;
+  const int out_y = row % output_height;
+
+  std::fill(output_row, output_row + output_width * output_depth, T(0));
+
+  for (int filter_y = 0; filter_y < filter_height; ++filter_y)
+  {
+    // out_y = in_y * stride_height - pad_height + filter_y
+    const int in_y_scaled = out_y + pad_height - filter_y;
+    if (in_y_scaled < 0 || in_y_scaled % stride_height != 0)
+      continue;
+    const int in_y = in_y_scaled / stride_height;
+    if (in_y >= input_height)
+      continue;
+
+    for (int in_x = 0; in_x < input_width; ++in_x)
+    {
+      const T *col_ptr = col_data +
+                         ((batch * input_height + in_y) * input_width + in_x) * col_row_size +
+                         filter_y * filter_width * output_depth;
+      const int out_x_origin = in_x * stride_width - pad_width;
+      for (int filter_x = 0; filter_x < filter_width; ++filter_x)
+      {
+        const int out_x = out_x_origin + filter_x;
+        if (out_x < 0 || out_x >= output_width)
+          continue;
+        const T *src = col_ptr + filter_x * output_depth;
+        T *dst = output_row + out_x * output_depth;
+        for (int out_channel = 0; out_channel < output_depth; ++out_channel)
+        {
+          dst[out_channel] += src[out_channel];
+        }
+      }
+    }
+  }
+}
+
+// Calls fn(row) for output rows in parallel, where fn writes an output row from col buffer
+template <typename Fn>
+inline void TransposeConvForEachRow(const Eigen::ThreadPoolDevice &device,
+                                    const TransposeConvParams &params, int filter_height,
+                                    int filter_width, const Shape &output_shape, size_t elem_size,
+                                    Fn fn)
+{
+  const int num_rows = output_shape.Dims(0) * output_shape.Dims(1);
+  const int output_row_size = output_shape.Dims(2) * output_shape.Dims(3);
+  // Each output value gathers about (filter_height / stride) * (filter_width / stride) values
+  const double values_per_output =
+      std::max(1.0, static_cast<double>(filter_height) / params.stride_height) *
+      std::max(1.0, static_cast<double>(filter_width) / params.stride_width);
+  const Eigen::TensorOpCost row_cost(output_row_size * values_per_output * elem_size,
+                                     output_row_size * elem_size,
+                                     output_row_size * values_per_output);
+
+  device.parallelFor(num_rows, row_cost, [&](Eigen::Index start, Eigen::Index end) {
+    for (Eigen::Index row = start; row < end; ++row)
+    {
+      fn(static_cast<int>(row));
+    }
+  });
+}
+
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_TRANSPOSE_CONV_H__
@@ -95,10 +95,11 @@ inline void BroadcastBinaryArithmeticOpSlow(const BinaryArithmeticOpParam &param
       {
         for (int c = 0; c < extended_output_shape.Dims(3); ++c)
         {
-          output_data[Offset(extended_output_shape, b, y, x, c)] = ActivationFunctionWithMinMax(
+          output_data[Offset(extended_output_shape, b, y, x, c)] = ActivationFunctionWithMinMax<T>(
               fn(input1_data[SubscriptToIndex(desc1, b, y, x, c)],
                  input2_data[SubscriptToIndex(desc2, b, y, x, c)]),
-              params.quantized_activation_min, params.quantized_activation_max);
+              static_cast<T>(params.quantized_activation_min),
+              static_cast<T>(params.quantized_activation_max));
         }
       }
     }
@@ -20,6 +20,7 @@
 
 #include <util/ConfigSource.h>
 #include <ruy/context.h>
+#include "cker/Threading.h"
 #include "cker/Types.h"
 
 namespace
@@ -37,9 +38,11 @@ namespace ruy_support
 struct RuyContext
 {
 public:
-  RuyContext() : ruy_context_(new ruy::Context)
+  RuyContext()
+      : ruy_context_(new ruy::Context),
+        num_threads_config_(onert::util::getConfigInt(onert::util::config::RUY_THREADS))
   {
-    SetMaxNumThreads(onert::util::getConfigInt(onert::util::config::RUY_THREADS));
+    SetMaxNumThreads(num_threads_config_);
 #ifdef USE_RUY_GEMV
     ruy_context_->cache_policy = ruy::kCacheLHSOnNarrowMul;
 #endif
@@ -49,24 +52,33 @@ public:
 
   static inline RuyContext &GetRuyContext()
   {
-    static RuyContext instance;
+    // ruy::Context must not be used by multiple threads at the same time. Give each thread its
+    // own one so that inferences on different threads do not race.
+    static thread_local RuyContext instance;
     return instance;
   }
 
   void SetMaxNumThreads(int max_num_threads)
   {
-    const int target_num_threads =
-        max_num_threads > -1 ? max_num_threads : kDefaultNumThreadpoolThreads;
+    const int target_num_threads = max_num_threads > -1
+                                       ? max_num_threads
+                                       : threading::GetNumThreads(kDefaultNumThreadpoolThreads);
     ruy_context_->max_num_threads = target_num_threads;
   }
 
+  int num_threads_config() const { return num_threads_config_; }
+
 private:
   const std::unique_ptr<ruy::Context> ruy_context_;
+  // RUY_THREADS config. -1 means following the thread budget of the caller
+  const int num_threads_config_;
 };
 
 inline ruy::Context *GetRuyContext()
 {
   auto &ctx = RuyContext::GetRuyContext();
+  // The share of the thread budget changes as kernels on other threads start and finish
+  ctx.SetMaxNumThreads(ctx.num_threads_config());
   return ctx.ruy_context();
 }
 
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TestUtils.h"
+
+#include <cker/operation/BinaryArithmeticOps.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::BinaryArithmeticOpParam;
+using nnfw::cker::BinaryArithmeticOpType;
+using nnfw::cker::Shape;
+using nnfw::cker::test::quantizeMultiplier;
+
+struct QuantInfo
+{
+  float scale;
+  int32_t zero_point;
+};
+
+BinaryArithmeticOpParam quantParams(BinaryArithmeticOpType type, const QuantInfo &input1,
+                                    const QuantInfo &input2, const QuantInfo &output)
+{
+  BinaryArithmeticOpParam params;
+  params.type = type;
+  params.input1_offset = -input1.zero_point;
+  params.input2_offset = -input2.zero_point;
+  params.output_offset = output.zero_point;
+  params.quantized_activation_min = 0;
+  params.quantized_activation_max = 255;
+  if (type == BinaryArithmeticOpType::MUL)
+  {
+    quantizeMultiplier(static_cast<double>(input1.scale) * input2.scale / output.scale,
+                       &params.output_multiplier, &params.output_shift);
+  }
+  else
+  {
+    params.left_shift = 20;
+    const double twice_max_input_scale = 2. * std::max(input1.scale, input2.scale);
+    quantizeMultiplier(input1.scale / twice_max_input_scale, &params.input1_multiplier,
+                       &params.input1_shift);
+    quantizeMultiplier(input2.scale / twice_max_input_scale, &params.input2_multiplier,
+                       &params.input2_shift);
+    quantizeMultiplier(twice_max_input_scale / ((1 << params.left_shift) * output.scale),
+                       &params.output_multiplier, &params.output_shift);
+  }
+  return params;
+}
+
+std::vector<uint8_t> run(BinaryArithmeticOpParam params, const Shape &input1_shape,
+                         const std::vector<uint8_t> &input1, const Shape &input2_shape,
+                         const std::vector<uint8_t> &input2, const Shape &output_shape)
+{
+  std::vector<uint8_t> output(output_shape.FlatSize());
+  if (nnfw::cker::ProcessBroadcastShapes(input1_shape, input2_shape, &params))
+  {
+    nnfw::cker::BroadcastBinaryArithmeticOp(params, input1_shape, input1.data(), input2_shape,
+                                            input2.data(), output_shape, output.data());
+  }
+  else
+  {
+    nnfw::cker::BinaryArithmeticOp(params, input1_shape, input1.data(), input2_shape,
+                                   input2.data(), output_shape, output.data());
+  }
+  return output;
+}
+
+} // namespace
+
+TEST(CKer_Operation, AddQuant8)
+{
+  const Shape shape{1, 2, 2, 1};
+  const auto params = quantParams(BinaryArithmeticOpType::ADD, {2.f, 0}, {1.f, 0}, {1.f, 0});
+  const auto output = run(params, shape, {1, 2, 3, 4}, shape, {3, 4, 5, 6}, shape);
+  EXPECT_EQ(output, (std::vector<uint8_t>{5, 8, 11, 14}));
+}
+
+TEST(CKer_Operation, AddBroadcastQuant8)
+{
+  const auto params = quantParams(BinaryArithmeticOpType::ADD, {2.f, 0}, {1.f, 0}, {1.f, 0});
+  const auto output = run(params, Shape{1, 2}, {1, 2}, Shape{2, 2}, {1, 2, 3, 4}, Shape{2, 2});
+  EXPECT_EQ(output, (std::vector<uint8_t>{3, 6, 5, 8}));
+}
+
+TEST(CKer_Operation, SubQuant8)
+{
+  const Shape shape{1, 2, 2, 1};
+  const auto params = quantParams(BinaryArithmeticOpType::SUB, {1.f, 10}, {0.5f, 0}, {1.f, 0});
+  const auto output = run(params, shape, {20, 30, 40, 50}, shape, {2, 4, 6, 40}, shape);
+  EXPECT_EQ(output, (std::vector<uint8_t>{9, 18, 27, 20}));
+}
+
+TEST(CKer_Operation, MulBroadcastQuant8)
+{
+  const auto params = quantParams(BinaryArithmeticOpType::MUL, {1.f, 0}, {1.f, 0}, {2.f, 0});
+  const auto output = run(params, Shape{1, 2}, {2, 4}, Shape{2, 2}, {1, 2, 4, 8}, Shape{2, 2});
+  EXPECT_EQ(output, (std::vector<uint8_t>{1, 4, 4, 16}));
+}
+
+// Compare all broadcast categories, with sizes which are not multiples of vector length, against
+// float computation of dequantized values
+TEST(CKer_Operation, BroadcastQuant8)
+{
+  const QuantInfo input1_info{0.05f, 120}, input2_info{0.03f, 100};
+  const QuantInfo add_info{0.08f, 128}, mul_info{0.2f, 50};
+  const std::vector<std::pair<Shape, Shape>> shapes = {
+      {Shape{2, 3, 19}, Shape{2, 3, 19}}, {Shape{1, 1, 19}, Shape{2, 3, 19}},
+      {Shape{2, 3, 19}, Shape{1, 3, 1}},  {Shape{2, 1, 19}, Shape{1, 3, 1}},
+      {Shape{1, 1, 1}, Shape{2, 3, 19}},  {Shape{2, 3, 19}, Shape{2, 1, 19}}};
+  nnfw::cker::test::RandomGenerator random;
+  std::uniform_int_distribution<int> dist(0, 255);
+  for (const auto &shape_pair : shapes)
+  {
+    const auto &input1_shape = shape_pair.first;
+    const auto &input2_shape = shape_pair.second;
+    Shape output_shape{std::max(input1_shape.Dims(0), input2_shape.Dims(0)),
+                       std::max(input1_shape.Dims(1), input2_shape.Dims(1)),
+                       std::max(input1_shape.Dims(2), input2_shape.Dims(2))};
+    const auto input1 = random.vector<uint8_t>(input1_shape.FlatSize(), dist);
+    const auto input2 = random.vector<uint8_t>(input2_shape.FlatSize(), dist);
+
+    for (auto type :
+         {BinaryArithmeticOpType::ADD, BinaryArithmeticOpType::SUB, BinaryArithmeticOpType::MUL})
+    {
+      const auto &output_info = (type == BinaryArithmeticOpType::MUL) ? mul_info : add_info;
+      const auto params = quantParams(type, input1_info, input2_info, output_info);
+      const auto output = run(params, input1_shape, input1, input2_shape, input2, output_shape);
+
+      for (int i = 0; i < output_shape.FlatSize(); ++i)
+      {
+        const int d0 = i / (output_shape.Dims(1) * output_shape.Dims(2));
+        const int d1 = i / output_shape.Dims(2) % output_shape.Dims(1);
+        const int d2 = i % output_shape.Dims(2);
+        auto valueOf = [&](const Shape &shape, const std::vector<uint8_t> &data,
+                           const QuantInfo &info) {
+          const int i0 = shape.Dims(0) > 1 ? d0 : 0;
+          const int i1 = shape.Dims(1) > 1 ? d1 : 0;
+          const int i2 = shape.Dims(2) > 1 ? d2 : 0;
+          const int index = (i0 * shape.Dims(1) + i1) * shape.Dims(2) + i2;
+          return info.scale * (data[index] - info.zero_point);
+        };
+        const float a = valueOf(input1_shape, input1, input1_info);
+        const float b = valueOf(input2_shape, input2, input2_info);
+        const float real = (type == BinaryArithmeticOpType::ADD)
+                               ? a + b
+                               : (type == BinaryArithmeticOpType::SUB) ? a - b : a * b;
+        const float expected =
+            std::min(255.f, std::max(0.f, std::round(real / output_info.scale) +
+                                              output_info.zero_point));
+        ASSERT_NEAR(expected, output[i], 1.f) << "type " << static_cast<int>(type) << " at " << i;
+      }
+    }
+  }
+}
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TestUtils.h"
+
+#include <cker/operation/Conv.h>
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::test::ConvTestParam;
+
+// SAME padding, which is given as explicit values for kNone as well
+nnfw::cker::ConvParams makeParams(const ConvTestParam &param,
+                                  nnfw::cker::PaddingType padding_type)
+{
+  using nnfw::cker::test::computeSamePadding;
+  nnfw::cker::ConvParams params;
+  params.padding_type = padding_type;
+  params.padding_values.width =
+      computeSamePadding(param.input_width, param.filter_size, param.stride, param.dilation);
+  params.padding_values.height =
+      computeSamePadding(param.input_height, param.filter_size, param.stride, param.dilation);
+  params.stride_width = param.stride;
+  params.stride_height = param.stride;
+  params.dilation_width_factor = param.dilation;
+  params.dilation_height_factor = param.dilation;
+  return params;
+}
+
+nnfw::cker::Shape inputShape(const ConvTestParam &param)
+{
+  return {param.batches, param.input_height, param.input_width, param.input_depth};
+}
+
+nnfw::cker::Shape filterShape(const ConvTestParam &param)
+{
+  return {param.output_depth, param.filter_size, param.filter_size, param.input_depth};
+}
+
+nnfw::cker::Shape outputShape(const ConvTestParam &param)
+{
+  using nnfw::cker::test::computeSameOutputSize;
+  return {param.batches, computeSameOutputSize(param.input_height, param.stride),
+          computeSameOutputSize(param.input_width, param.stride), param.output_depth};
+}
+
+void verifyConvInt8PerChannel(const ConvTestParam &param)
+{
+  auto params = makeParams(param, nnfw::cker::PaddingType::kSame);
+  params.input_offset = -4;
+  params.output_offset = 9;
+  params.quantized_activation_min = -128;
+  params.quantized_activation_max = 127;
+  params.lhs_cacheable = true;
+  const auto input_shape = inputShape(param);
+  const auto filter_shape = filterShape(param);
+  const nnfw::cker::Shape bias_shape{param.output_depth};
+  const auto output_shape = outputShape(param);
+
+  nnfw::cker::test::RandomGenerator random;
+  std::uniform_int_distribution<int> int8_dist(-128, 127);
+  const auto input = random.vector<int8_t>(input_shape.FlatSize(), int8_dist);
+  const auto filter = random.vector<int8_t>(filter_shape.FlatSize(), int8_dist);
+  const auto bias = random.vector<int32_t>(bias_shape.FlatSize(),
+                                           std::uniform_int_distribution<int32_t>(-20000, 20000));
+  const auto multiplier = random.multipliers(param.output_depth);
+  const auto shift =
+      random.vector<int>(param.output_depth, std::uniform_int_distribution<int>(-12, -8));
+  const int32_t *bias_data = param.has_bias ? bias.data() : nullptr;
+
+  std::vector<int8_t> expected(output_shape.FlatSize());
+  std::vector<int8_t> actual(output_shape.FlatSize());
+  nnfw::cker::reference::ConvPerChannel(params, multiplier.data(), shift.data(), input_shape,
+                                        input.data(), filter_shape, filter.data(), bias_shape,
+                                        bias_data, output_shape, expected.data());
+
+  nnfw::cker::Conv conv;
+  conv.prepareQuant(input_shape, filter_shape, output_shape, param.stride, param.stride);
+  // Run twice so that cached weights are used as well
+  for (int i = 0; i < 2; ++i)
+  {
+    conv(params, multiplier.data(), shift.data(), input_shape, input.data(), filter_shape,
+         filter.data(), bias_shape, bias_data, output_shape, actual.data());
+    // Optimized requantization may round ties differently
+    ASSERT_TRUE(nnfw::cker::test::allNear(expected, actual, 1));
+  }
+}
+
+void verifyConvFp16Weights(const ConvTestParam &param, nnfw::cker::PaddingType padding_type)
+{
+  auto params = makeParams(param, padding_type);
+  params.float_activation_min = -2.0f;
+  params.float_activation_max = 2.0f;
+  const auto input_shape = inputShape(param);
+  const auto filter_shape = filterShape(param);
+  const nnfw::cker::Shape bias_shape{param.output_depth};
+  const auto output_shape = outputShape(param);
+
+  nnfw::cker::test::RandomGenerator random;
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+  const auto input = random.vector<float>(input_shape.FlatSize(), dist);
+  const auto filter =
+      nnfw::cker::test::toFp16(random.vector<float>(filter_shape.FlatSize(), dist));
+  const auto bias = random.vector<float>(bias_shape.FlatSize(), dist);
+  const float *bias_data = param.has_bias ? bias.data() : nullptr;
+
+  // Float kernel with the same weights
+  const auto filter_fp32 = nnfw::cker::test::toFp32(filter);
+  std::vector<float> expected(output_shape.FlatSize());
+  nnfw::cker::reference::Conv(params, input_shape, input.data(), filter_shape, filter_fp32.data(),
+                              bias_shape, bias_data, output_shape, expected.data());
+
+  std::vector<float> actual(output_shape.FlatSize());
+  nnfw::cker::Conv conv;
+  // Run twice so that the conversion scratch left by the first run is reused
+  for (int i = 0; i < 2; ++i)
+  {
+    conv(params, input_shape, input.data(), filter_shape, filter.data(), bias_shape, bias_data,
+         output_shape, actual.data());
+    ASSERT_TRUE(nnfw::cker::test::allNear(expected, actual, 1e-4));
+  }
+}
+
+} // namespace
+
+TEST(CKer_Operation, ConvInt8PerChannel)
+{
+  verifyConvInt8PerChannel({1, 8, 8, 16, 32, 3, 1, 1, true});
+  verifyConvInt8PerChannel({2, 9, 7, 3, 8, 3, 2, 1, false});
+  verifyConvInt8PerChannel({1, 10, 10, 24, 40, 1, 1, 1, true});
+  verifyConvInt8PerChannel({1, 11, 11, 8, 5, 1, 2, 1, true});
+  verifyConvInt8PerChannel({1, 12, 12, 4, 6, 3, 1, 2, false});
+}
+
+TEST(CKer_Operation, ConvFp16Weights)
+{
+  verifyConvFp16Weights({1, 8, 8, 16, 32, 3, 1, 1, true}, nnfw::cker::PaddingType::kSame);
+  verifyConvFp16Weights({2, 9, 7, 3, 8, 3, 2, 1, false}, nnfw::cker::PaddingType::kSame);
+  verifyConvFp16Weights({1, 10, 10, 24, 40, 1, 1, 1, true}, nnfw::cker::PaddingType::kSame);
+  verifyConvFp16Weights({1, 8, 8, 16, 32, 3, 1, 1, true}, nnfw::cker::PaddingType::kNone);
+  verifyConvFp16Weights({1, 12, 12, 4, 6, 3, 1, 2, false}, nnfw::cker::PaddingType::kSame);
+  // Filter of many panels, and output of many tiles
+  verifyConvFp16Weights({2, 21, 17, 64, 80, 3, 1, 1, true}, nnfw::cker::PaddingType::kSame);
+  // Patches so large that tiles have the fewest pixels
+  verifyConvFp16Weights({1, 10, 10, 600, 5, 3, 1, 1, true}, nnfw::cker::PaddingType::kSame);
+}
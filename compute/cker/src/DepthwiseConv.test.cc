@@ -0,0 +1,305 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TestUtils.h"
+
+#include <cker/operation/reference/DepthwiseConv.h>
+#include <cker/operation/optimized/DepthwiseConvFloat.h>
+#include <cker/operation/optimized/DepthwiseConvInt8.h>
+#include <cker/operation/optimized/Fp16Conv.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::test::ConvTestParam;
+
+// SAME-like padding which makes border pixels use only a part of the filter
+int padOf(const ConvTestParam &param) { return (param.filter_size - 1) * param.dilation / 2; }
+
+nnfw::cker::DepthwiseConvParams makeParams(const ConvTestParam &param)
+{
+  nnfw::cker::DepthwiseConvParams params;
+  params.stride_width = param.stride;
+  params.stride_height = param.stride;
+  params.dilation_width_factor = param.dilation;
+  params.dilation_height_factor = param.dilation;
+  params.padding_values.width = padOf(param);
+  params.padding_values.height = padOf(param);
+  params.depth_multiplier = param.output_depth / param.input_depth;
+  return params;
+}
+
+nnfw::cker::Shape inputShape(const ConvTestParam &param)
+{
+  return {param.batches, param.input_height, param.input_width, param.input_depth};
+}
+
+nnfw::cker::Shape filterShape(const ConvTestParam &param)
+{
+  return {1, param.filter_size, param.filter_size, param.output_depth};
+}
+
+nnfw::cker::Shape outputShape(const ConvTestParam &param)
+{
+  using nnfw::cker::test::computeOutputSize;
+  return {param.batches,
+          computeOutputSize(param.input_height, param.filter_size, param.stride, param.dilation,
+                            padOf(param)),
+          computeOutputSize(param.input_width, param.filter_size, param.stride, param.dilation,
+                            padOf(param)),
+          param.output_depth};
+}
+
+void verifyDepthwiseConv(const ConvTestParam &param)
+{
+  auto params = makeParams(param);
+  params.float_activation_min = -1.f;
+  params.float_activation_max = 1.f;
+  const auto input_shape = inputShape(param);
+  const auto filter_shape = filterShape(param);
+  const nnfw::cker::Shape bias_shape{param.output_depth};
+  const auto output_shape = outputShape(param);
+
+  nnfw::cker::test::RandomGenerator random;
+  std::uniform_real_distribution<float> dist(-1.f, 1.f);
+  const auto input = random.vector<float>(input_shape.FlatSize(), dist);
+  const auto filter = random.vector<float>(filter_shape.FlatSize(), dist);
+  const auto bias = random.vector<float>(bias_shape.FlatSize(), dist);
+  const float *bias_data = param.has_bias ? bias.data() : nullptr;
+
+  std::vector<float> expected(output_shape.FlatSize());
+  std::vector<float> actual(output_shape.FlatSize());
+  nnfw::cker::reference::DepthwiseConv(params, input_shape, input.data(), filter_shape,
+                                       filter.data(), bias_shape, bias_data, output_shape,
+                                       expected.data());
+  nnfw::cker::multithreaded::DepthwiseConv(params, input_shape, input.data(), filter_shape,
+                                           filter.data(), bias_shape, bias_data, output_shape,
+                                           actual.data());
+
+  ASSERT_TRUE(nnfw::cker::test::allNear(expected, actual, 1e-5));
+}
+
+void verifyDepthwiseConvFp16Weights(const ConvTestParam &param)
+{
+  auto params = makeParams(param);
+  params.float_activation_min = -1.f;
+  params.float_activation_max = 1.f;
+  const auto input_shape = inputShape(param);
+  const auto filter_shape = filterShape(param);
+  const nnfw::cker::Shape bias_shape{param.output_depth};
+  const auto output_shape = outputShape(param);
+
+  nnfw::cker::test::RandomGenerator random;
+  std::uniform_real_distribution<float> dist(-1.f, 1.f);
+  const auto input = random.vector<float>(input_shape.FlatSize(), dist);
+  const auto filter =
+      nnfw::cker::test::toFp16(random.vector<float>(filter_shape.FlatSize(), dist));
+  const auto bias = random.vector<float>(bias_shape.FlatSize(), dist);
+  const float *bias_data = param.has_bias ? bias.data() : nullptr;
+
+  // Float kernel with the same weights
+  const auto filter_fp32 = nnfw::cker::test::toFp32(filter);
+  std::vector<float> expected(output_shape.FlatSize());
+  std::vector<float> actual(output_shape.FlatSize());
+  nnfw::cker::reference::DepthwiseConv(params, input_shape, input.data(), filter_shape,
+                                       filter_fp32.data(), bias_shape, bias_data, output_shape,
+                                       expected.data());
+  nnfw::cker::multithreaded::Fp16DepthwiseConv(params, input_shape, input.data(), filter_shape,
+                                               filter.data(), bias_shape, bias_data, output_shape,
+                                               actual.data());
+
+  ASSERT_TRUE(nnfw::cker::test::allNear(expected, actual, 1e-5));
+}
+
+void verifyDepthwiseConvInt8(const ConvTestParam &param)
+{
+  auto params = makeParams(param);
+  params.input_offset = 7;
+  params.output_offset = -3;
+  params.quantized_activation_min = -120;
+  params.quantized_activation_max = 127;
+  const auto input_shape = inputShape(param);
+  const auto filter_shape = filterShape(param);
+  const nnfw::cker::Shape bias_shape{param.output_depth};
+  const auto output_shape = outputShape(param);
+
+  nnfw::cker::test::RandomGenerator random;
+  std::uniform_int_distribution<int> int8_dist(-128, 127);
+  const auto input = random.vector<int8_t>(input_shape.FlatSize(), int8_dist);
+  const auto filter = random.vector<int8_t>(filter_shape.FlatSize(), int8_dist);
+  const auto bias = random.vector<int32_t>(bias_shape.FlatSize(),
+                                           std::uniform_int_distribution<int32_t>(-2000, 2000));
+  const auto multiplier = random.multipliers(param.output_depth);
+  const auto shift =
+      random.vector<int>(param.output_depth, std::uniform_int_distribution<int>(-9, -5));
+  const int32_t *bias_data = param.has_bias ? bias.data() : nullptr;
+
+  std::vector<int8_t> expected(output_shape.FlatSize());
+  std::vector<int8_t> actual(output_shape.FlatSize());
+  nnfw::cker::reference::DepthwiseConvPerChannel(
+      params, multiplier.data(), shift.data(), input_shape, input.data(), filter_shape,
+      filter.data(), bias_shape, bias_data, output_shape, expected.data());
+  nnfw::cker::multithreaded::DepthwiseConvPerChannel(
+      params, multiplier.data(), shift.data(), input_shape, input.data(), filter_shape,
+      filter.data(), bias_shape, bias_data, output_shape, actual.data());
+
+  ASSERT_TRUE(nnfw::cker::test::allNear(expected, actual, 0));
+}
+
+// Runs a float depthwise conv quantized to int8 with the filter quantized per channel or per
+// tensor, and returns the mean error of the dequantized output from the float output
+float quantizedDepthwiseConvError(bool per_channel)
+{
+  const int depth = 16;
+  const nnfw::cker::Shape input_shape{1, 8, 8, depth};
+  const nnfw::cker::Shape filter_shape{1, 3, 3, depth};
+  const nnfw::cker::Shape bias_shape{depth};
+  const nnfw::cker::Shape output_shape{1, 8, 8, depth};
+
+  // Ranges of channels of the filter differ by up to 2^7 times, as often in depthwise layers
+  nnfw::cker::test::RandomGenerator random;
+  std::uniform_real_distribution<float> dist(-1.f, 1.f);
+  const auto input = random.vector<float>(input_shape.FlatSize(), dist);
+  auto filter = random.vector<float>(filter_shape.FlatSize(), dist);
+  for (size_t i = 0; i < filter.size(); ++i)
+    filter[i] /= 1 << (i % depth % 8);
+
+  nnfw::cker::DepthwiseConvParams float_params;
+  float_params.stride_width = 1;
+  float_params.stride_height = 1;
+  float_params.dilation_width_factor = 1;
+  float_params.dilation_height_factor = 1;
+  float_params.padding_values.width = 1;
+  float_params.padding_values.height = 1;
+  float_params.depth_multiplier = 1;
+  float_params.float_activation_min = std::numeric_limits<float>::lowest();
+  float_params.float_activation_max = std::numeric_limits<float>::max();
+  std::vector<float> float_output(output_shape.FlatSize());
+  nnfw::cker::reference::DepthwiseConv(float_params, input_shape, input.data(), filter_shape,
+                                       filter.data(), bias_shape, nullptr, output_shape,
+                                       float_output.data());
+
+  // Symmetric scales of filter, and asymmetric ones of input and output
+  std::vector<float> filter_scales(depth);
+  for (int c = 0; c < depth; ++c)
+  {
+    float max_abs = 0.f;
+    for (int i = c; i < filter_shape.FlatSize(); i += depth)
+      max_abs = std::max(max_abs, std::abs(filter[i]));
+    filter_scales[c] = max_abs / 127.f;
+  }
+  if (!per_channel)
+    std::fill(filter_scales.begin(), filter_scales.end(),
+              *std::max_element(filter_scales.begin(), filter_scales.end()));
+  const auto output_minmax = std::minmax_element(float_output.begin(), float_output.end());
+  const float input_scale = 2.f / 255.f;
+  const int32_t input_zero_point = 0;
+  const float output_scale = (*output_minmax.second - *output_minmax.first) / 255.f;
+  const int32_t output_zero_point =
+      -128 - static_cast<int32_t>(std::round(*output_minmax.first / output_scale));
+
+  auto quantize = [](float value, float scale, int32_t zero_point) {
+    const int32_t q = static_cast<int32_t>(std::round(value / scale)) + zero_point;
+    return static_cast<int8_t>(std::min(127, std::max(-128, q)));
+  };
+  std::vector<int8_t> q_input(input.size());
+  std::vector<int8_t> q_filter(filter.size());
+  for (size_t i = 0; i < input.size(); ++i)
+    q_input[i] = quantize(input[i], input_scale, input_zero_point);
+  for (size_t i = 0; i < filter.size(); ++i)
+    q_filter[i] = quantize(filter[i], filter_scales[i % depth], 0);
+
+  std::vector<int32_t> multiplier(depth);
+  std::vector<int> shift(depth);
+  for (int c = 0; c < depth; ++c)
+    nnfw::cker::test::quantizeMultiplier(input_scale * filter_scales[c] / output_scale,
+                                         &multiplier[c], &shift[c]);
+
+  nnfw::cker::DepthwiseConvParams params = float_params;
+  params.input_offset = -input_zero_point;
+  params.output_offset = output_zero_point;
+  params.quantized_activation_min = -128;
+  params.quantized_activation_max = 127;
+  std::vector<int8_t> q_output(output_shape.FlatSize());
+  nnfw::cker::multithreaded::DepthwiseConvPerChannel(
+      params, multiplier.data(), shift.data(), input_shape, q_input.data(), filter_shape,
+      q_filter.data(), bias_shape, nullptr, output_shape, q_output.data());
+
+  float sum_error = 0.f;
+  for (size_t i = 0; i < q_output.size(); ++i)
+  {
+    const float dequantized = (q_output[i] - output_zero_point) * output_scale;
+    sum_error += std::abs(dequantized - float_output[i]);
+  }
+  return sum_error / q_output.size();
+}
+
+} // namespace
+
+TEST(CKer_Operation, DepthwiseConvFloat3x3)
+{
+  // Stride 1 and 2, with depths which are and are not multiple of SIMD width
+  verifyDepthwiseConv({1, 9, 9, 32, 32, 3, 1, 1, true});
+  verifyDepthwiseConv({2, 10, 11, 19, 19, 3, 1, 1, true});
+  verifyDepthwiseConv({1, 9, 9, 32, 32, 3, 2, 1, true});
+  verifyDepthwiseConv({2, 12, 7, 3, 3, 3, 2, 1, false});
+}
+
+TEST(CKer_Operation, DepthwiseConvFloatGeneral)
+{
+  // 5x5 filter, dilation and depth multiplier
+  verifyDepthwiseConv({1, 13, 13, 8, 8, 5, 1, 1, true});
+  verifyDepthwiseConv({1, 13, 13, 8, 8, 3, 1, 2, true});
+  verifyDepthwiseConv({1, 8, 8, 3, 6, 3, 1, 1, true});
+  verifyDepthwiseConv({2, 8, 8, 1, 16, 3, 2, 1, false});
+  verifyDepthwiseConv({1, 5, 5, 6, 30, 3, 3, 1, true});
+}
+
+TEST(CKer_Operation, DepthwiseConvFp16Weights)
+{
+  verifyDepthwiseConvFp16Weights({1, 9, 9, 32, 32, 3, 1, 1, true});
+  verifyDepthwiseConvFp16Weights({2, 10, 11, 19, 19, 3, 2, 1, false});
+  verifyDepthwiseConvFp16Weights({1, 13, 13, 8, 8, 3, 1, 2, true});
+  verifyDepthwiseConvFp16Weights({2, 8, 8, 1, 16, 3, 2, 1, false});
+  // Channels of many blocks
+  verifyDepthwiseConvFp16Weights({1, 6, 6, 1000, 1000, 5, 1, 1, true});
+}
+
+TEST(CKer_Operation, DepthwiseConvInt8PerChannel)
+{
+  verifyDepthwiseConvInt8({1, 9, 9, 32, 32, 3, 1, 1, true});
+  verifyDepthwiseConvInt8({2, 10, 11, 19, 19, 3, 2, 1, false});
+  verifyDepthwiseConvInt8({1, 13, 13, 8, 8, 3, 1, 2, true});
+  verifyDepthwiseConvInt8({1, 8, 8, 3, 6, 3, 1, 1, true});
+  verifyDepthwiseConvInt8({1, 5, 5, 6, 30, 5, 3, 1, false});
+}
+
+TEST(CKer_Operation, DepthwiseConvInt8PerChannelAccuracy)
+{
+  const float per_channel_error = quantizedDepthwiseConvError(true);
+  const float per_tensor_error = quantizedDepthwiseConvError(false);
+  // The error stays below a step of output quantization, which is about 0.02
+  EXPECT_LT(per_channel_error, 0.01f);
+  EXPECT_LT(per_channel_error, per_tensor_error);
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TestUtils.h"
+
+#include <cker/Fp16TensorUtils.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+uint32_t toBits(float f)
+{
+  uint32_t bits;
+  std::memcpy(&bits, &f, sizeof(bits));
+  return bits;
+}
+
+void verifyMatrixBatchVectorMultiplyAccumulate(int m_rows, int m_cols, int n_batch)
+{
+  nnfw::cker::test::RandomGenerator random;
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+  const auto matrix = nnfw::cker::test::toFp16(random.vector<float>(m_rows * m_cols, dist));
+  const auto vectors = random.vector<float>(n_batch * m_cols, dist);
+  auto expected = random.vector<float>(n_batch * m_rows, dist);
+  std::vector<float> actual = expected;
+
+  for (int b = 0; b < n_batch; ++b)
+  {
+    for (int r = 0; r < m_rows; ++r)
+    {
+      double dot = 0.0;
+      for (int c = 0; c < m_cols; ++c)
+        dot += nnfw::cker::Fp16ToFp32(matrix[r * m_cols + c]) * vectors[b * m_cols + c];
+      expected[b * m_rows + r] += static_cast<float>(dot);
+    }
+  }
+
+  nnfw::cker::Fp16MatrixBatchVectorMultiplyAccumulate(matrix.data(), m_rows, m_cols,
+                                                      vectors.data(), n_batch, actual.data());
+  ASSERT_TRUE(nnfw::cker::test::allNear(expected, actual, 1e-4 * m_cols));
+}
+
+} // namespace
+
+TEST(CKer_Utils, Fp16ToFp32)
+{
+  // Every half value
+  std::vector<uint16_t> halfs(1 << 16);
+  for (uint32_t i = 0; i < halfs.size(); ++i)
+    halfs[i] = static_cast<uint16_t>(i);
+  std::vector<float> floats(halfs.size());
+  nnfw::cker::Fp16ToFp32(halfs.data(), floats.data(), static_cast<int>(halfs.size()));
+
+  for (uint32_t i = 0; i < halfs.size(); ++i)
+  {
+    const float scalar = nnfw::cker::Fp16ToFp32(halfs[i]);
+    if (std::isnan(scalar))
+    {
+      ASSERT_TRUE(std::isnan(floats[i])) << "at " << i;
+      continue;
+    }
+    // Vectorized conversion is exact as well
+    ASSERT_EQ(toBits(scalar), toBits(floats[i])) << "at " << i;
+    // Every half is representable as float
+    ASSERT_EQ(halfs[i], nnfw::cker::Fp32ToFp16(scalar)) << "at " << i;
+  }
+
+  EXPECT_EQ(1.0f, nnfw::cker::Fp16ToFp32(0x3c00));
+  EXPECT_EQ(-2.0f, nnfw::cker::Fp16ToFp32(0xc000));
+  EXPECT_EQ(65504.0f, nnfw::cker::Fp16ToFp32(0x7bff));
+  EXPECT_EQ(std::ldexp(1.0f, -24), nnfw::cker::Fp16ToFp32(0x0001));
+  EXPECT_TRUE(std::isinf(nnfw::cker::Fp16ToFp32(0x7c00)));
+}
+
+TEST(CKer_Utils, Fp32ToFp16)
+{
+  // Round to nearest even
+  EXPECT_EQ(0x3c00, nnfw::cker::Fp32ToFp16(1.0f + std::ldexp(1.0f, -11)));
+  EXPECT_EQ(0x3c02, nnfw::cker::Fp32ToFp16(1.0f + 3 * std::ldexp(1.0f, -11)));
+  EXPECT_EQ(0x3c01, nnfw::cker::Fp32ToFp16(1.0f + std::ldexp(1.0f, -11) + std::ldexp(1.0f, -20)));
+  EXPECT_EQ(0x0000, nnfw::cker::Fp32ToFp16(std::ldexp(1.0f, -25)));
+  EXPECT_EQ(0x0001, nnfw::cker::Fp32ToFp16(std::ldexp(1.5f, -25)));
+  // Overflow
+  EXPECT_EQ(0x7bff, nnfw::cker::Fp32ToFp16(65519.0f));
+  EXPECT_EQ(0x7c00, nnfw::cker::Fp32ToFp16(65520.0f));
+  EXPECT_EQ(0xfc00, nnfw::cker::Fp32ToFp16(-1e10f));
+  EXPECT_EQ(0x7e00, nnfw::cker::Fp32ToFp16(std::nanf("")) & 0x7e00);
+}
+
+TEST(CKer_Utils, Fp16MatrixBatchVectorMultiplyAccumulate)
+{
+  verifyMatrixBatchVectorMultiplyAccumulate(16, 64, 1);
+  verifyMatrixBatchVectorMultiplyAccumulate(33, 257, 1);
+  // Multiple panels with a partial last one
+  verifyMatrixBatchVectorMultiplyAccumulate(100, 1000, 3);
+  verifyMatrixBatchVectorMultiplyAccumulate(7, 5000, 2);
+}
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TestUtils.h"
+
+#include <cker/operation/FullyConnected.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+void verifyFullyConnectedUint8(int batches, int accum_depth, int output_depth, bool has_bias)
+{
+  nnfw::cker::FullyConnectedParams params;
+  params.input_offset = -128;
+  params.weights_offset = -120;
+  params.output_offset = 130;
+  // 0.0012345 = 0.632064 * 2^-9
+  params.output_multiplier = 1357347104;
+  params.output_shift = -9;
+  params.quantized_activation_min = 5;
+  params.quantized_activation_max = 250;
+  params.lhs_cacheable = true;
+
+  const nnfw::cker::Shape input_shape{batches, accum_depth};
+  const nnfw::cker::Shape filter_shape{output_depth, accum_depth};
+  const nnfw::cker::Shape bias_shape{output_depth};
+  const nnfw::cker::Shape output_shape{batches, output_depth};
+
+  nnfw::cker::test::RandomGenerator random;
+  std::uniform_int_distribution<int> uint8_dist(0, 255);
+  const auto input = random.vector<uint8_t>(input_shape.FlatSize(), uint8_dist);
+  const auto filter = random.vector<uint8_t>(filter_shape.FlatSize(), uint8_dist);
+  const auto bias = random.vector<int32_t>(bias_shape.FlatSize(),
+                                           std::uniform_int_distribution<int32_t>(-20000, 20000));
+  const int32_t *bias_data = has_bias ? bias.data() : nullptr;
+
+  std::vector<uint8_t> expected(output_shape.FlatSize());
+  std::vector<uint8_t> actual(output_shape.FlatSize());
+  nnfw::cker::reference::FullyConnected(params, input_shape, input.data(), filter_shape,
+                                        filter.data(), bias_shape, bias_data, output_shape,
+                                        expected.data());
+  // Run twice so that cached weights are used as well
+  for (int i = 0; i < 2; ++i)
+  {
+    nnfw::cker::FullyConnected(params, input_shape, input.data(), filter_shape, filter.data(),
+                               bias_shape, bias_data, output_shape, actual.data());
+    // Optimized requantization may round ties differently
+    ASSERT_TRUE(nnfw::cker::test::allNear(expected, actual, 1));
+  }
+}
+
+void verifyFullyConnectedInt8PerChannel(int batches, int accum_depth, int output_depth,
+                                        bool has_bias)
+{
+  nnfw::cker::FullyConnectedParams params;
+  params.input_offset = 5;
+  params.output_offset = -7;
+  params.quantized_activation_min = -128;
+  params.quantized_activation_max = 120;
+  params.lhs_cacheable = true;
+
+  const nnfw::cker::Shape input_shape{batches, accum_depth};
+  const nnfw::cker::Shape filter_shape{output_depth, accum_depth};
+  const nnfw::cker::Shape bias_shape{output_depth};
+  const nnfw::cker::Shape output_shape{batches, output_depth};
+
+  nnfw::cker::test::RandomGenerator random;
+  std::uniform_int_distribution<int> int8_dist(-128, 127);
+  const auto input = random.vector<int8_t>(input_shape.FlatSize(), int8_dist);
+  const auto filter = random.vector<int8_t>(filter_shape.FlatSize(), int8_dist);
+  const auto bias = random.vector<int32_t>(bias_shape.FlatSize(),
+                                           std::uniform_int_distribution<int32_t>(-20000, 20000));
+  const auto multiplier = random.multipliers(output_depth);
+  const auto shift = random.vector<int>(output_depth, std::uniform_int_distribution<int>(-12, -8));
+  const int32_t *bias_data = has_bias ? bias.data() : nullptr;
+
+  std::vector<int8_t> expected(output_shape.FlatSize());
+  std::vector<int8_t> actual(output_shape.FlatSize());
+  nnfw::cker::reference::FullyConnectedPerChannel(
+      params, multiplier.data(), shift.data(), input_shape, input.data(), filter_shape,
+      filter.data(), bias_shape, bias_data, output_shape, expected.data());
+  // Run twice so that cached weights are used as well
+  for (int i = 0; i < 2; ++i)
+  {
+    nnfw::cker::FullyConnectedPerChannel(params, multiplier.data(), shift.data(), input_shape,
+                                         input.data(), filter_shape, filter.data(), bias_shape,
+                                         bias_data, output_shape, actual.data());
+    // Optimized requantization may round ties differently
+    ASSERT_TRUE(nnfw::cker::test::allNear(expected, actual, 1));
+  }
+}
+
+void verifyFullyConnectedFp16Weights(int batches, int accum_depth, int output_depth,
+                                     bool has_bias)
+{
+  nnfw::cker::FullyConnectedParams params;
+  params.activation = nnfw::cker::FusedActivationFunctionType::kRelu;
+
+  const nnfw::cker::Shape input_shape{batches, accum_depth};
+  const nnfw::cker::Shape filter_shape{output_depth, accum_depth};
+  const nnfw::cker::Shape bias_shape{output_depth};
+  const nnfw::cker::Shape output_shape{batches, output_depth};
+
+  nnfw::cker::test::RandomGenerator random;
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+  const auto input = random.vector<float>(input_shape.FlatSize(), dist);
+  const auto filter = random.vector<float>(filter_shape.FlatSize(), dist);
+  const auto bias = random.vector<float>(bias_shape.FlatSize(), dist);
+  const float *bias_data = has_bias ? bias.data() : nullptr;
+
+  const auto filter_fp16 = nnfw::cker::test::toFp16(filter);
+
+  std::vector<float> expected(output_shape.FlatSize());
+  std::vector<float> actual(output_shape.FlatSize());
+  nnfw::cker::FullyConnected(params, input_shape, input.data(), filter_shape, filter.data(),
+                             bias_shape, bias_data, output_shape, expected.data());
+  nnfw::cker::FullyConnected(params, input_shape, input.data(), filter_shape, filter_fp16.data(),
+                             bias_shape, bias_data, output_shape, actual.data());
+  // Each weight has a relative error of 2^-11 at most
+  const float tolerance = accum_depth * std::ldexp(1.0f, -11);
+  ASSERT_TRUE(nnfw::cker::test::allNear(expected, actual, tolerance));
+}
+
+} // namespace
+
+TEST(CKer_Operation, FullyConnectedUint8)
+{
+  verifyFullyConnectedUint8(1, 64, 16, true);
+  verifyFullyConnectedUint8(1, 257, 33, false);
+  verifyFullyConnectedUint8(4, 100, 10, true);
+}
+
+TEST(CKer_Operation, FullyConnectedInt8PerChannel)
+{
+  verifyFullyConnectedInt8PerChannel(1, 64, 16, true);
+  verifyFullyConnectedInt8PerChannel(1, 257, 33, false);
+  verifyFullyConnectedInt8PerChannel(4, 100, 10, true);
+}
+
+TEST(CKer_Operation, FullyConnectedFp16Weights)
+{
+  verifyFullyConnectedFp16Weights(1, 64, 16, true);
+  verifyFullyConnectedFp16Weights(1, 1000, 257, false);
+  verifyFullyConnectedFp16Weights(4, 100, 10, true);
+}
@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TestUtils.h"
+
+#include <cker/operation/LSTM.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+struct LSTMParam
+{
+  int n_batch;
+  int n_input;
+  int n_cell;
+  int n_output;
+  bool use_cifg;
+  bool use_peephole;
+  bool use_projection;
+};
+
+float sigmoid(float x) { return 1.f / (1.f + std::exp(-x)); }
+
+float clip(float x, float threshold)
+{
+  return threshold > 0.f ? std::max(-threshold, std::min(threshold, x)) : x;
+}
+
+// Straightforward LSTM step which computes each gate separately
+void referenceLSTM(const LSTMParam &p, const nnfw::cker::LSTMWeights<float> &w, float cell_clip,
+                   float proj_clip, const float *input, std::vector<float> &output_state,
+                   std::vector<float> &cell_state)
+{
+  using namespace nnfw::cker;
+  std::vector<float> new_output_state(p.n_batch * p.n_output);
+  for (int b = 0; b < p.n_batch; ++b)
+  {
+    const float *x = input + b * p.n_input;
+    const float *h_prev = output_state.data() + b * p.n_output;
+    float *c = cell_state.data() + b * p.n_cell;
+    std::vector<float> hidden(p.n_cell);
+    for (int i = 0; i < p.n_cell; ++i)
+    {
+      float gate[kLSTMNumGates] = {0.f, 0.f, 0.f, 0.f};
+      for (int g = 0; g < kLSTMNumGates; ++g)
+      {
+        if (w.input_to_gate[g] == nullptr)
+          continue;
+        gate[g] = w.gate_bias[g][i];
+        for (int k = 0; k < p.n_input; ++k)
+          gate[g] += w.input_to_gate[g][i * p.n_input + k] * x[k];
+        for (int k = 0; k < p.n_output; ++k)
+          gate[g] += w.recurrent_to_gate[g][i * p.n_output + k] * h_prev[k];
+      }
+      if (w.cell_to_gate[kLSTMInputGate])
+        gate[kLSTMInputGate] += w.cell_to_gate[kLSTMInputGate][i] * c[i];
+      if (w.cell_to_gate[kLSTMForgetGate])
+        gate[kLSTMForgetGate] += w.cell_to_gate[kLSTMForgetGate][i] * c[i];
+      const float f = sigmoid(gate[kLSTMForgetGate]);
+      const float in = p.use_cifg ? 1.f - f : sigmoid(gate[kLSTMInputGate]);
+      c[i] = clip(f * c[i] + in * std::tanh(gate[kLSTMCellGate]), cell_clip);
+      if (w.cell_to_gate[kLSTMOutputGate])
+        gate[kLSTMOutputGate] += w.cell_to_gate[kLSTMOutputGate][i] * c[i];
+      hidden[i] = sigmoid(gate[kLSTMOutputGate]) * std::tanh(c[i]);
+    }
+    for (int o = 0; o < p.n_output; ++o)
+    {
+      if (w.projection)
+      {
+        float acc = w.projection_bias ? w.projection_bias[o] : 0.f;
+        for (int i = 0; i < p.n_cell; ++i)
+          acc += w.projection[o * p.n_cell + i] * hidden[i];
+        new_output_state[b * p.n_output + o] = clip(acc, proj_clip);
+      }
+      else
+      {
+        new_output_state[b * p.n_output + o] = hidden[o];
+      }
+    }
+  }
+  output_state = new_output_state;
+}
+
+class LSTMData
+{
+public:
+  explicit LSTMData(const LSTMParam &p) : _dist(-0.5f, 0.5f)
+  {
+    using namespace nnfw::cker;
+    for (int g = 0; g < kLSTMNumGates; ++g)
+    {
+      const bool present = (g != kLSTMInputGate || !p.use_cifg);
+      _input_to_gate[g] = present ? random(p.n_cell * p.n_input) : std::vector<float>{};
+      _recurrent_to_gate[g] = present ? random(p.n_cell * p.n_output) : std::vector<float>{};
+      _bias[g] = present ? random(p.n_cell) : std::vector<float>{};
+      _cell_to_gate[g] = (present && p.use_peephole && g != kLSTMCellGate) ? random(p.n_cell)
+                                                                          : std::vector<float>{};
+    }
+    if (p.use_projection)
+    {
+      _projection = random(p.n_output * p.n_cell);
+      _projection_bias = random(p.n_output);
+    }
+
+    for (int g = 0; g < kLSTMNumGates; ++g)
+    {
+      weights.input_to_gate[g] = ptr(_input_to_gate[g]);
+      weights.recurrent_to_gate[g] = ptr(_recurrent_to_gate[g]);
+      weights.cell_to_gate[g] = ptr(_cell_to_gate[g]);
+      weights.gate_bias[g] = ptr(_bias[g]);
+    }
+    weights.projection = ptr(_projection);
+    weights.projection_bias = ptr(_projection_bias);
+  }
+
+  std::vector<float> random(int size) { return _random.vector<float>(size, _dist); }
+
+  nnfw::cker::LSTMWeights<float> weights;
+
+private:
+  static const float *ptr(const std::vector<float> &v) { return v.empty() ? nullptr : v.data(); }
+
+  nnfw::cker::test::RandomGenerator _random;
+  std::uniform_real_distribution<float> _dist;
+  std::vector<float> _input_to_gate[nnfw::cker::kLSTMNumGates];
+  std::vector<float> _recurrent_to_gate[nnfw::cker::kLSTMNumGates];
+  std::vector<float> _cell_to_gate[nnfw::cker::kLSTMNumGates];
+  std::vector<float> _bias[nnfw::cker::kLSTMNumGates];
+  std::vector<float> _projection;
+  std::vector<float> _projection_bias;
+};
+
+void verifyLSTM(const LSTMParam &p, bool prepare)
+{
+  LSTMData data(p);
+  nnfw::cker::LSTMParams params;
+  params.activation = nnfw::cker::FusedActivationFunctionType::kTanh;
+  params.cell_clip = 0.8f;
+  params.proj_clip = p.use_projection ? 0.3f : 0.f;
+
+  nnfw::cker::LSTM lstm;
+  if (prepare)
+    lstm.prepare(data.weights, p.n_input, p.n_cell, p.n_output);
+
+  const int n_gates = p.use_cifg ? 3 : 4;
+  std::vector<float> expected_output_state(p.n_batch * p.n_output, 0.f);
+  std::vector<float> expected_cell_state(p.n_batch * p.n_cell, 0.f);
+  // States are updated in place as the cpu backend does for recurrent models
+  std::vector<float> output_state(expected_output_state);
+  std::vector<float> cell_state(expected_cell_state);
+  std::vector<float> scratch(p.n_batch * p.n_cell * n_gates);
+  std::vector<float> output(p.n_batch * p.n_output);
+
+  for (int step = 0; step < 3; ++step)
+  {
+    const auto input = data.random(p.n_batch * p.n_input);
+    referenceLSTM(p, data.weights, params.cell_clip, params.proj_clip, input.data(),
+                  expected_output_state, expected_cell_state);
+    lstm(params, data.weights, p.n_batch, p.n_input, p.n_cell, p.n_output, input.data(),
+         output_state.data(), cell_state.data(), scratch.data(), output_state.data(),
+         cell_state.data(), output.data());
+
+    for (size_t i = 0; i < expected_cell_state.size(); ++i)
+      ASSERT_NEAR(expected_cell_state[i], cell_state[i], 1e-5f) << "at " << i;
+    for (size_t i = 0; i < expected_output_state.size(); ++i)
+    {
+      ASSERT_NEAR(expected_output_state[i], output_state[i], 1e-5f) << "at " << i;
+      ASSERT_EQ(output_state[i], output[i]);
+    }
+  }
+}
+
+} // namespace
+
+TEST(CKer_Operation, LSTMFloat)
+{
+  verifyLSTM({1, 5, 4, 4, false, false, false}, false);
+  verifyLSTM({2, 5, 4, 4, false, false, false}, true);
+  verifyLSTM({2, 3, 8, 8, true, true, false}, true);
+  verifyLSTM({3, 7, 20, 16, false, true, true}, false);
+  verifyLSTM({2, 7, 20, 16, true, false, true}, true);
+}
+
+TEST(CKer_Operation, LSTMHybrid)
+{
+  using namespace nnfw::cker;
+  const LSTMParam p{2, 6, 8, 5, false, true, true};
+  LSTMData data(p);
+  LSTMParams params;
+  params.activation = FusedActivationFunctionType::kTanh;
+  params.cell_clip = 0.f;
+  params.proj_clip = 0.f;
+
+  // Quantize weights, with a different scale for the forget gate to test the unfused path too
+  std::vector<std::vector<int8_t>> storage;
+  std::vector<std::vector<float>> dequantized;
+  auto quantize = [&](const float *values, int size, float scale, float *out_scale) {
+    if (values == nullptr)
+      return std::make_pair<const int8_t *, const float *>(nullptr, nullptr);
+    storage.emplace_back(size);
+    dequantized.emplace_back(size);
+    for (int i = 0; i < size; ++i)
+    {
+      const int q = static_cast<int>(std::round(values[i] / scale));
+      storage.back()[i] = static_cast<int8_t>(std::max(-127, std::min(127, q)));
+      dequantized.back()[i] = storage.back()[i] * scale;
+    }
+    *out_scale = scale;
+    return std::make_pair<const int8_t *, const float *>(storage.back().data(),
+                                                         dequantized.back().data());
+  };
+  storage.reserve(32);
+  dequantized.reserve(32);
+
+  LSTMWeights<int8_t> hybrid;
+  LSTMWeights<float> reference = data.weights;
+  for (int g = 0; g < kLSTMNumGates; ++g)
+  {
+    const float scale = (g == kLSTMForgetGate) ? 0.5f / 100 : 0.5f / 127;
+    auto in = quantize(data.weights.input_to_gate[g], p.n_cell * p.n_input, scale,
+                       &hybrid.input_to_gate_scale[g]);
+    auto rec = quantize(data.weights.recurrent_to_gate[g], p.n_cell * p.n_output, 0.5f / 127,
+                        &hybrid.recurrent_to_gate_scale[g]);
+    auto peep = quantize(data.weights.cell_to_gate[g], p.n_cell, 0.5f / 127,
+                         &hybrid.cell_to_gate_scale[g]);
+    hybrid.input_to_gate[g] = in.first;
+    hybrid.recurrent_to_gate[g] = rec.first;
+    hybrid.cell_to_gate[g] = peep.first;
+    hybrid.gate_bias[g] = data.weights.gate_bias[g];
+    reference.input_to_gate[g] = in.second;
+    reference.recurrent_to_gate[g] = rec.second;
+    reference.cell_to_gate[g] = peep.second;
+  }
+  auto proj = quantize(data.weights.projection, p.n_output * p.n_cell, 0.5f / 127,
+                       &hybrid.projection_scale);
+  hybrid.projection = proj.first;
+  hybrid.projection_bias = data.weights.projection_bias;
+  reference.projection = proj.second;
+
+  LSTM lstm;
+  lstm.prepare(hybrid, p.n_input, p.n_cell, p.n_output);
+  std::vector<float> expected_output_state(p.n_batch * p.n_output, 0.f);
+  std::vector<float> expected_cell_state(p.n_batch * p.n_cell, 0.f);
+  std::vector<float> output_state(expected_output_state);
+  std::vector<float> cell_state(expected_cell_state);
+  std::vector<float> scratch(p.n_batch * p.n_cell * 4);
+  std::vector<float> output(p.n_batch * p.n_output);
+  for (int step = 0; step < 3; ++step)
+  {
+    const auto input = data.random(p.n_batch * p.n_input);
+    referenceLSTM(p, reference, 0.f, 0.f, input.data(), expected_output_state,
+                  expected_cell_state);
+    lstm(params, hybrid, p.n_batch, p.n_input, p.n_cell, p.n_output, input.data(),
+         output_state.data(), cell_state.data(), scratch.data(), output_state.data(),
+         cell_state.data(), output.data());
+
+    // Inputs are quantized as well, so results are close only up to quantization error
+    for (size_t i = 0; i < expected_output_state.size(); ++i)
+      ASSERT_NEAR(expected_output_state[i], output[i], 2e-2f) << "at " << i;
+  }
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TestUtils.h"
+
+#include <cker/operation/RNN.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+void referenceRNN(int n_batch, int n_input, int n_unit, const float *input, const float *weights,
+                  const float *recurrent_weights, const float *bias, std::vector<float> &state)
+{
+  std::vector<float> new_state(state.size());
+  for (int b = 0; b < n_batch; ++b)
+  {
+    for (int u = 0; u < n_unit; ++u)
+    {
+      float acc = bias[u];
+      for (int i = 0; i < n_input; ++i)
+        acc += weights[u * n_input + i] * input[b * n_input + i];
+      for (int i = 0; i < n_unit; ++i)
+        acc += recurrent_weights[u * n_unit + i] * state[b * n_unit + i];
+      new_state[b * n_unit + u] = std::max(0.f, acc);
+    }
+  }
+  state = new_state;
+}
+
+} // namespace
+
+TEST(CKer_Operation, RNNFloat)
+{
+  const int n_batch = 2, n_input = 7, n_unit = 16;
+  nnfw::cker::test::RandomGenerator random;
+  std::uniform_real_distribution<float> dist(-0.5f, 0.5f);
+  const auto weights = random.vector<float>(n_unit * n_input, dist);
+  const auto recurrent_weights = random.vector<float>(n_unit * n_unit, dist);
+  const auto bias = random.vector<float>(n_unit, dist);
+
+  nnfw::cker::RNNParams params;
+  params.activation = nnfw::cker::FusedActivationFunctionType::kRelu;
+  for (bool prepare : {false, true})
+  {
+    nnfw::cker::RNN rnn;
+    if (prepare)
+      rnn.prepare(weights.data(), recurrent_weights.data(), n_input, n_unit);
+
+    std::vector<float> expected(n_batch * n_unit, 0.f);
+    std::vector<float> state(expected);
+    std::vector<float> output(expected.size());
+    for (int step = 0; step < 3; ++step)
+    {
+      const auto input = random.vector<float>(n_batch * n_input, dist);
+      referenceRNN(n_batch, n_input, n_unit, input.data(), weights.data(),
+                   recurrent_weights.data(), bias.data(), expected);
+      rnn(params, n_batch, n_input, n_unit, input.data(), weights.data(),
+          recurrent_weights.data(), bias.data(), state.data(), state.data(), output.data());
+      for (size_t i = 0; i < expected.size(); ++i)
+      {
+        ASSERT_NEAR(expected[i], state[i], 1e-5f) << "at " << i;
+        ASSERT_EQ(state[i], output[i]);
+      }
+    }
+  }
+}
+
+TEST(CKer_Operation, RNNHybrid)
+{
+  const int n_batch = 2, n_input = 7, n_unit = 16;
+  const float scale = 0.5f / 127;
+  nnfw::cker::test::RandomGenerator random;
+  std::uniform_real_distribution<float> dist(-0.5f, 0.5f);
+  auto weights = random.vector<float>(n_unit * n_input, dist);
+  auto recurrent_weights = random.vector<float>(n_unit * n_unit, dist);
+  const auto bias = random.vector<float>(n_unit, dist);
+  auto quantize = [&](std::vector<float> &values) {
+    std::vector<int8_t> quantized(values.size());
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+      quantized[i] = static_cast<int8_t>(std::round(values[i] / scale));
+      values[i] = quantized[i] * scale;
+    }
+    return quantized;
+  };
+  const auto weights_quant = quantize(weights);
+  const auto recurrent_weights_quant = quantize(recurrent_weights);
+
+  nnfw::cker::RNNParams params;
+  params.activation = nnfw::cker::FusedActivationFunctionType::kRelu;
+  nnfw::cker::RNN rnn;
+  std::vector<float> expected(n_batch * n_unit, 0.f);
+  std::vector<float> state(expected);
+  std::vector<float> output(expected.size());
+  for (int step = 0; step < 3; ++step)
+  {
+    const auto input = random.vector<float>(n_batch * n_input, dist);
+    referenceRNN(n_batch, n_input, n_unit, input.data(), weights.data(),
+                 recurrent_weights.data(), bias.data(), expected);
+    rnn(params, n_batch, n_input, n_unit, input.data(), weights_quant.data(), scale,
+        recurrent_weights_quant.data(), scale, bias.data(), state.data(), state.data(),
+        output.data());
+    for (size_t i = 0; i < expected.size(); ++i)
+      ASSERT_NEAR(expected[i], output[i], 2e-2f) << "at " << i;
+  }
+}
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_TEST_UTILS_H__
+#define __NNFW_CKER_TEST_UTILS_H__
+
+#include <cker/Fp16TensorUtils.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace test
+{
+
+// Parameters of Conv, DepthwiseConv and TransposeConv on NHWC tensors with square filters
+struct ConvTestParam
+{
+  int batches;
+  int input_height;
+  int input_width;
+  int input_depth;
+  int output_depth;
+  int filter_size;
+  int stride;
+  int dilation;
+  bool has_bias;
+  // Explicit padding of TransposeConv, as the others are run with SAME padding
+  int pad = 0;
+};
+
+inline int computeOutputSize(int input_size, int filter_size, int stride, int dilation, int pad)
+{
+  const int effective_filter_size = (filter_size - 1) * dilation + 1;
+  return (input_size + 2 * pad - effective_filter_size) / stride + 1;
+}
+
+inline int computeTransposeConvOutputSize(int input_size, int filter_size, int stride, int pad)
+{
+  return (input_size - 1) * stride + filter_size - 2 * pad;
+}
+
+inline int computeSameOutputSize(int input_size, int stride)
+{
+  return (input_size + stride - 1) / stride;
+}
+
+inline int computeSamePadding(int input_size, int filter_size, int stride, int dilation)
+{
+  const int effective_filter_size = (filter_size - 1) * dilation + 1;
+  const int output_size = computeSameOutputSize(input_size, stride);
+  return std::max(0, ((output_size - 1) * stride + effective_filter_size - input_size) / 2);
+}
+
+// Same as QuantizeMultiplier of the cpu backend
+inline void quantizeMultiplier(double double_multiplier, int32_t *quantized_multiplier, int *shift)
+{
+  if (double_multiplier == 0.)
+  {
+    *quantized_multiplier = 0;
+    *shift = 0;
+    return;
+  }
+  const double q = std::frexp(double_multiplier, shift);
+  auto q_fixed = static_cast<int64_t>(std::round(q * (1ll << 31)));
+  if (q_fixed == (1ll << 31))
+  {
+    q_fixed /= 2;
+    ++*shift;
+  }
+  *quantized_multiplier = static_cast<int32_t>(q_fixed);
+}
+
+// Generator of random test data, which starts from the same seed so that failures reproduce
+class RandomGenerator
+{
+public:
+  template <typename T, typename Dist> std::vector<T> vector(int size, Dist &&dist)
+  {
+    std::vector<T> v(size);
+    for (auto &e : v)
+      e = static_cast<T>(dist(_gen));
+    return v;
+  }
+
+  // Quantized multipliers of per-channel requantization, which represent [0.5, 1)
+  std::vector<int32_t> multipliers(int size)
+  {
+    return vector<int32_t>(size, std::uniform_int_distribution<int32_t>(1 << 30, (1ll << 31) - 1));
+  }
+
+private:
+  std::mt19937 _gen{0};
+};
+
+inline std::vector<uint16_t> toFp16(const std::vector<float> &v)
+{
+  std::vector<uint16_t> fp16(v.size());
+  Fp32ToFp16(v.data(), fp16.data(), static_cast<int>(v.size()));
+  return fp16;
+}
+
+inline std::vector<float> toFp32(const std::vector<uint16_t> &v)
+{
+  std::vector<float> fp32(v.size());
+  Fp16ToFp32(v.data(), fp32.data(), static_cast<int>(v.size()));
+  return fp32;
+}
+
+// Checks actual values element-wise against expected ones, e.g. ASSERT_TRUE(allNear(...))
+template <typename T>
+::testing::AssertionResult allNear(const std::vector<T> &expected, const std::vector<T> &actual,
+                                   double tolerance)
+{
+  if (expected.size() != actual.size())
+    return ::testing::AssertionFailure()
+           << "size " << actual.size() << " differs from " << expected.size();
+  for (size_t i = 0; i < expected.size(); ++i)
+  {
+    if (std::abs(static_cast<double>(expected[i]) - static_cast<double>(actual[i])) > tolerance)
+      return ::testing::AssertionFailure() << "expected " << +expected[i] << " but "
+                                           << +actual[i] << " at " << i;
+  }
+  return ::testing::AssertionSuccess();
+}
+
+} // namespace test
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_TEST_UTILS_H__
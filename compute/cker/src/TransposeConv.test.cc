@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TestUtils.h"
+
+#include <cker/operation/TransposeConv.h>
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::test::ConvTestParam;
+
+nnfw::cker::TransposeConvParams makeParams(const ConvTestParam &param)
+{
+  nnfw::cker::TransposeConvParams params;
+  params.padding_values.width = param.pad;
+  params.padding_values.height = param.pad;
+  params.stride_width = param.stride;
+  params.stride_height = param.stride;
+  params.dilation_width_factor = 1;
+  params.dilation_height_factor = 1;
+  return params;
+}
+
+nnfw::cker::Shape inputShape(const ConvTestParam &param)
+{
+  return {param.batches, param.input_height, param.input_width, param.input_depth};
+}
+
+nnfw::cker::Shape filterShape(const ConvTestParam &param)
+{
+  return {param.output_depth, param.filter_size, param.filter_size, param.input_depth};
+}
+
+nnfw::cker::Shape outputShape(const ConvTestParam &param)
+{
+  using nnfw::cker::test::computeTransposeConvOutputSize;
+  return {param.batches,
+          computeTransposeConvOutputSize(param.input_height, param.filter_size, param.stride,
+                                         param.pad),
+          computeTransposeConvOutputSize(param.input_width, param.filter_size, param.stride,
+                                         param.pad),
+          param.output_depth};
+}
+
+void verifyTransposeConvFloat(const ConvTestParam &param, bool prepare)
+{
+  const auto params = makeParams(param);
+  const auto input_shape = inputShape(param);
+  const auto filter_shape = filterShape(param);
+  const auto output_shape = outputShape(param);
+
+  nnfw::cker::test::RandomGenerator random;
+  std::uniform_real_distribution<float> dist(-1.f, 1.f);
+  const auto input = random.vector<float>(input_shape.FlatSize(), dist);
+  const auto filter = random.vector<float>(filter_shape.FlatSize(), dist);
+
+  std::vector<float> expected(output_shape.FlatSize());
+  std::vector<float> actual(output_shape.FlatSize());
+  nnfw::cker::reference::TransposeConv(params, input_shape, input.data(), filter_shape,
+                                       filter.data(), output_shape, expected.data());
+
+  nnfw::cker::TransposeConv kernel;
+  if (prepare)
+    kernel.prepare(filter_shape, filter.data());
+  kernel(params, input_shape, input.data(), filter_shape, filter.data(), output_shape,
+         actual.data());
+
+  ASSERT_TRUE(nnfw::cker::test::allNear(expected, actual, 1e-4));
+}
+
+void verifyTransposeConvUint8(const ConvTestParam &param, bool prepare)
+{
+  auto params = makeParams(param);
+  params.input_offset = -128;
+  params.weights_offset = -120;
+  params.output_offset = 130;
+  // 0.0012345 = 0.632064 * 2^-9
+  params.output_multiplier = 1357347104;
+  params.output_shift = -9;
+  params.quantized_activation_min = 5;
+  params.quantized_activation_max = 250;
+  const auto input_shape = inputShape(param);
+  const auto filter_shape = filterShape(param);
+  const auto output_shape = outputShape(param);
+
+  nnfw::cker::test::RandomGenerator random;
+  std::uniform_int_distribution<int> dist(0, 255);
+  const auto input = random.vector<uint8_t>(input_shape.FlatSize(), dist);
+  const auto filter = random.vector<uint8_t>(filter_shape.FlatSize(), dist);
+
+  std::vector<uint8_t> expected(output_shape.FlatSize());
+  std::vector<uint8_t> actual(output_shape.FlatSize());
+  nnfw::cker::reference::TransposeConv(params, input_shape, input.data(), filter_shape,
+                                       filter.data(), output_shape, expected.data());
+
+  nnfw::cker::TransposeConv kernel;
+  if (prepare)
+    kernel.prepareQuant(filter_shape, filter.data(), params.weights_offset);
+  kernel(params, input_shape, input.data(), filter_shape, filter.data(), output_shape,
+         actual.data());
+
+  // Integer arithmetic is exact, so results are the same as reference
+  ASSERT_TRUE(nnfw::cker::test::allNear(expected, actual, 0));
+}
+
+const std::vector<ConvTestParam> kParams = {
+    // Strides smaller than, equal to and larger than the filter, with and without padding
+    {1, 4, 4, 1, 1, 3, 1, 1, false, 1},  {1, 2, 2, 1, 2, 3, 2, 1, false, 0},
+    {2, 5, 7, 8, 16, 3, 2, 1, false, 1}, {1, 6, 6, 17, 5, 4, 2, 1, false, 1},
+    {1, 3, 5, 4, 3, 2, 3, 1, false, 0},  {2, 8, 8, 32, 9, 5, 1, 1, false, 2},
+};
+
+} // namespace
+
+TEST(CKer_Operation, TransposeConvFloat)
+{
+  for (const auto &param : kParams)
+  {
+    verifyTransposeConvFloat(param, false);
+    verifyTransposeConvFloat(param, true);
+  }
+}
+
+TEST(CKer_Operation, TransposeConvUint8)
+{
+  for (const auto &param : kParams)
+  {
+    verifyTransposeConvUint8(param, false);
+    verifyTransposeConvUint8(param, true);
+  }
+}
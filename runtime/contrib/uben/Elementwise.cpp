@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Elementwise benchmark
+ *
+ * Measures per-operation dispatch overhead of cpu kernels on a model which is a long chain of
+ * tiny Add/Mul operations, so that setting up shapes and parameters of each kernel dominates the
+ * computation. Divide the reported time by OPS to get the overhead of an operation.
+ */
+
+#define NONIUS_RUNNER
+#include <nonius/nonius_single.h++>
+
+#include <compiler/Compiler.h>
+#include <exec/Execution.h>
+#include <ir/Graph.h>
+#include <ir/operation/Add.h>
+#include <ir/operation/Mul.h>
+
+#include <memory>
+#include <vector>
+
+//
+// Parameters
+//
+NONIUS_PARAM(OPS, 256);
+NONIUS_PARAM(LEN, 16);
+
+namespace
+{
+
+using namespace onert::ir;
+
+std::shared_ptr<onert::exec::ExecutorMap> compile(uint32_t ops, int32_t len, bool broadcast,
+                                                   std::vector<float> &rhs_data)
+{
+  // Model: a chain of `ops` elementwise operations, alternating Add and Mul
+  // model input: x_0
+  // model output: x_{ops}
+  // x_{i+1} <= relu(x_i + rhs) or relu(x_i * rhs) where rhs is constant
+  //
+  // With broadcast, rhs is a [1, 1] tensor broadcasted to [1, len]
+  auto graph = std::make_shared<Graph>();
+
+  Shape shape{1, len};
+  Shape rhs_shape = broadcast ? Shape{1, 1} : shape;
+  TypeInfo type{DataType::FLOAT32};
+
+  rhs_data.resize(broadcast ? 1 : len, 1.0f);
+
+  auto rhs = graph->addOperand(rhs_shape, type);
+  graph->operands().at(rhs).data(std::make_unique<ExternalData>(
+      reinterpret_cast<const uint8_t *>(rhs_data.data()), rhs_data.size() * sizeof(float)));
+
+  auto x = graph->addOperand(shape, type);
+  graph->addInput(x);
+
+  for (uint32_t i = 0; i < ops; ++i)
+  {
+    auto result = graph->addOperand(shape, type);
+    if (i % 2 == 0)
+    {
+      operation::Add::Param param;
+      param.activation = Activation::RELU;
+      graph->addOperation(std::make_unique<operation::Add>(OperandIndexSequence{x, rhs},
+                                                           OperandIndexSequence{result}, param));
+    }
+    else
+    {
+      operation::Mul::Param param;
+      param.activation = Activation::RELU;
+      graph->addOperation(std::make_unique<operation::Mul>(OperandIndexSequence{x, rhs},
+                                                           OperandIndexSequence{result}, param));
+    }
+    x = result;
+  }
+  graph->addOutput(x);
+  graph->finishBuilding();
+
+  auto subgs = std::make_shared<Subgraphs>();
+  subgs->push(SubgraphIndex{0}, graph);
+
+  onert::compiler::Compiler compiler{subgs};
+  compiler.options().backend_list = {"cpu"};
+  compiler.options().executor = "Linear";
+  compiler.compile();
+
+  std::shared_ptr<onert::exec::ExecutorMap> executors;
+  compiler.release(executors);
+  return executors;
+}
+
+void run(bool broadcast, nonius::chronometer &meter)
+{
+  const uint32_t ops = meter.param<OPS>();
+  const int32_t len = meter.param<LEN>();
+
+  std::vector<float> rhs;
+  auto executors = compile(ops, len, broadcast, rhs);
+
+  std::vector<float> input(len);
+  std::vector<float> output(len);
+
+  onert::exec::Execution execution{executors};
+  execution.setInput(IOIndex{0}, input.data(), input.size() * sizeof(float));
+  execution.setOutput(IOIndex{0}, output.data(), output.size() * sizeof(float));
+
+  meter.measure([&](int) {
+    // Run!
+    execution.execute();
+  });
+}
+
+} // namespace
+
+//
+// Implementations
+//
+NONIUS_BENCHMARK("Elementwise", [](nonius::chronometer meter) { run(false, meter); })
+
+NONIUS_BENCHMARK("Broadcast", [](nonius::chronometer meter) { run(true, meter); })
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Executor benchmark
+ *
+ * Measures per-inference overhead of onert executors on a model with many independent branches
+ * of tiny Add operations, so that the scheduling cost dominates the computation.
+ */
+
+#define NONIUS_RUNNER
+#include <nonius/nonius_single.h++>
+
+#include <compiler/Compiler.h>
+#include <exec/Execution.h>
+#include <ir/Graph.h>
+#include <ir/operation/Add.h>
+
+#include <memory>
+#include <vector>
+
+//
+// Parameters
+//
+NONIUS_PARAM(BRANCHES, 16);
+NONIUS_PARAM(LEN, 16);
+
+namespace
+{
+
+using namespace onert::ir;
+
+std::shared_ptr<onert::exec::ExecutorMap> compile(const std::string &executor, uint32_t branches,
+                                                   int32_t len, std::vector<float> &rhs_data)
+{
+  // Model: `branches` independent elementwise add operations sharing the same input
+  // model input: lhs
+  // model output: result_0 ... result_{branches - 1}
+  // result_i <= (lhs + rhs) where rhs is constant
+  auto graph = std::make_shared<Graph>();
+
+  Shape shape{1, len};
+  TypeInfo type{DataType::FLOAT32};
+
+  rhs_data.resize(len, 1.0f);
+
+  auto lhs = graph->addOperand(shape, type);
+  graph->addInput(lhs);
+
+  for (uint32_t i = 0; i < branches; ++i)
+  {
+    auto rhs = graph->addOperand(shape, type);
+    graph->operands().at(rhs).data(std::make_unique<ExternalData>(
+        reinterpret_cast<const uint8_t *>(rhs_data.data()), rhs_data.size() * sizeof(float)));
+    auto result = graph->addOperand(shape, type);
+
+    operation::Add::Param param;
+    param.activation = Activation::NONE;
+    graph->addOperation(std::make_unique<operation::Add>(OperandIndexSequence{lhs, rhs},
+                                                         OperandIndexSequence{result}, param));
+    graph->addOutput(result);
+  }
+  graph->finishBuilding();
+
+  auto subgs = std::make_shared<Subgraphs>();
+  subgs->push(SubgraphIndex{0}, graph);
+
+  onert::compiler::Compiler compiler{subgs};
+  compiler.options().backend_list = {"cpu"};
+  compiler.options().executor = executor;
+  compiler.compile();
+
+  std::shared_ptr<onert::exec::ExecutorMap> executors;
+  compiler.release(executors);
+  return executors;
+}
+
+void run(const std::string &executor, nonius::chronometer &meter)
+{
+  const uint32_t branches = meter.param<BRANCHES>();
+  const int32_t len = meter.param<LEN>();
+
+  std::vector<float> rhs;
+  auto executors = compile(executor, branches, len, rhs);
+
+  std::vector<float> input(len);
+  std::vector<std::vector<float>> outputs(branches, std::vector<float>(len));
+
+  onert::exec::Execution execution{executors};
+  execution.setInput(IOIndex{0}, input.data(), input.size() * sizeof(float));
+  for (uint32_t i = 0; i < branches; ++i)
+  {
+    execution.setOutput(IOIndex{i}, outputs[i].data(), outputs[i].size() * sizeof(float));
+  }
+
+  meter.measure([&](int) {
+    // Run!
+    execution.execute();
+  });
+}
+
+} // namespace
+
+//
+// Implementations
+//
+NONIUS_BENCHMARK("onert::exec::LinearExecutor",
+                 [](nonius::chronometer meter) { run("Linear", meter); })
+
+NONIUS_BENCHMARK("onert::exec::DataflowExecutor",
+                 [](nonius::chronometer meter) { run("Dataflow", meter); })
+
+NONIUS_BENCHMARK("onert::exec::ParallelExecutor",
+                 [](nonius::chronometer meter) { run("Parallel", meter); })
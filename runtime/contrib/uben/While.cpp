@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file While benchmark
+ *
+ * Measures per-iteration overhead of While operation on a model whose loop body is a tiny Add
+ * operation, so that passing loop-carried tensors between cond and body subgraphs dominates the
+ * computation. Divide the reported time by ITERATIONS to get the overhead of an iteration.
+ */
+
+#define NONIUS_RUNNER
+#include <nonius/nonius_single.h++>
+
+#include <compiler/Compiler.h>
+#include <exec/Execution.h>
+#include <ir/Graph.h>
+#include <ir/operation/Add.h>
+#include <ir/operation/Comparison.h>
+#include <ir/operation/While.h>
+
+#include <memory>
+#include <vector>
+
+//
+// Parameters
+//
+NONIUS_PARAM(ITERATIONS, 100);
+NONIUS_PARAM(LEN, 1024);
+
+namespace
+{
+
+using namespace onert::ir;
+
+struct ConstData
+{
+  float one = 1.0f;
+  float limit = 0.0f;
+  std::vector<float> rhs;
+};
+
+void setConstant(Graph &graph, const OperandIndex &index, const float *data, size_t count)
+{
+  graph.operands().at(index).data(std::make_unique<ExternalData>(
+      reinterpret_cast<const uint8_t *>(data), count * sizeof(float)));
+}
+
+std::shared_ptr<onert::exec::ExecutorMap> compile(int32_t iterations, int32_t len,
+                                                   ConstData &consts)
+{
+  // Model: while (i < iterations) { i = i + 1; x = x + rhs; }
+  // model input: i, x
+  // model output: i_out, x_out
+  const Shape counter_shape{1};
+  const Shape var_shape{1, len};
+  const TypeInfo float_type{DataType::FLOAT32};
+  const TypeInfo bool_type{DataType::BOOL8};
+
+  consts.limit = static_cast<float>(iterations);
+  consts.rhs.resize(len, 1.0f);
+
+  // cond subgraph: (i, x) -> i < iterations
+  auto cond = std::make_shared<Graph>();
+  {
+    auto i = cond->addOperand(counter_shape, float_type);
+    auto x = cond->addOperand(var_shape, float_type);
+    auto limit = cond->addOperand(counter_shape, float_type);
+    setConstant(*cond, limit, &consts.limit, 1);
+    auto result = cond->addOperand(counter_shape, bool_type);
+    cond->addInput(i);
+    cond->addInput(x);
+
+    operation::Comparison::Param param;
+    param.comparison_type = operation::Comparison::ComparisonType::Less;
+    cond->addOperation(std::make_unique<operation::Comparison>(
+        OperandIndexSequence{i, limit}, OperandIndexSequence{result}, param));
+    cond->addOutput(result);
+    cond->finishBuilding();
+  }
+
+  // body subgraph: (i, x) -> (i + 1, x + rhs)
+  auto body = std::make_shared<Graph>();
+  {
+    auto i = body->addOperand(counter_shape, float_type);
+    auto x = body->addOperand(var_shape, float_type);
+    auto one = body->addOperand(counter_shape, float_type);
+    setConstant(*body, one, &consts.one, 1);
+    auto rhs = body->addOperand(var_shape, float_type);
+    setConstant(*body, rhs, consts.rhs.data(), consts.rhs.size());
+    auto i_next = body->addOperand(counter_shape, float_type);
+    auto x_next = body->addOperand(var_shape, float_type);
+    body->addInput(i);
+    body->addInput(x);
+
+    operation::Add::Param param;
+    param.activation = Activation::NONE;
+    body->addOperation(std::make_unique<operation::Add>(OperandIndexSequence{i, one},
+                                                        OperandIndexSequence{i_next}, param));
+    body->addOperation(std::make_unique<operation::Add>(OperandIndexSequence{x, rhs},
+                                                        OperandIndexSequence{x_next}, param));
+    body->addOutput(i_next);
+    body->addOutput(x_next);
+    body->finishBuilding();
+  }
+
+  // primary subgraph: While
+  auto primary = std::make_shared<Graph>();
+  {
+    auto i = primary->addOperand(counter_shape, float_type);
+    auto x = primary->addOperand(var_shape, float_type);
+    auto i_out = primary->addOperand(counter_shape, float_type);
+    auto x_out = primary->addOperand(var_shape, float_type);
+    primary->addInput(i);
+    primary->addInput(x);
+
+    operation::While::Param param;
+    param.cond_subg_index = SubgraphIndex{1};
+    param.body_subg_index = SubgraphIndex{2};
+    primary->addOperation(std::make_unique<operation::While>(
+        OperandIndexSequence{i, x}, OperandIndexSequence{i_out, x_out}, param));
+    primary->addOutput(i_out);
+    primary->addOutput(x_out);
+    primary->finishBuilding();
+  }
+
+  auto subgs = std::make_shared<Subgraphs>();
+  subgs->push(SubgraphIndex{0}, primary);
+  subgs->push(SubgraphIndex{1}, cond);
+  subgs->push(SubgraphIndex{2}, body);
+
+  onert::compiler::Compiler compiler{subgs};
+  compiler.options().backend_list = {"cpu"};
+  compiler.compile();
+
+  std::shared_ptr<onert::exec::ExecutorMap> executors;
+  compiler.release(executors);
+  return executors;
+}
+
+} // namespace
+
+NONIUS_BENCHMARK("onert::backend::controlflow::kernel::WhileLayer", [](nonius::chronometer meter) {
+  const int32_t iterations = meter.param<ITERATIONS>();
+  const int32_t len = meter.param<LEN>();
+
+  ConstData consts;
+  auto executors = compile(iterations, len, consts);
+
+  float counter = 0.0f;
+  float counter_out = 0.0f;
+  std::vector<float> input(len);
+  std::vector<float> output(len);
+
+  onert::exec::Execution execution{executors};
+  execution.setInput(IOIndex{0}, &counter, sizeof(float));
+  execution.setInput(IOIndex{1}, input.data(), input.size() * sizeof(float));
+  execution.setOutput(IOIndex{0}, &counter_out, sizeof(float));
+  execution.setOutput(IOIndex{1}, output.data(), output.size() * sizeof(float));
+
+  meter.measure([&](int) {
+    // Run!
+    execution.execute();
+  });
+})
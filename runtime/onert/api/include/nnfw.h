@@ -79,6 +79,12 @@ typedef enum {
   NNFW_TYPE_TENSOR_BOOL = 3,
   /** A tensor of 8 bit unsigned integer */
   NNFW_TYPE_TENSOR_UINT8 = 4,
+  /**
+   * A tensor of 8 bit signed integers that represent real numbers.
+   *
+   * real_value = (integer_value - zeroPoint) * scale.
+   */
+  NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED = 5,
 } NNFW_TYPE;
 
 /**
@@ -252,6 +258,45 @@ NNFW_STATUS nnfw_prepare(nnfw_session *session);
  */
 NNFW_STATUS nnfw_run(nnfw_session *session);
 
+/**
+ * @brief Callback to be notified when inference started by {@link nnfw_run_async} is finished
+ *
+ * <p>It is called on a runtime worker thread. It must not call {@link nnfw_await} for the
+ * session.</p>
+ *
+ * @param[in] session   The session which finished inference
+ * @param[in] status    @c NNFW_STATUS_NO_ERROR if inference is successful
+ * @param[in] user_data User data given to {@link nnfw_run_async}
+ */
+typedef void (*nnfw_run_callback)(nnfw_session *session, NNFW_STATUS status, void *user_data);
+
+/**
+ * @brief     Run inference asynchronously
+ *
+ * <p>This works just as {@link nnfw_run}, but it returns right after inference is queued to the
+ * runtime thread pool. Input and output buffers must be kept alive until inference is finished.
+ * </p>
+ *
+ * <p>{@link nnfw_await} must be called before the session is used again, even if \p callback is
+ * given.</p>
+ *
+ * @param[in] session   The session to run inference
+ * @param[in] callback  Function to be called when inference is finished. It can be NULL
+ * @param[in] user_data User data to be passed to \p callback
+ * @return    @c NNFW_STATUS_NO_ERROR if inference is queued successfully
+ */
+NNFW_STATUS nnfw_run_async(nnfw_session *session, nnfw_run_callback callback, void *user_data);
+
+/**
+ * @brief     Wait until inference started by {@link nnfw_run_async} is finished
+ *
+ * <p>It returns after the callback given to {@link nnfw_run_async} returns.</p>
+ *
+ * @param[in] session The session running inference
+ * @return    @c NNFW_STATUS_NO_ERROR if inference is successful
+ */
+NNFW_STATUS nnfw_await(nnfw_session *session);
+
 /**
  * @brief     Set input buffer
  *
@@ -290,6 +335,44 @@ NNFW_STATUS nnfw_set_input(nnfw_session *session, uint32_t index, NNFW_TYPE type
 NNFW_STATUS nnfw_set_output(nnfw_session *session, uint32_t index, NNFW_TYPE type, void *buffer,
                             size_t length);
 
+/**
+ * @brief     Set input buffer to be used as memory of the input tensor without copy
+ *
+ * This works just as {@link nnfw_set_input}, but the runtime may read \p buffer in place during
+ * inference instead of copying it into its own memory. It falls back to copy when the input tensor
+ * cannot use \p buffer as it is (e.g. different layout, padding or dynamic shape). \p buffer
+ * must be kept alive and must not be modified until {@link nnfw_run} returns.
+ *
+ * @param[in] session Session to the input is to be set
+ * @param[in] index   Index of input to be set (0-indexed)
+ * @param[in] type    Type of the input
+ * @param[in] buffer  Raw buffer for input
+ * @param[in] length  Size of bytes of input buffer
+ *
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_bind_input(nnfw_session *session, uint32_t index, NNFW_TYPE type,
+                            const void *buffer, size_t length);
+
+/**
+ * @brief       Set output buffer to be used as memory of the output tensor without copy
+ *
+ * This works just as {@link nnfw_set_output}, but the runtime may write the result into \p buffer
+ * directly instead of copying it out of its own memory. It falls back to copy when the output
+ * tensor cannot use \p buffer as it is (e.g. different layout, padding or dynamic shape). The
+ * content of \p buffer is undefined until {@link nnfw_run} returns.
+ *
+ * @param[in]   session Session from inference output is to be extracted
+ * @param[in]   index   Index of output to be set (0-indexed)
+ * @param[in]   type    Type of the output
+ * @param[out]  buffer  Raw buffer for output
+ * @param[in]   length  Size of bytes of output buffer
+ *
+ * @return      @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_bind_output(nnfw_session *session, uint32_t index, NNFW_TYPE type, void *buffer,
+                             size_t length);
+
 /**
  * @brief       Get the number of inputs
  *
@@ -26,6 +26,7 @@ STATIC_ASSERT_ENUM_CHECK(NNFW_TYPE_TENSOR_INT32, 1);
 STATIC_ASSERT_ENUM_CHECK(NNFW_TYPE_TENSOR_QUANT8_ASYMM, 2);
 STATIC_ASSERT_ENUM_CHECK(NNFW_TYPE_TENSOR_BOOL, 3);
 STATIC_ASSERT_ENUM_CHECK(NNFW_TYPE_TENSOR_UINT8, 4);
+STATIC_ASSERT_ENUM_CHECK(NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED, 5);
 STATIC_ASSERT_ENUM_CHECK(NNFW_STATUS_NO_ERROR, 0);
 STATIC_ASSERT_ENUM_CHECK(NNFW_STATUS_ERROR, 1);
 STATIC_ASSERT_ENUM_CHECK(NNFW_LAYOUT_NONE, 0);
@@ -108,6 +109,32 @@ NNFW_STATUS nnfw_run(nnfw_session *session)
   return session->run();
 }
 
+/*
+ * Run inference asynchronously
+ *
+ * @param session the session to run inference
+ * @param callback function to be called when inference is finished
+ * @param user_data user data to be passed to callback
+ * @return NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_run_async(nnfw_session *session, nnfw_run_callback callback, void *user_data)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->run_async(callback, user_data);
+}
+
+/*
+ * Wait for asynchronous inference
+ *
+ * @param session the session running inference
+ * @return NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_await(nnfw_session *session)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->await();
+}
+
 /*
  * Set input
  *
@@ -146,6 +173,44 @@ NNFW_STATUS nnfw_set_output(nnfw_session *session, uint32_t index, NNFW_TYPE typ
   return session->set_output(index, type, buffer, length);
 }
 
+/*
+ * Set input to be bound without copy
+ *
+ * @param session session to the input is to be set
+ * @param index index of input to be set (0-indexed)
+ * @param type type of the input
+ * @param buffer raw buffer for input
+ * @param length size of bytes of input
+ *
+ * @return NNFW_STATUS_NO_ERROR if successful
+ */
+
+NNFW_STATUS nnfw_bind_input(nnfw_session *session, uint32_t index, NNFW_TYPE type,
+                            const void *buffer, size_t length)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->bind_input(index, type, buffer, length);
+}
+
+/*
+ * Set output to be bound without copy
+ *
+ * @param session session from inference output is to be extracted
+ * @param index index of output to be set (0-indexed)
+ * @param type type of the output
+ * @param buffer raw buffer for output
+ * @param length size of bytes of output
+ *
+ * @return NNFW_STATUS_NO_ERROR if successful
+ */
+
+NNFW_STATUS nnfw_bind_output(nnfw_session *session, uint32_t index, NNFW_TYPE type, void *buffer,
+                             size_t length)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->bind_output(index, type, buffer, length);
+}
+
 /*
  * Get the number of inputs
  *
@@ -172,6 +172,10 @@ NNFW_STATUS nnfw_session::prepare()
     using onert::util::config_source;
     config_source(std::move(_source));
 
+    // A session runs one execution at a time with its own inputs and outputs, so it has no use for
+    // more execution contexts than the one it runs
+    _compiler->options().num_contexts = 1;
+
     _subgraphs.reset();
     _compiler->compile();
     std::shared_ptr<onert::exec::ExecutorMap> executors;
@@ -211,6 +215,56 @@ NNFW_STATUS nnfw_session::run()
   return NNFW_STATUS_NO_ERROR;
 }
 
+NNFW_STATUS nnfw_session::run_async(nnfw_run_callback callback, void *user_data)
+{
+  if (!isStatePrepared())
+  {
+    std::cerr << "Error during nnfw_session::run_async : "
+              << "run_async should be run after prepare" << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  try
+  {
+    _execution->startExecute([this, callback, user_data](std::exception_ptr error) {
+      if (callback)
+        callback(this, error ? NNFW_STATUS_ERROR : NNFW_STATUS_NO_ERROR, user_data);
+    });
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::run_async : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  _state = State::RUNNING;
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::await()
+{
+  if (!isStateRunning())
+  {
+    std::cerr << "Error during nnfw_session::await : "
+              << "await should be run after run_async" << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  _state = State::PREPARED;
+
+  try
+  {
+    _execution->waitFinish();
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::await : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
 NNFW_STATUS nnfw_session::set_input(uint32_t index, NNFW_TYPE /*type*/, const void *buffer,
                                     size_t length)
 {
@@ -269,6 +323,64 @@ NNFW_STATUS nnfw_session::set_output(uint32_t index, NNFW_TYPE /*type*/, void *b
   return NNFW_STATUS_NO_ERROR;
 }
 
+NNFW_STATUS nnfw_session::bind_input(uint32_t index, NNFW_TYPE /*type*/, const void *buffer,
+                                     size_t length)
+{
+  if (!isStatePrepared())
+  {
+    std::cerr << "Error during nnfw_session::bind_input : invalid state" << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  if (!buffer && length != 0)
+  {
+    std::cerr
+        << "Error during nnfw_session::bind_input : given buffer is NULL but the length is not 0"
+        << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  try
+  {
+    _execution->bindInput(onert::ir::IOIndex(index), buffer, length);
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::bind_input : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::bind_output(uint32_t index, NNFW_TYPE /*type*/, void *buffer,
+                                      size_t length)
+{
+  if (!isStatePrepared())
+  {
+    std::cerr << "Error during nnfw_session::bind_output : invalid state" << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  if (!buffer && length != 0)
+  {
+    std::cerr
+        << "Error during nnfw_session::bind_output : given buffer is NULL but the length is not 0"
+        << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  try
+  {
+    _execution->bindOutput(onert::ir::IOIndex(index), buffer, length);
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::bind_output : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+  return NNFW_STATUS_NO_ERROR;
+}
+
 NNFW_STATUS nnfw_session::input_size(uint32_t *number)
 {
   if (isStateInitialized()) // Model is not loaded
@@ -369,6 +481,8 @@ static NNFW_TYPE datatype_to_nnfw_dtype(onert::ir::DataType dt)
       return NNFW_TYPE_TENSOR_BOOL;
     case DataType::UINT8:
       return NNFW_TYPE_TENSOR_UINT8;
+    case DataType::QUANT_INT8_ASYMM:
+      return NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED;
     case DataType::UINT32:
     case DataType::QUANT_INT8_SYMM:
     default:
@@ -593,6 +707,16 @@ NNFW_STATUS nnfw_session::set_config(const char *key, const char *value)
   {
     options.trace_filepath = value;
   }
+  else if (skey == config::TRACE_RING_SIZE)
+  {
+    const auto size = toInt(value);
+    options.trace_ring_size = size > 0 ? static_cast<uint32_t>(size) : 0;
+  }
+  else if (skey == config::NUM_THREADS)
+  {
+    const auto num_threads = toInt(value);
+    options.num_threads = num_threads > 0 ? static_cast<uint32_t>(num_threads) : 0;
+  }
   else if (skey == config::GRAPH_DOT_DUMP)
   {
     options.graph_dump_level = toInt(value);
@@ -731,3 +855,18 @@ bool nnfw_session::isStatePrepared()
     return false;
   }
 }
+
+bool nnfw_session::isStateRunning()
+{
+  if (_state == State::RUNNING)
+  {
+    assert(!_subgraphs);
+    assert(_compiler);
+    assert(_execution);
+    return true;
+  }
+  else
+  {
+    return false;
+  }
+}
@@ -57,6 +57,7 @@ private:
     INITIALIZED,  //< Session is initialized and nothing has done to it
     MODEL_LOADED, //< Model is loaded
     PREPARED,     //< Prepared(compiled) for execution
+    RUNNING,      //< Execution is in progress asynchronously
   };
 
 public:
@@ -66,10 +67,15 @@ public:
   NNFW_STATUS load_model_from_file(const char *package_file_path);
   NNFW_STATUS prepare();
   NNFW_STATUS run();
+  NNFW_STATUS run_async(nnfw_run_callback callback, void *user_data);
+  NNFW_STATUS await();
 
   NNFW_STATUS set_input(uint32_t index, NNFW_TYPE type, const void *buffer, size_t length);
   NNFW_STATUS set_output(uint32_t index, NNFW_TYPE type, void *buffer, size_t length);
 
+  NNFW_STATUS bind_input(uint32_t index, NNFW_TYPE type, const void *buffer, size_t length);
+  NNFW_STATUS bind_output(uint32_t index, NNFW_TYPE type, void *buffer, size_t length);
+
   NNFW_STATUS input_size(uint32_t *number);
   NNFW_STATUS output_size(uint32_t *number);
 
@@ -94,6 +100,7 @@ private:
   bool isStateInitialized();
   bool isStateModelLoaded();
   bool isStatePrepared();
+  bool isStateRunning();
 
 private:
   State _state{State::INITIALIZED};
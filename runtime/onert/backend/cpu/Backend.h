@@ -47,10 +47,12 @@ public:
     const auto &operands = graph.operands();
     const auto &operations = graph.operations();
     auto context = std::make_unique<BackendContext>(this, &graph);
-    auto tb = std::make_shared<TensorBuilder>();
+    // Constants are permuted unless the model is NHWC as well as this backend
+    auto tb = std::make_shared<TensorBuilder>(operands, graph.layout() == ir::Layout::NHWC);
     context->tensor_builder = tb;
     context->constant_initializer = std::make_shared<ConstantInitializer>(operands, tb);
-    context->kernel_gen = std::make_shared<KernelGenerator>(operands, operations, tb, kb);
+    context->kernel_gen = std::make_shared<KernelGenerator>(operands, operations, tb, kb,
+                                                            graph.preparedDataCache());
     context->shape_fixer = std::make_shared<ShapeFixer>(operands);
     context->tensor_register = nullptr;
     context->optimizer = nullptr;
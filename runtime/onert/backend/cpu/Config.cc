@@ -16,6 +16,9 @@
 
 #include "Config.h"
 
+#include <cker/Threading.h>
+#include <util/ThreadBudget.h>
+
 namespace onert
 {
 namespace backend
@@ -23,7 +26,13 @@ namespace backend
 namespace cpu
 {
 
-bool Config::initialize() { return true; }
+bool Config::initialize()
+{
+  // Kernels share the thread budget of the runtime with executors
+  nnfw::cker::threading::SetNumThreadsFunc(
+      []() { return static_cast<int>(util::ThreadBudget::get().threadsPerKernel()); });
+  return true;
+}
 
 ir::Layout Config::supportLayout(const ir::Operation &, ir::Layout) { return ir::Layout::NHWC; }
 
@@ -30,42 +30,105 @@ ConstantInitializer::ConstantInitializer(const ir::Operands &operands,
   // DO NOTHING
 }
 
+void ConstantInitializer::registerDefaultInitializer(const ir::OperandIndex &index,
+                                                     const ir::Operand &obj)
+{
+  if (!registerExternalInitializer(index, obj))
+    registerPermuteInitializer(index, obj);
+}
+
+void ConstantInitializer::registerCopyOrExternalInitializer(const ir::OperandIndex &index,
+                                                            const ir::Operand &obj)
+{
+  if (!registerExternalInitializer(index, obj))
+    registerCopyInitializer(index, obj);
+}
+
+bool ConstantInitializer::registerExternalInitializer(const ir::OperandIndex &index,
+                                                      const ir::Operand &obj)
+{
+  if (!obj.isConstant())
+    return false;
+
+  auto tensor = _tensor_builder->tensorAt(index);
+  auto cpu_tensor = std::dynamic_pointer_cast<Tensor>(tensor);
+  if (cpu_tensor == nullptr || !cpu_tensor->hasData())
+    return false;
+
+  // The tensor already uses the operand data in place, which is read-only. Nothing to fill.
+  _init_map[index] = [](const ir::Operand &, backend::ITensor &) {};
+  return true;
+}
+
 void ConstantInitializer::visit(const ir::operation::Conv2D &node)
 {
   const auto &kernel_index = node.getInputs().at(ir::operation::Conv2D::KERNEL);
   const auto &kernel_obj = _operands.at(kernel_index);
-  registerCopyInitializer(kernel_index, kernel_obj);
+  registerCopyOrExternalInitializer(kernel_index, kernel_obj);
 
   const auto &bias_index = node.getInputs().at(ir::operation::Conv2D::BIAS);
   const auto &bias_obj = _operands.at(bias_index);
-  registerCopyInitializer(bias_index, bias_obj);
+  registerCopyOrExternalInitializer(bias_index, bias_obj);
 }
 
 void ConstantInitializer::visit(const ir::operation::DepthwiseConv2D &node)
 {
   const auto &kernel_index = node.getInputs().at(ir::operation::DepthwiseConv2D::KERNEL);
   const auto &kernel_obj = _operands.at(kernel_index);
-  registerCopyInitializer(kernel_index, kernel_obj);
+  registerCopyOrExternalInitializer(kernel_index, kernel_obj);
 
   const auto &bias_index = node.getInputs().at(ir::operation::DepthwiseConv2D::BIAS);
   const auto &bias_obj = _operands.at(bias_index);
-  registerCopyInitializer(bias_index, bias_obj);
+  registerCopyOrExternalInitializer(bias_index, bias_obj);
 }
 
 void ConstantInitializer::visit(const ir::operation::FullyConnected &node)
 {
   const auto &weight_index = node.getInputs().at(ir::operation::FullyConnected::WEIGHT);
   const auto &weight_obj = _operands.at(weight_index);
-  registerCopyInitializer(weight_index, weight_obj);
+  registerCopyOrExternalInitializer(weight_index, weight_obj);
 
   const auto &bias_index = node.getInputs().at(ir::operation::FullyConnected::BIAS);
   if (!bias_index.undefined())
   {
     const auto &bias_obj = _operands.at(bias_index);
-    registerCopyInitializer(bias_index, bias_obj);
+    registerCopyOrExternalInitializer(bias_index, bias_obj);
   }
 }
 
+void ConstantInitializer::visit(const ir::operation::TransposeConv &node)
+{
+  const auto &kernel_index = node.getInputs().at(ir::operation::TransposeConv::KERNEL);
+  const auto &kernel_obj = _operands.at(kernel_index);
+  registerCopyOrExternalInitializer(kernel_index, kernel_obj);
+}
+
+void ConstantInitializer::visit(const ir::operation::LSTM &node)
+{
+  // Weights and biases, where optional ones which do not exist have no element
+  for (uint32_t input = ir::operation::LSTM::INPUT_TO_INPUT_WEIGHTS;
+       input <= ir::operation::LSTM::PROJECTION_BIAS; ++input)
+  {
+    const auto &index = node.getInputs().at(input);
+    if (index.undefined() || _operands.at(index).shape().num_elements() == 0)
+      continue;
+    registerCopyOrExternalInitializer(index, _operands.at(index));
+  }
+}
+
+void ConstantInitializer::visit(const ir::operation::RNN &node)
+{
+  const auto &weights_index = node.getInputs().at(ir::operation::RNN::WEIGHTS);
+  registerCopyOrExternalInitializer(weights_index, _operands.at(weights_index));
+
+  const auto &recurrent_weights_index = node.getInputs().at(ir::operation::RNN::RECURRENT_WEIGHTS);
+  registerCopyOrExternalInitializer(recurrent_weights_index,
+                                    _operands.at(recurrent_weights_index));
+
+  const auto &bias_index = node.getInputs().at(ir::operation::RNN::BIAS);
+  registerCopyOrExternalInitializer(bias_index, _operands.at(bias_index));
+}
+
 } // namespace cpu
 } // namespace backend
 } // namespace onert
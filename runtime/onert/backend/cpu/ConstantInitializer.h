@@ -35,13 +35,22 @@ public:
   ConstantInitializer(const ir::Operands &operands,
                       const std::shared_ptr<TensorBuilder> &tensor_builder);
 
+public:
+  void registerDefaultInitializer(const ir::OperandIndex &index, const ir::Operand &obj) override;
+
 public:
   void visit(const ir::operation::Conv2D &) override;
   void visit(const ir::operation::DepthwiseConv2D &) override;
   void visit(const ir::operation::FullyConnected &) override;
+  void visit(const ir::operation::TransposeConv &) override;
+  void visit(const ir::operation::LSTM &) override;
+  void visit(const ir::operation::RNN &) override;
 
 private:
   std::shared_ptr<ITensorBuilder> tensor_builder() const override { return _tensor_builder; }
+  // Register an initializer which copies the data, unless the tensor already uses it in place
+  void registerCopyOrExternalInitializer(const ir::OperandIndex &index, const ir::Operand &obj);
+  bool registerExternalInitializer(const ir::OperandIndex &index, const ir::Operand &obj);
 
 private:
   std::shared_ptr<TensorBuilder> _tensor_builder;
@@ -38,14 +38,12 @@ void DynamicTensorManager::applyShape(const ir::OperandIndex &ind, const ir::Sha
 
   bool previously_dynamic = tensor->is_dynamic();
 
-  auto allocTensorMem = [&](bool overwrite = false) {
+  auto allocTensorMem = [&]() {
     auto capacity = tensor->total_size();
     auto alloc = _dynamic_mem_mgr->allocate(ind, capacity);
 
-    if (overwrite)
-      tensor->overwriteBuffer(alloc);
-    else
-      tensor->setBuffer(alloc);
+    // The tensor may still hold a static buffer or an allocator which has been deallocated
+    tensor->overwriteBuffer(alloc);
   };
 
   if (!previously_dynamic)
@@ -54,7 +52,7 @@ void DynamicTensorManager::applyShape(const ir::OperandIndex &ind, const ir::Sha
     // issue is that staticTensorManager might have allocate this memory
     setShape(tensor.get(), new_shape);
     tensor->set_dynamic();
-    allocTensorMem(true);
+    allocTensorMem();
   }
   else if (tensor->buffer() == nullptr)
   {
@@ -93,7 +91,7 @@ void DynamicTensorManager::allocate(const ir::OperandIndex &ind, const ir::Shape
     auto capacity = tensor->total_size();
     auto alloc = _dynamic_mem_mgr->allocate(ind, capacity);
 
-    tensor->setBuffer(alloc);
+    tensor->overwriteBuffer(alloc);
   };
 
   if (tensor->buffer() == nullptr)
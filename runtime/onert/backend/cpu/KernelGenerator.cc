@@ -34,6 +34,7 @@
 #include "ops/GatherLayer.h"
 #include "ops/LogLayer.h"
 #include "ops/LogisticLayer.h"
+#include "ops/LSTMLayer.h"
 #include "ops/MaxLayer.h"
 #include "ops/MaxPoolLayer.h"
 #include "ops/MeanLayer.h"
@@ -50,6 +51,7 @@
 #include "ops/ReLULayer.h"
 #include "ops/ReshapeLayer.h"
 #include "ops/ReverseLayer.h"
+#include "ops/RNNLayer.h"
 #include "ops/RoundLayer.h"
 #include "ops/RsqrtLayer.h"
 #include "ops/SelectLayer.h"
@@ -63,6 +65,7 @@
 #include "ops/TanhLayer.h"
 #include "ops/TileLayer.h"
 #include "ops/TransposeLayer.h"
+#include "ops/TransposeConvLayer.h"
 #include "ops/UnpackLayer.h"
 #include "ops/LogicalNotLayer.h"
 #include "ops/ZerosLikeLayer.h"
@@ -84,12 +87,35 @@ namespace backend
 namespace cpu
 {
 
+namespace
+{
+
+// Operations whose kernels compute int8 asymmetric tensors. Others have no int8 path and would
+// leave their outputs uninitialized, so models using int8 with them are rejected.
+bool supportsQuantInt8(ir::OpCode opcode)
+{
+  switch (opcode)
+  {
+    case ir::OpCode::Conv2D:
+    case ir::OpCode::DepthwiseConv2D:
+    case ir::OpCode::FullyConnected:
+    case ir::OpCode::Reshape:
+      return true;
+    default:
+      return false;
+  }
+}
+
+} // namespace
+
 KernelGenerator::KernelGenerator(
     const ir::Operands &operands_ctx, const ir::Operations &operations_ctx,
     const std::shared_ptr<TensorBuilder> &tensor_builder,
-    const std::shared_ptr<backend::custom::IKernelBuilder> &kernel_builder)
+    const std::shared_ptr<backend::custom::IKernelBuilder> &kernel_builder,
+    const std::shared_ptr<ir::PreparedDataCache> &prepared_data_cache)
     : _ctx(operands_ctx), _operations_ctx{operations_ctx}, _tensor_builder(tensor_builder),
-      _kernel_builder(kernel_builder), _current_op_seq_layout(ir::Layout::UNKNOWN)
+      _kernel_builder(kernel_builder), _prepared_data_cache(prepared_data_cache),
+      _current_op_seq_layout(ir::Layout::UNKNOWN)
 {
   // DO NOTHING
 }
@@ -114,6 +140,14 @@ void KernelGenerator::visit(const ir::OpSequence &op_seq)
   for (const auto &operation_idx : op_seq.operations())
   {
     const auto &node = _operations_ctx.at(operation_idx);
+    if (!supportsQuantInt8(node.opcode()))
+    {
+      for (const auto &ind : (node.getInputs() | ir::Remove::UNDEFINED) + node.getOutputs())
+      {
+        if (_ctx.at(ind).typeInfo().type() == ir::DataType::QUANT_INT8_ASYMM)
+          throw std::runtime_error{"KernelGenerator: NYI for int8 " + node.name()};
+      }
+    }
     node.accept(*this);
     _return_fn_seq->append(releaseFunction());
 
@@ -158,7 +192,11 @@ void KernelGenerator::visit(const ir::operation::Conv2D &node)
 
   fn->configure(ifm_alloc, ker_alloc, bias_alloc, padding_type, padding.left, padding.right,
                 padding.top, padding.bottom, stride.horizontal, stride.vertical, activation,
-                ofm_alloc);
+                ofm_alloc, _ctx.at(ker_index).isConstant());
+  if (_ctx.at(ker_index).isConstant())
+  {
+    fn->shareFilter(_prepared_data_cache, ker_index);
+  }
 
   _return_fn = std::move(fn);
 }
@@ -198,6 +236,37 @@ void KernelGenerator::visit(const ir::operation::DepthwiseConv2D &node)
   _return_fn = std::move(fn);
 }
 
+void KernelGenerator::visit(const ir::operation::TransposeConv &node)
+{
+  using ir::operation::TransposeConv;
+
+  const auto ofm_index{node.getOutputs().at(0)};
+  const auto ifm_index{node.getInputs().at(TransposeConv::Input::INPUT)};
+  const auto ker_index{node.getInputs().at(TransposeConv::Input::KERNEL)};
+
+  const auto stride = node.param().stride;
+  const auto ifm_shape = _ctx.at(ifm_index).shape().asFeature(_current_op_seq_layout);
+  const auto ofm_shape = _ctx.at(ofm_index).shape().asFeature(_current_op_seq_layout);
+  // Kernel format is [depth_out, kernel_height, kernel_width, depth_in].
+  const auto &ker_shape = _ctx.at(ker_index).shape();
+  const auto ker_height = ker_shape.dim(1);
+  const auto ker_width = ker_shape.dim(2);
+  // Padding of TransposeConv is the one of Conv2D from output to input
+  const auto padding = ir::calculatePadding(node.param().padding, ofm_shape, ifm_shape, stride,
+                                            ker_width, ker_height);
+
+  auto ofm_alloc = _tensor_builder->at(ofm_index).get();
+  auto ifm_alloc = _tensor_builder->at(ifm_index).get();
+  auto ker_alloc = _tensor_builder->at(ker_index).get();
+
+  auto fn = std::make_unique<ops::TransposeConvLayer>();
+
+  fn->configure(ifm_alloc, ker_alloc, padding.left, padding.top, stride.horizontal,
+                stride.vertical, ofm_alloc, _ctx.at(ker_index).isConstant());
+
+  _return_fn = std::move(fn);
+}
+
 void KernelGenerator::visit(const ir::operation::MaxPool2D &node)
 {
   const auto ofm_index{node.getOutputs().at(0)};
@@ -303,7 +372,8 @@ void KernelGenerator::visit(const ir::operation::FullyConnected &node)
 
   auto fn = std::make_unique<ops::FullyConnectedLayer>();
 
-  fn->configure(input_alloc, weight_alloc, bias_alloc, activation, output_alloc);
+  fn->configure(input_alloc, weight_alloc, bias_alloc, activation, output_alloc,
+                _ctx.at(weight_index).isConstant());
 
   _return_fn = std::move(fn);
 }
@@ -1234,6 +1304,121 @@ void KernelGenerator::visit(const ir::operation::Tile &node)
   fn->configure(input_alloc, multiples_alloc, output_alloc);
   _return_fn = std::move(fn);
 }
+
+void KernelGenerator::visit(const ir::operation::LSTM &node)
+{
+  using ir::operation::LSTM;
+
+  const auto scratch_buffer_index{node.getOutputs().at(LSTM::Output::SCRATCH_BUFFER)};
+  const auto output_state_out_index{node.getOutputs().at(LSTM::Output::OUTPUT_STATE_OUT)};
+  const auto cell_state_out_index{node.getOutputs().at(LSTM::Output::CELL_STATE_OUT)};
+  const auto output_index{node.getOutputs().at(LSTM::Output::OUTPUT)};
+  const auto input_index{node.getInputs().at(LSTM::Input::INPUT)};
+  const auto output_state_in_index{node.getInputs().at(LSTM::Input::OUTPUT_STATE_IN)};
+  const auto cell_state_in_index{node.getInputs().at(LSTM::Input::CELL_STATE_IN)};
+
+  // Optional operands which do not exist are given as ones with no element
+  bool is_weights_constant = true;
+  auto optional_alloc = [&](LSTM::Input input, bool is_weights) -> const Tensor * {
+    const auto index = node.getInputs().at(input);
+    if (index.undefined() || _ctx.at(index).shape().num_elements() == 0)
+      return nullptr;
+    if (is_weights)
+      is_weights_constant = is_weights_constant && _ctx.at(index).isConstant();
+    return _tensor_builder->at(index).get();
+  };
+
+  ops::LSTMLayer::GateTensors input_to_gate_weights{
+      optional_alloc(LSTM::Input::INPUT_TO_INPUT_WEIGHTS, true),
+      optional_alloc(LSTM::Input::INPUT_TO_FORGET_WEIGHTS, true),
+      optional_alloc(LSTM::Input::INPUT_TO_CELL_WEIGHTS, true),
+      optional_alloc(LSTM::Input::INPUT_TO_OUTPUT_WEIGHTS, true)};
+  ops::LSTMLayer::GateTensors recurrent_to_gate_weights{
+      optional_alloc(LSTM::Input::RECURRENT_TO_INPUT_WEIGHTS, true),
+      optional_alloc(LSTM::Input::RECURRENT_TO_FORGET_WEIGHTS, true),
+      optional_alloc(LSTM::Input::RECURRENT_TO_CELL_WEIGHTS, true),
+      optional_alloc(LSTM::Input::RECURRENT_TO_OUTPUT_WEIGHTS, true)};
+  ops::LSTMLayer::GateTensors cell_to_gate_weights{
+      optional_alloc(LSTM::Input::CELL_TO_INPUT_WEIGHTS, true),
+      optional_alloc(LSTM::Input::CELL_TO_FORGET_WEIGHTS, true), nullptr,
+      optional_alloc(LSTM::Input::CELL_TO_OUTPUT_WEIGHTS, true)};
+  ops::LSTMLayer::GateTensors gate_biases{optional_alloc(LSTM::Input::INPUT_GATE_BIAS, true),
+                                          optional_alloc(LSTM::Input::FORGET_GATE_BIAS, true),
+                                          optional_alloc(LSTM::Input::CELL_BIAS, true),
+                                          optional_alloc(LSTM::Input::OUTPUT_GATE_BIAS, true)};
+  auto projection_weights_alloc = optional_alloc(LSTM::Input::PROJECTION_WEIGHTS, true);
+  auto projection_bias_alloc = optional_alloc(LSTM::Input::PROJECTION_BIAS, true);
+
+  // With CIFG(coupled input and forget gate), input gate is computed from forget gate. Models may
+  // still declare shaped input gate operands with no data, so the scratch buffer, which holds
+  // 3 gates with CIFG and 4 gates otherwise, tells it as well.
+  const auto n_cell = _ctx.at(cell_state_in_index).shape().dim(1);
+  const auto scratch_size = _ctx.at(scratch_buffer_index).shape().dim(1);
+  if (scratch_size != n_cell * 3 && scratch_size != n_cell * 4)
+    throw std::runtime_error{"KernelGenerator: LSTM scratch buffer must hold 3 or 4 gates"};
+  const bool use_cifg = (scratch_size == n_cell * 3) || input_to_gate_weights[0] == nullptr ||
+                        recurrent_to_gate_weights[0] == nullptr || gate_biases[0] == nullptr;
+  if (use_cifg && scratch_size != n_cell * 3)
+    throw std::runtime_error{"KernelGenerator: LSTM scratch buffer of CIFG must hold 3 gates"};
+  if (use_cifg)
+  {
+    input_to_gate_weights[0] = nullptr;
+    recurrent_to_gate_weights[0] = nullptr;
+    cell_to_gate_weights[0] = nullptr;
+    gate_biases[0] = nullptr;
+  }
+
+  auto scratch_buffer_alloc = _tensor_builder->at(scratch_buffer_index).get();
+  auto output_state_out_alloc = _tensor_builder->at(output_state_out_index).get();
+  auto cell_state_out_alloc = _tensor_builder->at(cell_state_out_index).get();
+  auto output_alloc = _tensor_builder->at(output_index).get();
+  auto input_alloc = _tensor_builder->at(input_index).get();
+  auto output_state_in_alloc = _tensor_builder->at(output_state_in_index).get();
+  auto cell_state_in_alloc = _tensor_builder->at(cell_state_in_index).get();
+
+  auto fn = std::make_unique<ops::LSTMLayer>();
+
+  fn->configure(input_alloc, input_to_gate_weights, recurrent_to_gate_weights,
+                cell_to_gate_weights, gate_biases, projection_weights_alloc,
+                projection_bias_alloc, output_state_in_alloc, cell_state_in_alloc,
+                node.param().activation, node.param().cell_threshold,
+                node.param().projection_threshold, scratch_buffer_alloc, output_state_out_alloc,
+                cell_state_out_alloc, output_alloc, is_weights_constant);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::RNN &node)
+{
+  using ir::operation::RNN;
+
+  const auto output_index{node.getOutputs().at(RNN::Output::OUTPUT)};
+  const auto hidden_state_out_index{node.getOutputs().at(RNN::Output::HIDDEN_STATE_OUT)};
+  const auto input_index{node.getInputs().at(RNN::Input::INPUT)};
+  const auto weights_index{node.getInputs().at(RNN::Input::WEIGHTS)};
+  const auto recurrent_weights_index{node.getInputs().at(RNN::Input::RECURRENT_WEIGHTS)};
+  const auto bias_index{node.getInputs().at(RNN::Input::BIAS)};
+  const auto hidden_state_in_index{node.getInputs().at(RNN::Input::HIDDEN_STATE_IN)};
+
+  auto output_alloc = _tensor_builder->at(output_index).get();
+  auto hidden_state_out_alloc = _tensor_builder->at(hidden_state_out_index).get();
+  auto input_alloc = _tensor_builder->at(input_index).get();
+  auto weights_alloc = _tensor_builder->at(weights_index).get();
+  auto recurrent_weights_alloc = _tensor_builder->at(recurrent_weights_index).get();
+  auto bias_alloc = _tensor_builder->at(bias_index).get();
+  auto hidden_state_in_alloc = _tensor_builder->at(hidden_state_in_index).get();
+
+  auto fn = std::make_unique<ops::RNNLayer>();
+
+  fn->configure(input_alloc, weights_alloc, recurrent_weights_alloc, bias_alloc,
+                hidden_state_in_alloc, node.param().activation, output_alloc,
+                hidden_state_out_alloc,
+                _ctx.at(weights_index).isConstant() &&
+                    _ctx.at(recurrent_weights_index).isConstant());
+
+  _return_fn = std::move(fn);
+}
+
 } // namespace cpu
 } // namespace backend
 } // namespace onert
@@ -24,6 +24,7 @@
 #include <backend/IKernelGenerator.h>
 #include <ir/Operands.h>
 #include <ir/Operations.h>
+#include <ir/PreparedDataCache.h>
 
 namespace onert
 {
@@ -37,13 +38,15 @@ class KernelGenerator : public IKernelGenerator
 public:
   KernelGenerator(const ir::Operands &operands_ctx, const ir::Operations &operations_ctx,
                   const std::shared_ptr<TensorBuilder> &tensor_builder,
-                  const std::shared_ptr<custom::IKernelBuilder> &kernel_builder);
+                  const std::shared_ptr<custom::IKernelBuilder> &kernel_builder,
+                  const std::shared_ptr<ir::PreparedDataCache> &prepared_data_cache);
 
   using IKernelGenerator::visit;
 
   void visit(const ir::OpSequence &) override;
   void visit(const ir::operation::Conv2D &) override;
   void visit(const ir::operation::DepthwiseConv2D &) override;
+  void visit(const ir::operation::TransposeConv &) override;
   void visit(const ir::operation::MaxPool2D &) override;
   void visit(const ir::operation::AvgPool2D &) override;
   void visit(const ir::operation::Concat &) override;
@@ -100,12 +103,15 @@ public:
   void visit(const ir::operation::Tile &) override;
   void visit(const ir::operation::LogicalOr &) override;
   void visit(const ir::operation::Range &) override;
+  void visit(const ir::operation::LSTM &) override;
+  void visit(const ir::operation::RNN &) override;
 
 private:
   const ir::Operands &_ctx;
   const ir::Operations &_operations_ctx;
   std::shared_ptr<TensorBuilder> _tensor_builder;
   std::shared_ptr<backend::custom::IKernelBuilder> _kernel_builder;
+  std::shared_ptr<ir::PreparedDataCache> _prepared_data_cache;
   ir::Layout _current_op_seq_layout;
 };
 
@@ -35,9 +35,6 @@ class ShapeFixer : public IShapeFixer
 public:
   ShapeFixer(const ir::Operands &ctx);
 
-  void visit(const ir::operation::Add &) override;
-  void visit(const ir::operation::Sub &) override;
-  void visit(const ir::operation::Mul &) override;
   void visit(const ir::operation::Div &) override;
   void visit(const ir::operation::Pad &) override;
 
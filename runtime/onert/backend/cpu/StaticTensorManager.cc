@@ -38,7 +38,7 @@ void StaticTensorManager::allocateConsts(void)
   {
     const auto &ind = pair.first;
     auto tensor = pair.second;
-    if (_as_constants[ind])
+    if (_as_constants[ind] && !tensor->hasData())
     {
       auto mem_alloc = _const_mgr->allocate(ind, tensor->total_size());
       tensor->setBuffer(mem_alloc);
@@ -20,6 +20,7 @@
 #include "backend/cpu_common/Allocator.h"
 
 #include <backend/ITensor.h>
+#include <ir/Data.h>
 #include <ir/OperandInfo.h>
 
 namespace onert
@@ -36,7 +37,8 @@ public:
 
 public:
   Tensor(const ir::OperandInfo &info)
-      : _info(info), _buffer(nullptr), _num_references(0), _allocator(nullptr)
+      : _info(info), _buffer(nullptr), _num_references(0), _allocator(nullptr),
+        _user_buffer(nullptr)
   {
     // DO NOTHING
   }
@@ -57,11 +59,31 @@ public:
   // This works just as setBuffer but it simply overwrite existing Allocator without nullptr check
   void overwriteBuffer(const std::shared_ptr<cpu_common::Allocator> &alloc) { _allocator = alloc; }
 
+  /**
+   * @brief Use constant data of a model in place instead of allocating a buffer
+   *
+   * @param data Constant data to share. It must not be written through this tensor
+   * @note  Releasing the last reference of the tensor only drops its share of the data. The data,
+   *        e.g. a mapping of the model file, is kept as long as the operand holds it.
+   */
+  void setData(const std::shared_ptr<const ir::Data> &data)
+  {
+    assert(_buffer == nullptr && _allocator == nullptr && _data == nullptr);
+    assert(data != nullptr && data->size() == total_size());
+    _data = data;
+  }
+  bool hasData() const { return _data != nullptr; }
+  const std::shared_ptr<const ir::Data> &data() const { return _data; }
+
 public:
   uint8_t *buffer() const override
   {
-    if (_allocator != nullptr)
+    if (_user_buffer != nullptr)
+      return _user_buffer;
+    else if (_allocator != nullptr)
       return _allocator->base();
+    else if (_data != nullptr)
+      return const_cast<uint8_t *>(_data->base());
     else
       return _buffer;
   }
@@ -83,29 +105,44 @@ public:
   ir::DataType data_type() const override { return _info.typeInfo().type(); }
   float data_scale() const { return _info.typeInfo().scale(); }
   int32_t data_offset() const { return _info.typeInfo().offset(); }
+  // Empty unless quantized per channel
+  const std::vector<float> &data_scales() const { return _info.typeInfo().scales(); }
+  const std::vector<int32_t> &data_offsets() const { return _info.typeInfo().offsets(); }
   bool has_padding() const override { return false; }
   void access(const std::function<void(ITensor &tensor)> &fn) final;
   bool is_dynamic() const override { return _info.isDynamic(); }
-  void set_dynamic() override { _info.setDynamic(); }
+  void set_dynamic() override
+  {
+    _info.setDynamic();
+    // User buffer cannot hold the tensor whose shape is changing
+    _user_buffer = nullptr;
+  }
+  bool setUserBuffer(uint8_t *buffer) override
+  {
+    _user_buffer = buffer;
+    return true;
+  }
 
   void increase_ref()
   {
     assert(is_dynamic() ||
            // when not dynamic
-           (_buffer != nullptr || _allocator != nullptr));
+           (_buffer != nullptr || _allocator != nullptr || _data != nullptr));
 
     ++_num_references;
   }
   void decrease_ref()
   {
-    assert(_buffer != nullptr || _allocator != nullptr);
+    assert(_buffer != nullptr || _allocator != nullptr || _data != nullptr);
     assert(_num_references > 0);
     --_num_references;
-    // Only constant tensor has allocator pointer
+    // Only constant tensor has allocator pointer or shared data
     if (_num_references == 0)
     {
       if (_buffer != nullptr)
         _buffer = nullptr;
+      else if (_data != nullptr)
+        _data = nullptr;
       else
       {
         _allocator->release();
@@ -137,6 +174,8 @@ private:
   uint8_t *_buffer;
   int32_t _num_references;
   std::shared_ptr<cpu_common::Allocator> _allocator;
+  uint8_t *_user_buffer;
+  std::shared_ptr<const ir::Data> _data;
 };
 
 } // namespace cpu
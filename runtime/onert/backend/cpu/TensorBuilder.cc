@@ -19,6 +19,8 @@
 #include <util/logging.h>
 
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
 
 namespace onert
 {
@@ -27,8 +29,10 @@ namespace backend
 namespace cpu
 {
 
-TensorBuilder::TensorBuilder()
-    : _tensor_reg{new TensorRegistry()}, _static_tensor_mgr{new StaticTensorManager(_tensor_reg)},
+TensorBuilder::TensorBuilder(const ir::Operands &operands, bool use_constants_in_place)
+    : _operands{operands}, _use_constants_in_place{use_constants_in_place},
+      _tensor_reg{new TensorRegistry()},
+      _static_tensor_mgr{new StaticTensorManager(_tensor_reg)},
       _dynamic_tensor_mgr{new DynamicTensorManager(_tensor_reg)}
 {
   /* empty */
@@ -49,6 +53,20 @@ void TensorBuilder::registerTensorInfo(const ir::OperandIndex &ind, const ir::Op
   else
   {
     _static_tensor_mgr->buildTensor(ind, info, _constants.contains(ind));
+
+    // Constant data is used in place, so neither a copy nor an allocation is needed for it.
+    // Pages of data mapped from a model file are loaded on demand and shared with the page cache,
+    // and execution contexts compiled from the same model share the same data.
+    if (as_const && _use_constants_in_place && _operands.exist(ind))
+    {
+      auto data = _operands.at(ind).shareData();
+      const auto address = reinterpret_cast<uintptr_t>(data ? data->base() : nullptr);
+      // Unaligned data is copied to an allocated buffer, since kernels may load it aligned
+      if (data != nullptr && address % alignof(std::max_align_t) == 0)
+      {
+        at(ind)->setData(data);
+      }
+    }
   }
 }
 
@@ -24,6 +24,7 @@
 
 #include <backend/ITensorBuilder.h>
 #include <ir/OperandIndexMap.h>
+#include <ir/Operands.h>
 
 #include <unordered_map>
 
@@ -37,7 +38,14 @@ namespace cpu
 class TensorBuilder : public ITensorBuilder
 {
 public:
-  TensorBuilder();
+  /**
+   * @brief Construct a TensorBuilder object
+   *
+   * @param operands               Operands of the graph
+   * @param use_constants_in_place Whether constant data of operands can be used without being
+   *                               permuted to the layout of the backend
+   */
+  TensorBuilder(const ir::Operands &operands, bool use_constants_in_place);
 
   bool supportDynamicTensor() override { return true; }
 
@@ -85,6 +93,8 @@ public:
   std::shared_ptr<ITensorRegistry> tensorRegistry() override { return _tensor_reg; }
 
 private:
+  const ir::Operands &_operands;
+  const bool _use_constants_in_place;
   const std::shared_ptr<TensorRegistry> _tensor_reg;
   std::unique_ptr<StaticTensorManager> _static_tensor_mgr;
   std::unique_ptr<DynamicTensorManager> _dynamic_tensor_mgr;
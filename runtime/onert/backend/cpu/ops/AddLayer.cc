@@ -29,41 +29,36 @@ namespace ops
 
 void AddLayer::addFloat32()
 {
-  float output_activation_min, output_activation_max;
-  CalculateActivationRangeFloat(_activation, &output_activation_min, &output_activation_max);
-  nnfw::cker::BinaryArithmeticOpParam op_params;
-  op_params.type = nnfw::cker::BinaryArithmeticOpType::ADD;
-  op_params.float_activation_max = output_activation_max;
-  op_params.float_activation_min = output_activation_min;
-
-  const bool need_broadcast =
-      nnfw::cker::ProcessBroadcastShapes(getTensorShape(_lhs), getTensorShape(_rhs), &op_params);
-  if (need_broadcast)
+  if (_need_broadcast)
   {
     nnfw::cker::BroadcastBinaryArithmeticOp(
-        op_params, getTensorShape(_lhs), reinterpret_cast<const float *>(_lhs->buffer()),
-        getTensorShape(_rhs), reinterpret_cast<const float *>(_rhs->buffer()),
-        getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()));
+        _op_params, _lhs_shape, reinterpret_cast<const float *>(_lhs->buffer()), _rhs_shape,
+        reinterpret_cast<const float *>(_rhs->buffer()), _output_shape,
+        reinterpret_cast<float *>(_output->buffer()));
     return;
   }
 
   nnfw::cker::BinaryArithmeticOp(
-      op_params, getTensorShape(_lhs), reinterpret_cast<const float *>(_lhs->buffer()),
-      getTensorShape(_rhs), reinterpret_cast<const float *>(_rhs->buffer()),
-      getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()));
+      _op_params, _lhs_shape, reinterpret_cast<const float *>(_lhs->buffer()), _rhs_shape,
+      reinterpret_cast<const float *>(_rhs->buffer()), _output_shape,
+      reinterpret_cast<float *>(_output->buffer()));
 }
 
 void AddLayer::addQuant8()
 {
-  int32_t output_activation_min, output_activation_max;
-  CalculateActivationRangeUint8(_activation, _output, &output_activation_min,
-                                &output_activation_max);
-  // nnfw::cker::BinaryArithmeticOpParam op_params;
-  // op_params.quantized_activation_max = output_activation_max;
-  // op_params.quantized_activation_min = output_activation_min;
+  if (_need_broadcast)
+  {
+    nnfw::cker::BroadcastBinaryArithmeticOp(
+        _op_params, _lhs_shape, reinterpret_cast<const uint8_t *>(_lhs->buffer()), _rhs_shape,
+        reinterpret_cast<const uint8_t *>(_rhs->buffer()), _output_shape,
+        reinterpret_cast<uint8_t *>(_output->buffer()));
+    return;
+  }
 
-  // cker quant8 add is not implemented yet
-  throw std::runtime_error{"NYI"};
+  nnfw::cker::BinaryArithmeticOp(
+      _op_params, _lhs_shape, reinterpret_cast<const uint8_t *>(_lhs->buffer()), _rhs_shape,
+      reinterpret_cast<const uint8_t *>(_rhs->buffer()), _output_shape,
+      reinterpret_cast<uint8_t *>(_output->buffer()));
 }
 
 void AddLayer::configure(const Tensor *lhs, const Tensor *rhs, const ir::Activation activation,
@@ -79,8 +74,44 @@ void AddLayer::configure(const Tensor *lhs, const Tensor *rhs, const ir::Activat
   _output = output;
 }
 
+void AddLayer::prepare()
+{
+  _op_params.type = nnfw::cker::BinaryArithmeticOpType::ADD;
+  if (_lhs->data_type() == OperandType::FLOAT32)
+  {
+    CalculateActivationRangeFloat(_activation, &_op_params.float_activation_min,
+                                  &_op_params.float_activation_max);
+  }
+  else if (_lhs->data_type() == OperandType::QUANT_UINT8_ASYMM)
+  {
+    CalculateActivationRangeUint8(_activation, _output, &_op_params.quantized_activation_min,
+                                  &_op_params.quantized_activation_max);
+    GetQuantizedAddParams(_lhs, _rhs, _output, &_op_params);
+  }
+
+  updateTensorShape(_lhs, &_lhs_shape);
+  updateTensorShape(_rhs, &_rhs_shape);
+  updateTensorShape(_output, &_output_shape);
+  _need_broadcast = nnfw::cker::ProcessBroadcastShapes(_lhs_shape, _rhs_shape, &_op_params);
+  _prepared = true;
+}
+
 void AddLayer::run()
 {
+  if (!_prepared)
+  {
+    prepare();
+  }
+  else if (_lhs->is_dynamic() || _rhs->is_dynamic() || _output->is_dynamic())
+  {
+    // Shape-dependent parameters are rebuilt only when a shape actually changed
+    bool changed = updateTensorShape(_lhs, &_lhs_shape);
+    changed |= updateTensorShape(_rhs, &_rhs_shape);
+    changed |= updateTensorShape(_output, &_output_shape);
+    if (changed)
+      _need_broadcast = nnfw::cker::ProcessBroadcastShapes(_lhs_shape, _rhs_shape, &_op_params);
+  }
+
   if (_lhs->data_type() == OperandType::FLOAT32)
   {
     addFloat32();
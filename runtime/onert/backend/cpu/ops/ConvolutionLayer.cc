@@ -26,17 +26,25 @@ namespace cpu
 {
 namespace ops
 {
+
 ConvolutionLayer::ConvolutionLayer()
     : _input(nullptr), _kernel(nullptr), _bias(nullptr), _output(nullptr),
       _paddingType(ir::PaddingType::EXPLICIT), _paddingLeft(0), _paddingTop(0), _paddingRight(0),
       _paddingBottom(0), _strideWidth(0), _strideHeight(0), _activation(ir::Activation::NONE),
-      _conv_kernel(new nnfw::cker::Conv()), _prepare(false)
+      _is_kernel_constant(false), _conv_kernel(new nnfw::cker::Conv()), _prepare(false)
 {
   // DO NOTHING
 }
 
 ConvolutionLayer::~ConvolutionLayer() = default;
 
+void ConvolutionLayer::shareFilter(const std::shared_ptr<ir::PreparedDataCache> &cache,
+                                   const ir::OperandIndex &kernel_index)
+{
+  _prepared_data_cache = cache;
+  _kernel_index = kernel_index;
+}
+
 void ConvolutionLayer::convFloat32()
 {
   float output_activation_min, output_activation_max;
@@ -53,12 +61,37 @@ void ConvolutionLayer::convFloat32()
   op_params.float_activation_min = output_activation_min;
   op_params.float_activation_max = output_activation_max;
 
+  // Constant kernel may be stored as fp16 to halve its memory, and then computed in float
+  const bool is_fp16_kernel = _kernel->data_type() == OperandType::FLOAT16;
+
   nnfw::cker::Conv &kernel = *_conv_kernel;
-  if (!_prepare)
+  // fp16 kernel is used in place and converted panel by panel in each run, so it is not prepared
+  if (!_prepare && !is_fp16_kernel)
   {
     bool is_replaced_weights = false;
-    kernel.prepare(getTensorShape(_kernel), reinterpret_cast<const float *>(_kernel->buffer()),
-                   op_params.padding_type, is_replaced_weights);
+    // Filter is transposed only if padding is not explicit, and otherwise used as it is
+    if (_prepared_data_cache && _kernel->hasData() &&
+        op_params.padding_type != nnfw::cker::PaddingType::kNone)
+    {
+      // Constant kernel used in place is transposed only once for all contexts using it
+      auto filter = std::static_pointer_cast<const std::vector<float>>(
+          _prepared_data_cache->get(_kernel_index, _kernel->data(), [&]() {
+            kernel.prepare(getTensorShape(_kernel),
+                           reinterpret_cast<const float *>(_kernel->data()->base()),
+                           op_params.padding_type, is_replaced_weights);
+            return std::shared_ptr<const void>{kernel.modifiedFilterData()};
+          }));
+      if (filter != nullptr)
+      {
+        kernel.prepare(filter);
+        is_replaced_weights = true;
+      }
+    }
+    else
+    {
+      kernel.prepare(getTensorShape(_kernel), reinterpret_cast<const float *>(_kernel->buffer()),
+                     op_params.padding_type, is_replaced_weights);
+    }
 
     if (is_replaced_weights)
     {
@@ -67,6 +100,15 @@ void ConvolutionLayer::convFloat32()
     }
     _prepare = true;
   }
+
+  if (is_fp16_kernel)
+  {
+    kernel(op_params, getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
+           getTensorShape(_kernel), reinterpret_cast<const uint16_t *>(_kernel->buffer()),
+           getTensorShape(_bias), reinterpret_cast<const float *>(_bias->buffer()),
+           getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()));
+    return;
+  }
   kernel(op_params, getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
          getTensorShape(_kernel), reinterpret_cast<const float *>(_kernel->buffer()),
          getTensorShape(_bias), reinterpret_cast<const float *>(_bias->buffer()),
@@ -115,12 +157,47 @@ void ConvolutionLayer::convQuant8()
          getTensorShape(_output), reinterpret_cast<uint8_t *>(_output->buffer()));
 }
 
+void ConvolutionLayer::convInt8PerChannel()
+{
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
+
+  nnfw::cker::ConvParams op_params;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = 1;
+  op_params.dilation_height_factor = 1;
+  op_params.padding_type = getPaddingType(_paddingType);
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.input_offset = -_input->data_offset();
+  op_params.output_offset = _output->data_offset();
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+  op_params.lhs_cacheable = _is_kernel_constant;
+
+  nnfw::cker::Conv &kernel = *_conv_kernel;
+  if (!_prepare)
+  {
+    kernel.prepareQuant(getTensorShape(_input), getTensorShape(_kernel), getTensorShape(_output),
+                        _strideWidth, _strideHeight);
+    _prepare = true;
+  }
+  kernel(op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+         getTensorShape(_input), reinterpret_cast<const int8_t *>(_input->buffer()),
+         getTensorShape(_kernel), reinterpret_cast<const int8_t *>(_kernel->buffer()),
+         getTensorShape(_bias), reinterpret_cast<const int32_t *>(_bias->buffer()),
+         getTensorShape(_output), reinterpret_cast<int8_t *>(_output->buffer()));
+}
+
 void ConvolutionLayer::configure(const Tensor *input, const Tensor *kernel, const Tensor *bias,
                                  const ir::PaddingType paddingType, const uint32_t paddingLeft,
                                  const uint32_t paddingRight, const uint32_t paddingTop,
                                  const uint32_t paddingBottom, const uint32_t strideWidth,
                                  const uint32_t strideHeight, const ir::Activation activation,
-                                 Tensor *output)
+                                 Tensor *output, bool is_kernel_constant)
 {
   _input = input;
   _kernel = kernel;
@@ -134,6 +211,16 @@ void ConvolutionLayer::configure(const Tensor *input, const Tensor *kernel, cons
   _strideHeight = strideHeight;
   _activation = activation;
   _output = output;
+  _is_kernel_constant = is_kernel_constant;
+
+  if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    // Kernel format is [depth_out, kernel_height, kernel_width, depth_in]
+    GetQuantizedConvolutionPerChannelMultipliers(_input, _kernel, _output,
+                                                 getSizeOfDimension(_kernel, 0),
+                                                 &_per_channel_output_multiplier,
+                                                 &_per_channel_output_shift);
+  }
 }
 
 void ConvolutionLayer::run()
@@ -146,6 +233,10 @@ void ConvolutionLayer::run()
   {
     convQuant8();
   }
+  else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    convInt8PerChannel();
+  }
 }
 
 #undef ANDROID_NN_CONV_PARAMETERS
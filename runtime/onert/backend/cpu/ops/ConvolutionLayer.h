@@ -21,8 +21,10 @@
 #include "OperationUtils.h"
 
 #include <exec/IFunction.h>
+#include <ir/PreparedDataCache.h>
 #include <functional>
 #include <memory>
+#include <vector>
 
 namespace nnfw
 {
@@ -52,11 +54,20 @@ public:
 
   void convQuant8();
 
+  void convInt8PerChannel();
+
   void configure(const Tensor *input, const Tensor *kernel, const Tensor *bias,
                  const ir::PaddingType paddingType, const uint32_t paddingLeft,
                  const uint32_t paddingRight, const uint32_t paddingTop,
                  const uint32_t paddingBottom, const uint32_t strideW, const uint32_t strideH,
-                 const ir::Activation activation, Tensor *output);
+                 const ir::Activation activation, Tensor *output, bool is_kernel_constant = false);
+
+  /**
+   * @brief Share the filter prepared from the constant kernel through the cache, with the Convs of
+   *        other graphs of the cache, e.g. of other execution contexts
+   */
+  void shareFilter(const std::shared_ptr<ir::PreparedDataCache> &cache,
+                   const ir::OperandIndex &kernel_index);
 
   void run();
   void runSync()
@@ -82,8 +93,15 @@ private:
   uint32_t _strideHeight;
 
   ir::Activation _activation;
+  bool _is_kernel_constant;
+
+  // Requantization of each output channel of int8
+  std::vector<int32_t> _per_channel_output_multiplier;
+  std::vector<int> _per_channel_output_shift;
 
   std::unique_ptr<nnfw::cker::Conv> _conv_kernel;
+  std::shared_ptr<ir::PreparedDataCache> _prepared_data_cache;
+  ir::OperandIndex _kernel_index;
 
   bool _prepare;
 };
@@ -51,6 +51,17 @@ void DepthwiseConvolutionLayer::convFloat32()
   op_params.float_activation_min = output_activation_min;
   op_params.float_activation_max = output_activation_max;
 
+  if (_kernel->data_type() == OperandType::FLOAT16)
+  {
+    // Constant kernel stored as fp16 is computed in float
+    nnfw::cker::DepthwiseConv(
+        op_params, getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
+        getTensorShape(_kernel), reinterpret_cast<const uint16_t *>(_kernel->buffer()),
+        getTensorShape(_bias), reinterpret_cast<const float *>(_bias->buffer()),
+        getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()));
+    return;
+  }
+
   nnfw::cker::DepthwiseConv(
       op_params, getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
       getTensorShape(_kernel), reinterpret_cast<const float *>(_kernel->buffer()),
@@ -94,6 +105,34 @@ void DepthwiseConvolutionLayer::convQuant8()
       getTensorShape(_output), reinterpret_cast<uint8_t *>(_output->buffer()));
 }
 
+void DepthwiseConvolutionLayer::convInt8PerChannel()
+{
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
+
+  nnfw::cker::DepthwiseConvParams op_params;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = 1;
+  op_params.dilation_height_factor = 1;
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.depth_multiplier = _multiplier;
+  op_params.input_offset = -_input->data_offset();
+  op_params.output_offset = _output->data_offset();
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+
+  nnfw::cker::DepthwiseConvPerChannel(
+      op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+      getTensorShape(_input), reinterpret_cast<const int8_t *>(_input->buffer()),
+      getTensorShape(_kernel), reinterpret_cast<const int8_t *>(_kernel->buffer()),
+      getTensorShape(_bias), reinterpret_cast<const int32_t *>(_bias->buffer()),
+      getTensorShape(_output), reinterpret_cast<int8_t *>(_output->buffer()));
+}
+
 void DepthwiseConvolutionLayer::configure(const Tensor *input, const Tensor *kernel,
                                           const Tensor *bias, const uint32_t paddingLeft,
                                           const uint32_t paddingRight, const uint32_t paddingTop,
@@ -113,6 +152,15 @@ void DepthwiseConvolutionLayer::configure(const Tensor *input, const Tensor *ker
   _multiplier = multiplier;
   _activation = activation;
   _output = output;
+
+  if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    // Kernel format is [1, kernel_height, kernel_width, depth_out]
+    GetQuantizedConvolutionPerChannelMultipliers(_input, _kernel, _output,
+                                                 getSizeOfDimension(_kernel, 3),
+                                                 &_per_channel_output_multiplier,
+                                                 &_per_channel_output_shift);
+  }
 }
 
 void DepthwiseConvolutionLayer::run()
@@ -125,6 +173,10 @@ void DepthwiseConvolutionLayer::run()
   {
     convQuant8();
   }
+  else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    convInt8PerChannel();
+  }
 }
 
 } // namespace ops
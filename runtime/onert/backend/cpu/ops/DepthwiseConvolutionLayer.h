@@ -41,6 +41,8 @@ public:
 
   void convQuant8();
 
+  void convInt8PerChannel();
+
   void configure(const Tensor *input, const Tensor *kernel, const Tensor *bias,
                  const uint32_t paddingLeft, const uint32_t paddingRight, const uint32_t paddingTop,
                  const uint32_t paddingBottom, const uint32_t strideW, const uint32_t strideH,
@@ -71,6 +73,10 @@ private:
   uint32_t _multiplier;
 
   ir::Activation _activation;
+
+  // Requantization of each output channel of int8
+  std::vector<int32_t> _per_channel_output_multiplier;
+  std::vector<int> _per_channel_output_shift;
 };
 
 } // namespace ops
@@ -29,28 +29,19 @@ namespace ops
 
 void DivLayer::divFloat32()
 {
-  float output_activation_min, output_activation_max;
-  CalculateActivationRangeFloat(_activation, &output_activation_min, &output_activation_max);
-  nnfw::cker::BinaryArithmeticOpParam op_params;
-  op_params.type = nnfw::cker::BinaryArithmeticOpType::DIV;
-  op_params.float_activation_max = output_activation_max;
-  op_params.float_activation_min = output_activation_min;
-
-  const bool need_broadcast =
-      nnfw::cker::ProcessBroadcastShapes(getTensorShape(_lhs), getTensorShape(_rhs), &op_params);
-  if (need_broadcast)
+  if (_need_broadcast)
   {
     nnfw::cker::BroadcastBinaryArithmeticOp(
-        op_params, getTensorShape(_lhs), reinterpret_cast<const float *>(_lhs->buffer()),
-        getTensorShape(_rhs), reinterpret_cast<const float *>(_rhs->buffer()),
-        getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()));
+        _op_params, _lhs_shape, reinterpret_cast<const float *>(_lhs->buffer()), _rhs_shape,
+        reinterpret_cast<const float *>(_rhs->buffer()), _output_shape,
+        reinterpret_cast<float *>(_output->buffer()));
     return;
   }
 
   nnfw::cker::BinaryArithmeticOp(
-      op_params, getTensorShape(_lhs), reinterpret_cast<const float *>(_lhs->buffer()),
-      getTensorShape(_rhs), reinterpret_cast<const float *>(_rhs->buffer()),
-      getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()));
+      _op_params, _lhs_shape, reinterpret_cast<const float *>(_lhs->buffer()), _rhs_shape,
+      reinterpret_cast<const float *>(_rhs->buffer()), _output_shape,
+      reinterpret_cast<float *>(_output->buffer()));
 }
 
 void DivLayer::divQuant8()
@@ -75,8 +66,38 @@ void DivLayer::configure(const Tensor *lhs, const Tensor *rhs, const ir::Activat
   _output = output;
 }
 
+void DivLayer::prepare()
+{
+  _op_params.type = nnfw::cker::BinaryArithmeticOpType::DIV;
+  if (_output->data_type() == OperandType::FLOAT32)
+  {
+    CalculateActivationRangeFloat(_activation, &_op_params.float_activation_min,
+                                  &_op_params.float_activation_max);
+  }
+
+  updateTensorShape(_lhs, &_lhs_shape);
+  updateTensorShape(_rhs, &_rhs_shape);
+  updateTensorShape(_output, &_output_shape);
+  _need_broadcast = nnfw::cker::ProcessBroadcastShapes(_lhs_shape, _rhs_shape, &_op_params);
+  _prepared = true;
+}
+
 void DivLayer::run()
 {
+  if (!_prepared)
+  {
+    prepare();
+  }
+  else if (_lhs->is_dynamic() || _rhs->is_dynamic() || _output->is_dynamic())
+  {
+    // Shape-dependent parameters are rebuilt only when a shape actually changed
+    bool changed = updateTensorShape(_lhs, &_lhs_shape);
+    changed |= updateTensorShape(_rhs, &_rhs_shape);
+    changed |= updateTensorShape(_output, &_output_shape);
+    if (changed)
+      _need_broadcast = nnfw::cker::ProcessBroadcastShapes(_lhs_shape, _rhs_shape, &_op_params);
+  }
+
   if (_output->data_type() == OperandType::FLOAT32)
   {
     divFloat32();
@@ -18,6 +18,8 @@
 
 #include <cker/operation/FullyConnected.h>
 
+#include <stdexcept>
+
 namespace onert
 {
 namespace backend
@@ -29,7 +31,8 @@ namespace ops
 
 FullyConnectedLayer::FullyConnectedLayer()
     : _input(nullptr), _weights(nullptr), _bias(nullptr), _output(nullptr),
-      _activation(ir::Activation::NONE), _temp_arena(new nnfw::cker::FCTempArena())
+      _activation(ir::Activation::NONE), _is_weights_constant(false),
+      _temp_arena(new nnfw::cker::FCTempArena())
 {
   // DO NOTHING
 }
@@ -53,6 +56,18 @@ void FullyConnectedLayer::fullyConnectedFloat32()
       getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()));
 }
 
+void FullyConnectedLayer::fullyConnectedFp16Weights()
+{
+  nnfw::cker::FullyConnectedParams op_params;
+  op_params.activation = convertActivationType(_activation);
+
+  nnfw::cker::FullyConnected(
+      op_params, getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
+      getTensorShape(_weights), reinterpret_cast<const uint16_t *>(_weights->buffer()),
+      getTensorShape(_bias), reinterpret_cast<const float *>(_bias ? _bias->buffer() : nullptr),
+      getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()));
+}
+
 // executionMutex is used to protect concurrent access of non-threadsafe resources
 // like gemmlowp::GemmContext.
 void FullyConnectedLayer::fullyConnectedQuant8()
@@ -75,6 +90,7 @@ void FullyConnectedLayer::fullyConnectedQuant8()
   op_params.output_shift = output_shift;
   op_params.quantized_activation_min = output_activation_min;
   op_params.quantized_activation_max = output_activation_max;
+  op_params.lhs_cacheable = _is_weights_constant;
 
   nnfw::cker::FullyConnected(
       op_params, getTensorShape(_input), reinterpret_cast<const uint8_t *>(_input->buffer()),
@@ -102,14 +118,54 @@ void FullyConnectedLayer::fullyConnectedHybrid()
       getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()), temp_arena);
 }
 
+void FullyConnectedLayer::fullyConnectedInt8PerChannel()
+{
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
+
+  nnfw::cker::FullyConnectedParams op_params;
+  op_params.input_offset = -_input->data_offset();
+  op_params.output_offset = _output->data_offset();
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+  op_params.lhs_cacheable = _is_weights_constant;
+
+  nnfw::cker::FullyConnectedPerChannel(
+      op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+      getTensorShape(_input), reinterpret_cast<const int8_t *>(_input->buffer()),
+      getTensorShape(_weights), reinterpret_cast<const int8_t *>(_weights->buffer()),
+      getTensorShape(_bias), reinterpret_cast<const int32_t *>(_bias ? _bias->buffer() : nullptr),
+      getTensorShape(_output), reinterpret_cast<int8_t *>(_output->buffer()));
+}
+
 void FullyConnectedLayer::configure(const Tensor *input, const Tensor *weights, const Tensor *bias,
-                                    ir::Activation activation, Tensor *output)
+                                    ir::Activation activation, Tensor *output,
+                                    bool is_weights_constant)
 {
   _input = input;
   _weights = weights;
   _bias = bias;
   _activation = activation;
   _output = output;
+  _is_weights_constant = is_weights_constant;
+
+  // The hybrid kernel scales all rows by one scale
+  if (_input->data_type() == OperandType::FLOAT32 &&
+      _weights->data_type() == OperandType::QUANT_INT8_SYMM && _weights->data_scales().size() > 1)
+  {
+    throw std::runtime_error{"FullyConnected: NYI for hybrid with per-channel weights"};
+  }
+
+  if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    // Weights format is [num_units, input_size]
+    GetQuantizedConvolutionPerChannelMultipliers(_input, _weights, _output,
+                                                 getSizeOfDimension(_weights, 0),
+                                                 &_per_channel_output_multiplier,
+                                                 &_per_channel_output_shift);
+  }
 }
 
 void FullyConnectedLayer::run()
@@ -120,6 +176,10 @@ void FullyConnectedLayer::run()
     {
       fullyConnectedHybrid();
     }
+    else if (_weights->data_type() == OperandType::FLOAT16)
+    {
+      fullyConnectedFp16Weights();
+    }
     else
     {
       fullyConnectedFloat32();
@@ -129,6 +189,10 @@ void FullyConnectedLayer::run()
   {
     fullyConnectedQuant8();
   }
+  else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    fullyConnectedInt8PerChannel();
+  }
 }
 
 } // namespace ops
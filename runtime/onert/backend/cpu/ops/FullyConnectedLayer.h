@@ -52,8 +52,12 @@ public:
 
   void fullyConnectedHybrid();
 
+  void fullyConnectedFp16Weights();
+
+  void fullyConnectedInt8PerChannel();
+
   void configure(const Tensor *input, const Tensor *weights, const Tensor *bias,
-                 ir::Activation activation, Tensor *output);
+                 ir::Activation activation, Tensor *output, bool is_weights_constant = false);
 
   void run();
   void runSync()
@@ -70,7 +74,12 @@ private:
   Tensor *_output;
 
   ir::Activation _activation;
+  bool _is_weights_constant;
   std::unique_ptr<nnfw::cker::FCTempArena> _temp_arena;
+
+  // Requantization of each output channel of int8
+  std::vector<int32_t> _per_channel_output_multiplier;
+  std::vector<int> _per_channel_output_shift;
 };
 
 } // namespace ops
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "LSTMLayer.h"
+
+#include <cker/operation/LSTM.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+namespace
+{
+
+template <typename T> const T *bufferOf(const Tensor *tensor)
+{
+  return tensor ? reinterpret_cast<const T *>(tensor->buffer()) : nullptr;
+}
+
+float scaleOf(const Tensor *tensor) { return tensor ? tensor->data_scale() : 0.f; }
+
+} // namespace
+
+LSTMLayer::LSTMLayer()
+    : _input(nullptr), _input_to_gate_weights(), _recurrent_to_gate_weights(),
+      _cell_to_gate_weights(), _gate_biases(), _projection_weights(nullptr),
+      _projection_bias(nullptr), _output_state_in(nullptr), _cell_state_in(nullptr),
+      _scratch_buffer(nullptr), _output_state_out(nullptr), _cell_state_out(nullptr),
+      _output(nullptr), _activation(ir::Activation::NONE), _cell_clip(0.f), _projection_clip(0.f),
+      _is_weights_constant(false), _lstm_kernel(new nnfw::cker::LSTM()), _prepare(false)
+{
+  // DO NOTHING
+}
+
+LSTMLayer::~LSTMLayer() = default;
+
+template <typename T> void LSTMLayer::lstm()
+{
+  nnfw::cker::LSTMWeights<T> weights;
+  for (int gate = 0; gate < nnfw::cker::kLSTMNumGates; ++gate)
+  {
+    weights.input_to_gate[gate] = bufferOf<T>(_input_to_gate_weights[gate]);
+    weights.recurrent_to_gate[gate] = bufferOf<T>(_recurrent_to_gate_weights[gate]);
+    weights.cell_to_gate[gate] = bufferOf<T>(_cell_to_gate_weights[gate]);
+    weights.gate_bias[gate] = bufferOf<float>(_gate_biases[gate]);
+    weights.input_to_gate_scale[gate] = scaleOf(_input_to_gate_weights[gate]);
+    weights.recurrent_to_gate_scale[gate] = scaleOf(_recurrent_to_gate_weights[gate]);
+    weights.cell_to_gate_scale[gate] = scaleOf(_cell_to_gate_weights[gate]);
+  }
+  weights.projection = bufferOf<T>(_projection_weights);
+  weights.projection_bias = bufferOf<float>(_projection_bias);
+  weights.projection_scale = scaleOf(_projection_weights);
+
+  nnfw::cker::LSTMParams op_params;
+  op_params.activation = convertActivationType(_activation);
+  op_params.cell_clip = _cell_clip;
+  op_params.proj_clip = _projection_clip;
+
+  const int n_batch = _input->dimension(0);
+  const int n_input = _input->dimension(1);
+  const int n_cell = _input_to_gate_weights[nnfw::cker::kLSTMOutputGate]->dimension(0);
+  const int n_output = _recurrent_to_gate_weights[nnfw::cker::kLSTMOutputGate]->dimension(1);
+
+  nnfw::cker::LSTM &kernel = *_lstm_kernel;
+  if (!_prepare && _is_weights_constant)
+  {
+    kernel.prepare(weights, n_input, n_cell, n_output);
+    _prepare = true;
+  }
+  kernel(op_params, weights, n_batch, n_input, n_cell, n_output,
+         reinterpret_cast<const float *>(_input->buffer()),
+         reinterpret_cast<const float *>(_output_state_in->buffer()),
+         reinterpret_cast<const float *>(_cell_state_in->buffer()),
+         reinterpret_cast<float *>(_scratch_buffer->buffer()),
+         reinterpret_cast<float *>(_output_state_out->buffer()),
+         reinterpret_cast<float *>(_cell_state_out->buffer()),
+         reinterpret_cast<float *>(_output->buffer()));
+}
+
+void LSTMLayer::configure(const Tensor *input, const GateTensors &input_to_gate_weights,
+                          const GateTensors &recurrent_to_gate_weights,
+                          const GateTensors &cell_to_gate_weights, const GateTensors &gate_biases,
+                          const Tensor *projection_weights, const Tensor *projection_bias,
+                          const Tensor *output_state_in, const Tensor *cell_state_in,
+                          ir::Activation activation, float cell_clip, float projection_clip,
+                          Tensor *scratch_buffer, Tensor *output_state_out,
+                          Tensor *cell_state_out, Tensor *output, bool is_weights_constant)
+{
+  _input = input;
+  _input_to_gate_weights = input_to_gate_weights;
+  _recurrent_to_gate_weights = recurrent_to_gate_weights;
+  _cell_to_gate_weights = cell_to_gate_weights;
+  _gate_biases = gate_biases;
+  _projection_weights = projection_weights;
+  _projection_bias = projection_bias;
+  _output_state_in = output_state_in;
+  _cell_state_in = cell_state_in;
+  _activation = activation;
+  _cell_clip = cell_clip;
+  _projection_clip = projection_clip;
+  _scratch_buffer = scratch_buffer;
+  _output_state_out = output_state_out;
+  _cell_state_out = cell_state_out;
+  _output = output;
+  _is_weights_constant = is_weights_constant;
+}
+
+void LSTMLayer::run()
+{
+  const auto weights_type = _input_to_gate_weights[nnfw::cker::kLSTMOutputGate]->data_type();
+  if (_input->data_type() == OperandType::FLOAT32 && weights_type == OperandType::FLOAT32)
+  {
+    lstm<float>();
+  }
+  else if (_input->data_type() == OperandType::FLOAT32 &&
+           weights_type == OperandType::QUANT_INT8_SYMM)
+  {
+    lstm<int8_t>();
+  }
+  else
+  {
+    throw std::runtime_error{"LSTM: unsupported data type"};
+  }
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
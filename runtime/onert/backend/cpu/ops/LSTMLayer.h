@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_CPU_OPS_LSTMLAYER_H__
+#define __ONERT_BACKEND_CPU_OPS_LSTMLAYER_H__
+
+#include "../Tensor.h"
+#include "OperationUtils.h"
+
+#include <exec/IFunction.h>
+
+#include <array>
+#include <memory>
+
+namespace nnfw
+{
+namespace cker
+{
+class LSTM;
+}
+} // namespace nnfw
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+/**
+ * @brief LSTM whose gates are computed by one GEMM, with float weights or int8 weights of hybrid
+ *        LSTM
+ *
+ * Tensors of gates are indexed by input, forget, cell and output gate in order. Optional tensors
+ * which do not exist are nullptr.
+ */
+class LSTMLayer : public ::onert::exec::IFunction
+{
+public:
+  using GateTensors = std::array<const Tensor *, 4>;
+
+  LSTMLayer();
+  ~LSTMLayer();
+
+public:
+  void configure(const Tensor *input, const GateTensors &input_to_gate_weights,
+                 const GateTensors &recurrent_to_gate_weights,
+                 const GateTensors &cell_to_gate_weights, const GateTensors &gate_biases,
+                 const Tensor *projection_weights, const Tensor *projection_bias,
+                 const Tensor *output_state_in, const Tensor *cell_state_in,
+                 ir::Activation activation, float cell_clip, float projection_clip,
+                 Tensor *scratch_buffer, Tensor *output_state_out, Tensor *cell_state_out,
+                 Tensor *output, bool is_weights_constant = false);
+
+  void run();
+  void runSync()
+  {
+    // this abstract method is used just for profiling and called for
+    // backend::acl_common::AclFunction
+    run();
+  }
+
+private:
+  // T is float, or int8_t for hybrid LSTM
+  template <typename T> void lstm();
+
+private:
+  const Tensor *_input;
+  GateTensors _input_to_gate_weights;
+  GateTensors _recurrent_to_gate_weights;
+  GateTensors _cell_to_gate_weights;
+  GateTensors _gate_biases;
+  const Tensor *_projection_weights;
+  const Tensor *_projection_bias;
+  const Tensor *_output_state_in;
+  const Tensor *_cell_state_in;
+  Tensor *_scratch_buffer;
+  Tensor *_output_state_out;
+  Tensor *_cell_state_out;
+  Tensor *_output;
+
+  ir::Activation _activation;
+  float _cell_clip;
+  float _projection_clip;
+
+  bool _is_weights_constant;
+  std::unique_ptr<nnfw::cker::LSTM> _lstm_kernel;
+
+  bool _prepare;
+};
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_OPS_LSTMLAYER_H__
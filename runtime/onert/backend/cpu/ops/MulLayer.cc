@@ -29,41 +29,36 @@ namespace ops
 
 void MulLayer::mulFloat32()
 {
-  float output_activation_min, output_activation_max;
-  CalculateActivationRangeFloat(_activation, &output_activation_min, &output_activation_max);
-  nnfw::cker::BinaryArithmeticOpParam op_params;
-  op_params.type = nnfw::cker::BinaryArithmeticOpType::MUL;
-  op_params.float_activation_max = output_activation_max;
-  op_params.float_activation_min = output_activation_min;
-
-  const bool need_broadcast =
-      nnfw::cker::ProcessBroadcastShapes(getTensorShape(_lhs), getTensorShape(_rhs), &op_params);
-  if (need_broadcast)
+  if (_need_broadcast)
   {
     nnfw::cker::BroadcastBinaryArithmeticOp(
-        op_params, getTensorShape(_lhs), reinterpret_cast<const float *>(_lhs->buffer()),
-        getTensorShape(_rhs), reinterpret_cast<const float *>(_rhs->buffer()),
-        getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()));
+        _op_params, _lhs_shape, reinterpret_cast<const float *>(_lhs->buffer()), _rhs_shape,
+        reinterpret_cast<const float *>(_rhs->buffer()), _output_shape,
+        reinterpret_cast<float *>(_output->buffer()));
     return;
   }
 
   nnfw::cker::BinaryArithmeticOp(
-      op_params, getTensorShape(_lhs), reinterpret_cast<const float *>(_lhs->buffer()),
-      getTensorShape(_rhs), reinterpret_cast<const float *>(_rhs->buffer()),
-      getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()));
+      _op_params, _lhs_shape, reinterpret_cast<const float *>(_lhs->buffer()), _rhs_shape,
+      reinterpret_cast<const float *>(_rhs->buffer()), _output_shape,
+      reinterpret_cast<float *>(_output->buffer()));
 }
 
 void MulLayer::mulQuant8()
 {
-  int32_t output_activation_min, output_activation_max;
-  CalculateActivationRangeUint8(_activation, _output, &output_activation_min,
-                                &output_activation_max);
-  // nnfw::cker::BinaryArithmeticOpParam op_params;
-  // op_params.quantized_activation_max = output_activation_max;
-  // op_params.quantized_activation_min = output_activation_min;
+  if (_need_broadcast)
+  {
+    nnfw::cker::BroadcastBinaryArithmeticOp(
+        _op_params, _lhs_shape, reinterpret_cast<const uint8_t *>(_lhs->buffer()), _rhs_shape,
+        reinterpret_cast<const uint8_t *>(_rhs->buffer()), _output_shape,
+        reinterpret_cast<uint8_t *>(_output->buffer()));
+    return;
+  }
 
-  // cker quant8 mul is not implemented yet
-  throw std::runtime_error{"Mull NYI for quantized"};
+  nnfw::cker::BinaryArithmeticOp(
+      _op_params, _lhs_shape, reinterpret_cast<const uint8_t *>(_lhs->buffer()), _rhs_shape,
+      reinterpret_cast<const uint8_t *>(_rhs->buffer()), _output_shape,
+      reinterpret_cast<uint8_t *>(_output->buffer()));
 }
 
 void MulLayer::configure(const Tensor *lhs, const Tensor *rhs, const ir::Activation activation,
@@ -75,8 +70,50 @@ void MulLayer::configure(const Tensor *lhs, const Tensor *rhs, const ir::Activat
   _output = output;
 }
 
+void MulLayer::prepare()
+{
+  _op_params.type = nnfw::cker::BinaryArithmeticOpType::MUL;
+  if (_output->data_type() == OperandType::FLOAT32)
+  {
+    CalculateActivationRangeFloat(_activation, &_op_params.float_activation_min,
+                                  &_op_params.float_activation_max);
+  }
+  else if (_output->data_type() == OperandType::QUANT_UINT8_ASYMM)
+  {
+    CalculateActivationRangeUint8(_activation, _output, &_op_params.quantized_activation_min,
+                                  &_op_params.quantized_activation_max);
+    _op_params.input1_offset = -_lhs->data_offset();
+    _op_params.input2_offset = -_rhs->data_offset();
+    _op_params.output_offset = _output->data_offset();
+
+    const double real_multiplier =
+        static_cast<double>(_lhs->data_scale()) * _rhs->data_scale() / _output->data_scale();
+    QuantizeMultiplier(real_multiplier, &_op_params.output_multiplier, &_op_params.output_shift);
+  }
+
+  updateTensorShape(_lhs, &_lhs_shape);
+  updateTensorShape(_rhs, &_rhs_shape);
+  updateTensorShape(_output, &_output_shape);
+  _need_broadcast = nnfw::cker::ProcessBroadcastShapes(_lhs_shape, _rhs_shape, &_op_params);
+  _prepared = true;
+}
+
 void MulLayer::run()
 {
+  if (!_prepared)
+  {
+    prepare();
+  }
+  else if (_lhs->is_dynamic() || _rhs->is_dynamic() || _output->is_dynamic())
+  {
+    // Shape-dependent parameters are rebuilt only when a shape actually changed
+    bool changed = updateTensorShape(_lhs, &_lhs_shape);
+    changed |= updateTensorShape(_rhs, &_rhs_shape);
+    changed |= updateTensorShape(_output, &_output_shape);
+    if (changed)
+      _need_broadcast = nnfw::cker::ProcessBroadcastShapes(_lhs_shape, _rhs_shape, &_op_params);
+  }
+
   if (_output->data_type() == OperandType::FLOAT32)
   {
     mulFloat32();
@@ -55,12 +55,22 @@ public:
     run();
   }
 
+  void prepare() override;
+
 private:
   const Tensor *_lhs;
   const Tensor *_rhs;
   Tensor *_output;
 
   ir::Activation _activation{ir::Activation::NONE};
+
+  // Computed by prepare() and rebuilt only when a dynamic tensor changes its shape
+  nnfw::cker::Shape _lhs_shape;
+  nnfw::cker::Shape _rhs_shape;
+  nnfw::cker::Shape _output_shape;
+  nnfw::cker::BinaryArithmeticOpParam _op_params;
+  bool _need_broadcast{false};
+  bool _prepared{false};
 };
 
 } // namespace ops
@@ -93,6 +93,30 @@ void GetQuantizedConvolutionMultiplier(const Tensor *input, const Tensor *filter
   *multiplier = input_product_scale / output_scale;
 }
 
+void GetQuantizedAddParams(const Tensor *lhs, const Tensor *rhs, const Tensor *output,
+                           nnfw::cker::BinaryArithmeticOpParam *op_params)
+{
+  op_params->input1_offset = -lhs->data_offset();
+  op_params->input2_offset = -rhs->data_offset();
+  op_params->output_offset = output->data_offset();
+
+  // 20 bits of headroom keep the rescaled uint8 inputs and their sum in int32
+  op_params->left_shift = 20;
+  const double twice_max_input_scale =
+      2 * static_cast<double>(std::max(lhs->data_scale(), rhs->data_scale()));
+  const double real_input1_multiplier = lhs->data_scale() / twice_max_input_scale;
+  const double real_input2_multiplier = rhs->data_scale() / twice_max_input_scale;
+  const double real_output_multiplier =
+      twice_max_input_scale / ((1 << op_params->left_shift) * output->data_scale());
+
+  QuantizeMultiplier(real_input1_multiplier, &op_params->input1_multiplier,
+                     &op_params->input1_shift);
+  QuantizeMultiplier(real_input2_multiplier, &op_params->input2_multiplier,
+                     &op_params->input2_shift);
+  QuantizeMultiplier(real_output_multiplier, &op_params->output_multiplier,
+                     &op_params->output_shift);
+}
+
 void QuantizeMultiplierGreaterThanOne(double double_multiplier, int32_t *quantized_multiplier,
                                       int *left_shift)
 {
@@ -144,11 +168,53 @@ void CalculateActivationRangeFloat(ir::Activation activation, float *activation_
   }
 }
 
+void GetQuantizedConvolutionPerChannelMultipliers(const Tensor *input, const Tensor *filter,
+                                                  const Tensor *output, int num_channels,
+                                                  std::vector<int32_t> *multipliers,
+                                                  std::vector<int> *shifts)
+{
+  const auto &filter_scales = filter->data_scales();
+  assert(filter_scales.empty() || static_cast<int>(filter_scales.size()) == num_channels);
+  const auto &filter_offsets = filter->data_offsets();
+  if (filter->data_offset() != 0 ||
+      std::any_of(filter_offsets.begin(), filter_offsets.end(), [](int32_t o) { return o != 0; }))
+  {
+    throw std::runtime_error{"CPU backend: int8 weights must be quantized symmetrically"};
+  }
+  multipliers->resize(num_channels);
+  shifts->resize(num_channels);
+  const double input_scale = input->data_scale();
+  const double output_scale = output->data_scale();
+  for (int c = 0; c < num_channels; ++c)
+  {
+    // A filter quantized per tensor shares its scale among channels
+    const double filter_scale = filter_scales.empty() ? filter->data_scale() : filter_scales[c];
+    QuantizeMultiplier(input_scale * filter_scale / output_scale, &(*multipliers)[c],
+                       &(*shifts)[c]);
+  }
+}
+
 void CalculateActivationRangeUint8(ir::Activation activation, const Tensor *output,
                                    int32_t *act_min, int32_t *act_max)
 {
-  const int32_t qmin = std::numeric_limits<uint8_t>::min();
-  const int32_t qmax = std::numeric_limits<uint8_t>::max();
+  CalculateActivationRangeQuantized(activation, output, act_min, act_max);
+}
+
+void CalculateActivationRangeQuantized(ir::Activation activation, const Tensor *output,
+                                       int32_t *act_min, int32_t *act_max)
+{
+  int32_t qmin = 0;
+  int32_t qmax = 0;
+  if (output->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    qmin = std::numeric_limits<int8_t>::min();
+    qmax = std::numeric_limits<int8_t>::max();
+  }
+  else
+  {
+    qmin = std::numeric_limits<uint8_t>::min();
+    qmax = std::numeric_limits<uint8_t>::max();
+  }
   const auto scale = output->data_scale();
   const auto zero_point = output->data_offset();
   auto quantize = [scale, zero_point](float f) {
@@ -231,6 +297,7 @@ uint32_t sizeOfData(OperandType type, const std::vector<uint32_t> &dimensions)
     case OperandType::BOOL8:
     case OperandType::QUANT_UINT8_ASYMM:
     case OperandType::QUANT_INT8_SYMM:
+    case OperandType::QUANT_INT8_ASYMM:
       size = 1;
       break;
     default:
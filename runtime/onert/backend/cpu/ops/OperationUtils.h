@@ -95,6 +95,31 @@ inline nnfw::cker::Shape getTensorShape(const Tensor *tensor)
   return nnfw::cker::GetShape(raw_shape);
 }
 
+/**
+ * @brief Rebuild a shape cached by a kernel, only if it differs from the tensor's shape
+ * @return true if the shape was rebuilt
+ */
+inline bool updateTensorShape(const Tensor *tensor, nnfw::cker::Shape *shape)
+{
+  assert(tensor && shape);
+  assert(tensor->layout() == ir::Layout::NHWC);
+  const int rank = static_cast<int>(tensor->num_dimensions());
+  bool changed = (shape->DimensionsCount() != rank);
+  for (int i = 0; i < rank && !changed; ++i)
+  {
+    changed = (shape->Dims(i) != static_cast<int32_t>(tensor->dimension(i)));
+  }
+  if (!changed)
+    return false;
+
+  shape->Resize(rank);
+  for (int i = 0; i < rank; ++i)
+  {
+    shape->SetDim(i, tensor->dimension(i));
+  }
+  return true;
+}
+
 inline nnfw::cker::FusedActivationFunctionType
 convertActivationType(const ir::Activation activation)
 {
@@ -108,6 +133,10 @@ convertActivationType(const ir::Activation activation)
       return nnfw::cker::FusedActivationFunctionType::kRelu1;
     case ir::Activation::RELU6:
       return nnfw::cker::FusedActivationFunctionType::kRelu6;
+    case ir::Activation::TANH:
+      return nnfw::cker::FusedActivationFunctionType::kTanh;
+    case ir::Activation::SIGMOID:
+      return nnfw::cker::FusedActivationFunctionType::kSigmoid;
     default:
       throw std::runtime_error{"CPU backend: Cannot convert activation type"};
   }
@@ -138,6 +167,19 @@ void GetQuantizedConvolutionMultiplier(const Tensor *inputDescr, const Tensor *f
                                        const Tensor *biasDescr, const Tensor *outputDescr,
                                        double *multiplier);
 
+// Computes the requantization multiplier of each output channel of an int8 Conv, DepthwiseConv
+// or FullyConnected, whose filter may be quantized per channel or per tensor. The filter must be
+// symmetric, i.e. its zero points must be 0.
+void GetQuantizedConvolutionPerChannelMultipliers(const Tensor *input, const Tensor *filter,
+                                                  const Tensor *output, int num_channels,
+                                                  std::vector<int32_t> *multipliers,
+                                                  std::vector<int> *shifts);
+
+// Sets offsets, multipliers and shifts of quantized Add and Sub, which rescale both inputs to a
+// common scale and the sum to the scale of output
+void GetQuantizedAddParams(const Tensor *lhs, const Tensor *rhs, const Tensor *output,
+                           nnfw::cker::BinaryArithmeticOpParam *op_params);
+
 void QuantizeMultiplierGreaterThanOne(double double_multiplier, int32_t *quantized_multiplier,
                                       int *left_shift);
 
@@ -147,6 +189,11 @@ void CalculateActivationRangeFloat(ir::Activation activation, float *activation_
 void CalculateActivationRangeUint8(ir::Activation activation, const Tensor *output,
                                    int32_t *act_min, int32_t *act_max);
 
+// Same as CalculateActivationRangeUint8, but clamps to the range of the type of output, which is
+// uint8 or int8
+void CalculateActivationRangeQuantized(ir::Activation activation, const Tensor *output,
+                                       int32_t *act_min, int32_t *act_max);
+
 bool HaveSameShapes(const Tensor *input1, const Tensor *input2);
 
 int32_t CalculateInputRadius(int input_integer_bits, int input_left_shift);
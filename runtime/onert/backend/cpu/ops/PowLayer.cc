@@ -30,25 +30,18 @@ namespace ops
 
 void PowLayer::powFloat32()
 {
-  float output_activation_min, output_activation_max;
-  CalculateActivationRangeFloat(_activation, &output_activation_min, &output_activation_max);
-  nnfw::cker::BinaryArithmeticOpParam op_params;
-  op_params.type = nnfw::cker::BinaryArithmeticOpType::POW;
-  op_params.float_activation_max = output_activation_max;
-  op_params.float_activation_min = output_activation_min;
-
-  if (!HaveSameShapes(_lhs, _rhs))
+  if (_need_broadcast)
   {
     nnfw::cker::BroadcastBinaryArithmeticOp(
-        op_params, getTensorShape(_lhs), reinterpret_cast<const float *>(_lhs->buffer()),
-        getTensorShape(_rhs), reinterpret_cast<const float *>(_rhs->buffer()),
-        getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()));
+        _op_params, _lhs_shape, reinterpret_cast<const float *>(_lhs->buffer()), _rhs_shape,
+        reinterpret_cast<const float *>(_rhs->buffer()), _output_shape,
+        reinterpret_cast<float *>(_output->buffer()));
     return;
   }
 
-  nnfw::cker::powImpl(getTensorShape(_lhs), reinterpret_cast<const float *>(_lhs->buffer()),
-                      getTensorShape(_rhs), reinterpret_cast<const float *>(_rhs->buffer()),
-                      getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()));
+  nnfw::cker::powImpl(_lhs_shape, reinterpret_cast<const float *>(_lhs->buffer()), _rhs_shape,
+                      reinterpret_cast<const float *>(_rhs->buffer()), _output_shape,
+                      reinterpret_cast<float *>(_output->buffer()));
 }
 
 void PowLayer::configure(const Tensor *lhs, const Tensor *rhs, ir::Activation activation,
@@ -60,8 +53,38 @@ void PowLayer::configure(const Tensor *lhs, const Tensor *rhs, ir::Activation ac
   _output = output;
 }
 
+void PowLayer::prepare()
+{
+  _op_params.type = nnfw::cker::BinaryArithmeticOpType::POW;
+  if (_output->data_type() == OperandType::FLOAT32)
+  {
+    CalculateActivationRangeFloat(_activation, &_op_params.float_activation_min,
+                                  &_op_params.float_activation_max);
+  }
+
+  updateTensorShape(_lhs, &_lhs_shape);
+  updateTensorShape(_rhs, &_rhs_shape);
+  updateTensorShape(_output, &_output_shape);
+  _need_broadcast = nnfw::cker::ProcessBroadcastShapes(_lhs_shape, _rhs_shape, &_op_params);
+  _prepared = true;
+}
+
 void PowLayer::run()
 {
+  if (!_prepared)
+  {
+    prepare();
+  }
+  else if (_lhs->is_dynamic() || _rhs->is_dynamic() || _output->is_dynamic())
+  {
+    // Shape-dependent parameters are rebuilt only when a shape actually changed
+    bool changed = updateTensorShape(_lhs, &_lhs_shape);
+    changed |= updateTensorShape(_rhs, &_rhs_shape);
+    changed |= updateTensorShape(_output, &_output_shape);
+    if (changed)
+      _need_broadcast = nnfw::cker::ProcessBroadcastShapes(_lhs_shape, _rhs_shape, &_op_params);
+  }
+
   if (_output->data_type() == OperandType::FLOAT32)
     powFloat32();
   else
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RNNLayer.h"
+
+#include <cker/operation/RNN.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+RNNLayer::RNNLayer()
+    : _input(nullptr), _weights(nullptr), _recurrent_weights(nullptr), _bias(nullptr),
+      _hidden_state_in(nullptr), _output(nullptr), _hidden_state_out(nullptr),
+      _activation(ir::Activation::NONE), _is_weights_constant(false),
+      _rnn_kernel(new nnfw::cker::RNN()), _prepare(false)
+{
+  // DO NOTHING
+}
+
+RNNLayer::~RNNLayer() = default;
+
+void RNNLayer::rnnFloat32()
+{
+  nnfw::cker::RNNParams op_params;
+  op_params.activation = convertActivationType(_activation);
+
+  const int n_batch = _input->dimension(0);
+  const int n_input = _input->dimension(1);
+  const int n_unit = _weights->dimension(0);
+  const auto weights_data = reinterpret_cast<const float *>(_weights->buffer());
+  const auto recurrent_weights_data = reinterpret_cast<const float *>(_recurrent_weights->buffer());
+
+  nnfw::cker::RNN &kernel = *_rnn_kernel;
+  if (!_prepare && _is_weights_constant)
+  {
+    kernel.prepare(weights_data, recurrent_weights_data, n_input, n_unit);
+    _prepare = true;
+  }
+  kernel(op_params, n_batch, n_input, n_unit, reinterpret_cast<const float *>(_input->buffer()),
+         weights_data, recurrent_weights_data, reinterpret_cast<const float *>(_bias->buffer()),
+         reinterpret_cast<const float *>(_hidden_state_in->buffer()),
+         reinterpret_cast<float *>(_hidden_state_out->buffer()),
+         reinterpret_cast<float *>(_output->buffer()));
+}
+
+void RNNLayer::rnnHybrid()
+{
+  nnfw::cker::RNNParams op_params;
+  op_params.activation = convertActivationType(_activation);
+
+  const int n_batch = _input->dimension(0);
+  const int n_input = _input->dimension(1);
+  const int n_unit = _weights->dimension(0);
+
+  nnfw::cker::RNN &kernel = *_rnn_kernel;
+  kernel(op_params, n_batch, n_input, n_unit, reinterpret_cast<const float *>(_input->buffer()),
+         reinterpret_cast<const int8_t *>(_weights->buffer()), _weights->data_scale(),
+         reinterpret_cast<const int8_t *>(_recurrent_weights->buffer()),
+         _recurrent_weights->data_scale(), reinterpret_cast<const float *>(_bias->buffer()),
+         reinterpret_cast<const float *>(_hidden_state_in->buffer()),
+         reinterpret_cast<float *>(_hidden_state_out->buffer()),
+         reinterpret_cast<float *>(_output->buffer()));
+}
+
+void RNNLayer::configure(const Tensor *input, const Tensor *weights,
+                         const Tensor *recurrent_weights, const Tensor *bias,
+                         const Tensor *hidden_state_in, ir::Activation activation, Tensor *output,
+                         Tensor *hidden_state_out, bool is_weights_constant)
+{
+  _input = input;
+  _weights = weights;
+  _recurrent_weights = recurrent_weights;
+  _bias = bias;
+  _hidden_state_in = hidden_state_in;
+  _activation = activation;
+  _output = output;
+  _hidden_state_out = hidden_state_out;
+  _is_weights_constant = is_weights_constant;
+}
+
+void RNNLayer::run()
+{
+  if (_input->data_type() == OperandType::FLOAT32 &&
+      _weights->data_type() == OperandType::FLOAT32)
+  {
+    rnnFloat32();
+  }
+  else if (_input->data_type() == OperandType::FLOAT32 &&
+           _weights->data_type() == OperandType::QUANT_INT8_SYMM)
+  {
+    rnnHybrid();
+  }
+  else
+  {
+    throw std::runtime_error{"RNN: unsupported data type"};
+  }
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TransposeConvLayer.h"
+
+#include <cker/operation/TransposeConv.h>
+
+#include <limits>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+TransposeConvLayer::TransposeConvLayer()
+    : _input(nullptr), _kernel(nullptr), _output(nullptr), _paddingLeft(0), _paddingTop(0),
+      _strideWidth(0), _strideHeight(0), _is_kernel_constant(false),
+      _tconv_kernel(new nnfw::cker::TransposeConv()), _prepare(false)
+{
+  // DO NOTHING
+}
+
+TransposeConvLayer::~TransposeConvLayer() = default;
+
+void TransposeConvLayer::transposeConvFloat32()
+{
+  nnfw::cker::TransposeConvParams op_params;
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = 1;
+  op_params.dilation_height_factor = 1;
+
+  nnfw::cker::TransposeConv &kernel = *_tconv_kernel;
+  if (!_prepare && _is_kernel_constant)
+  {
+    kernel.prepare(getTensorShape(_kernel), reinterpret_cast<const float *>(_kernel->buffer()));
+    _prepare = true;
+  }
+  kernel(op_params, getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
+         getTensorShape(_kernel), reinterpret_cast<const float *>(_kernel->buffer()),
+         getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()));
+}
+
+void TransposeConvLayer::transposeConvQuant8()
+{
+  const double real_multiplier =
+      static_cast<double>(_input->data_scale()) * _kernel->data_scale() / _output->data_scale();
+  int32_t output_multiplier = 0;
+  int32_t output_shift = 0;
+  QuantizeMultiplier(real_multiplier, &output_multiplier, &output_shift);
+
+  nnfw::cker::TransposeConvParams op_params;
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = 1;
+  op_params.dilation_height_factor = 1;
+  op_params.input_offset = -_input->data_offset();
+  op_params.weights_offset = -_kernel->data_offset();
+  op_params.output_offset = _output->data_offset();
+  op_params.output_multiplier = output_multiplier;
+  op_params.output_shift = output_shift;
+  op_params.quantized_activation_min = std::numeric_limits<uint8_t>::min();
+  op_params.quantized_activation_max = std::numeric_limits<uint8_t>::max();
+
+  nnfw::cker::TransposeConv &kernel = *_tconv_kernel;
+  if (!_prepare && _is_kernel_constant)
+  {
+    kernel.prepareQuant(getTensorShape(_kernel),
+                        reinterpret_cast<const uint8_t *>(_kernel->buffer()),
+                        op_params.weights_offset);
+    _prepare = true;
+  }
+  kernel(op_params, getTensorShape(_input), reinterpret_cast<const uint8_t *>(_input->buffer()),
+         getTensorShape(_kernel), reinterpret_cast<const uint8_t *>(_kernel->buffer()),
+         getTensorShape(_output), reinterpret_cast<uint8_t *>(_output->buffer()));
+}
+
+void TransposeConvLayer::configure(const Tensor *input, const Tensor *kernel,
+                                   const uint32_t paddingLeft, const uint32_t paddingTop,
+                                   const uint32_t strideWidth, const uint32_t strideHeight,
+                                   Tensor *output, bool is_kernel_constant)
+{
+  _input = input;
+  _kernel = kernel;
+  _paddingLeft = paddingLeft;
+  _paddingTop = paddingTop;
+  _strideWidth = strideWidth;
+  _strideHeight = strideHeight;
+  _output = output;
+  _is_kernel_constant = is_kernel_constant;
+}
+
+void TransposeConvLayer::run()
+{
+  if (_input->data_type() == OperandType::FLOAT32)
+  {
+    transposeConvFloat32();
+  }
+  else if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
+  {
+    transposeConvQuant8();
+  }
+  else
+  {
+    throw std::runtime_error{"TransposeConv: unsupported data type"};
+  }
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
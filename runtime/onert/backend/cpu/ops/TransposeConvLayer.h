@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_CPU_OPS_TRANSPOSECONVLAYER_H__
+#define __ONERT_BACKEND_CPU_OPS_TRANSPOSECONVLAYER_H__
+
+#include "../Tensor.h"
+#include "OperationUtils.h"
+
+#include <exec/IFunction.h>
+#include <memory>
+
+namespace nnfw
+{
+namespace cker
+{
+class TransposeConv;
+}
+} // namespace nnfw
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+class TransposeConvLayer : public ::onert::exec::IFunction
+{
+public:
+  TransposeConvLayer();
+  ~TransposeConvLayer();
+
+public:
+  void transposeConvFloat32();
+
+  void transposeConvQuant8();
+
+  void configure(const Tensor *input, const Tensor *kernel, const uint32_t paddingLeft,
+                 const uint32_t paddingTop, const uint32_t strideWidth,
+                 const uint32_t strideHeight, Tensor *output, bool is_kernel_constant = false);
+
+  void run();
+  void runSync()
+  {
+    // this abstract method is used just for profiling and called for
+    // backend::acl_common::AclFunction
+    run();
+  }
+
+private:
+  const Tensor *_input;
+  const Tensor *_kernel;
+  Tensor *_output;
+
+  uint32_t _paddingLeft;
+  uint32_t _paddingTop;
+
+  uint32_t _strideWidth;
+  uint32_t _strideHeight;
+
+  bool _is_kernel_constant;
+  std::unique_ptr<nnfw::cker::TransposeConv> _tconv_kernel;
+
+  bool _prepare;
+};
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_OPS_TRANSPOSECONVLAYER_H__
@@ -41,6 +41,9 @@ struct IConfig
 
   virtual bool supportDynamicTensor() = 0;
   virtual bool supportFP16() = 0;
+  // Kernels, with shape inference and allocation of their dynamic outputs, can run on multiple
+  // threads at the same time
+  virtual bool supportConcurrentKernels() { return false; }
 
   virtual void sync() const {}
 
@@ -194,6 +194,15 @@ protected:
 protected:
   virtual std::shared_ptr<ITensorBuilder> tensor_builder() const = 0;
 
+public:
+  /**
+   * @brief Register the initializer of a constant operand which no operation visitor handled
+   */
+  virtual void registerDefaultInitializer(const ir::OperandIndex &index, const ir::Operand &obj)
+  {
+    registerPermuteInitializer(index, obj);
+  }
+
 public:
   void registerCopyInitializer(const ir::OperandIndex &index, const ir::Operand &obj)
   {
@@ -222,6 +231,7 @@ public:
         _init_map[index] = copyInit<uint8_t>;
         break;
       case DataType::QUANT_INT8_SYMM:
+      case DataType::QUANT_INT8_ASYMM:
         _init_map[index] = copyInit<int8_t>;
         break;
       case DataType::FLOAT16:
@@ -262,6 +272,7 @@ public:
         _init_map[index] = std::bind(permuteInit<uint8_t>, _1, _2, _current_op_seq_layout);
         break;
       case DataType::QUANT_INT8_SYMM:
+      case DataType::QUANT_INT8_ASYMM:
         _init_map[index] = std::bind(permuteInit<int8_t>, _1, _2, _current_op_seq_layout);
         break;
       case DataType::FLOAT16:
@@ -71,6 +71,15 @@ public:
   {
     throw std::runtime_error("This backend does not support dynamic tensor");
   }
+
+  /**
+   * @brief Use user-given memory as the buffer of this tensor instead of its own memory
+   *
+   * @param buffer User memory to be used, or nullptr to get back to the tensor's own memory
+   * @return @c true if the tensor supports user memory, otherwise @c false
+   * @note  Caller must ensure that buffer is large enough, and has no padding
+   */
+  virtual bool setUserBuffer(uint8_t * /* buffer */) { return false; }
 };
 
 /**
@@ -22,6 +22,7 @@
 #ifndef __ONERT_BACKEND_CPU_COMMON_ALLOCATOR_H__
 #define __ONERT_BACKEND_CPU_COMMON_ALLOCATOR_H__
 
+#include <functional>
 #include <memory>
 
 namespace onert
@@ -38,6 +39,13 @@ class Allocator
 {
 public:
   Allocator(uint32_t capacity);
+  /**
+   * @brief Construct a new Allocator object with a buffer allocated by others
+   *
+   * @param base     Base pointer of the buffer
+   * @param releaser Function which gets the buffer back when it is released
+   */
+  Allocator(uint8_t *base, const std::function<void(uint8_t *)> &releaser);
   /**
    * @brief Get memory base pointer
    * @return base pointer
@@ -46,7 +54,7 @@ public:
   void release() { _base.reset(); }
 
 private:
-  std::unique_ptr<uint8_t[]> _base;
+  std::unique_ptr<uint8_t[], std::function<void(uint8_t *)>> _base;
 };
 
 } // namespace cpu_common
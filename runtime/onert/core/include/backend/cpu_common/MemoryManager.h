@@ -22,6 +22,8 @@
 #include "IMemoryPlanner.h"
 #include "ir/OperandIndexMap.h"
 
+#include <mutex>
+
 namespace onert
 {
 namespace backend
@@ -53,18 +55,51 @@ private:
   std::shared_ptr<Allocator> _mem_alloc;
 };
 
+/**
+ * @brief Memory manager which allocates a buffer for each tensor on demand
+ *
+ * Released buffers go back to a pool and are handed out again for later requests, so tensors
+ * whose shape changes on every run do not hit the heap every time.
+ */
 class DynamicMemoryManager
 {
 public:
-  DynamicMemoryManager() = default;
+  /**
+   * @brief Counters of buffer requests, to check how many of them the pool serves
+   */
+  struct Stats
+  {
+    // Number of allocate() calls
+    uint64_t num_allocations = 0;
+    // Number of allocate() calls which needed a new heap block
+    uint64_t num_heap_allocations = 0;
+    // Total bytes of free blocks kept by the pool
+    uint64_t pooled_bytes = 0;
+  };
+
+public:
+  /**
+   * @brief Construct a new DynamicMemoryManager object
+   *
+   * @param max_pooled_bytes Maximum total bytes of free blocks to keep for later requests
+   */
+  DynamicMemoryManager(uint64_t max_pooled_bytes = 64 * 1024 * 1024);
   virtual ~DynamicMemoryManager() = default;
 
   std::shared_ptr<Allocator> allocate(const ir::OperandIndex &ind, uint32_t capacity);
   void deallocate(const ir::OperandIndex &ind);
   void deallocate(void);
 
+  Stats stats(void) const;
+
+private:
+  class BufferPool;
+
 private:
+  // Kernels of different jobs may allocate their outputs concurrently
+  std::mutex _mutex;
   ir::OperandIndexMap<std::shared_ptr<Allocator>> _mem_alloc_map;
+  std::shared_ptr<BufferPool> _pool;
 };
 
 } // namespace cpu_common
@@ -51,6 +51,7 @@ struct CompilerOptions
 
   // OPTIONS ONLY FOR DEBUGGING/PROFILING
   std::string trace_filepath; //< File path to save trace records
+  uint32_t trace_ring_size;   //< Events kept per thread by binary tracing, 0 to keep all events
   int graph_dump_level;       //< Graph dump level, values between 0 and 2 are valid
   int op_seq_max_node;        //< Number of nodes that can be
   std::string executor;       //< Executor name to use
@@ -59,6 +60,9 @@ struct CompilerOptions
   bool he_profiling_mode; //< Whether HEScheduler profiling mode ON/OFF
   bool disable_compile;   //< Run with Interpreter if true, try compilation otherwise
   bool fp16_enable;       //< Whether fp16 mode ON/OFF
+  bool epilogue_fusion;   //< Whether to fuse activation and bias epilogues into producers
+  uint32_t num_threads;   //< Number of threads kernels of the session may use, 0 for no limit
+  uint32_t num_contexts;  //< Number of execution contexts which can run concurrently
 };
 
 CompilerOptions fetchCompilerOptionsFromGlobalConfig(const ir::Subgraphs &subgs);
@@ -86,6 +90,14 @@ public:
    *                    Set nullptr if compile is not run yet
    */
   void release(std::shared_ptr<exec::ExecutorMap> &executors) { executors = _executors; }
+  /**
+   * @brief       Pass executors of all execution contexts
+   * @param[out]  contexts  Executors for each context. The first one is what release() passes\n
+   *                        Contexts share constants of the model, but each of them has its own
+   *                        kernels and intermediate tensors. So different contexts can be executed
+   *                        on different threads at the same time.
+   */
+  void release(std::vector<std::shared_ptr<exec::ExecutorMap>> &contexts) { contexts = _contexts; }
 
   void state(State state) { _state = state; }
   State state(void) const { return _state; }
@@ -116,6 +128,7 @@ private:
   // have to add allocate non-constant tensor memory of executors in execution time when each
   // subgraph is called.
   std::shared_ptr<exec::ExecutorMap> _executors;
+  std::vector<std::shared_ptr<exec::ExecutorMap>> _contexts;
   State _state;
   CompilerOptions _options;
 };
@@ -25,7 +25,11 @@
 #include "exec/IExecutor.h"
 #include "IODescription.h"
 
-#include <thread>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
 
 namespace onert
 {
@@ -45,6 +49,11 @@ public:
    * @param[in] executor  Model executor
    */
   Execution(const std::shared_ptr<ExecutorMap> &executors);
+  /**
+   * @brief Destroy the Execution object
+   * @note  It waits for asynchronous execution in progress to finish
+   */
+  ~Execution();
 
 public:
   /**
@@ -102,6 +111,28 @@ public:
    */
   void setOutput(const ir::IOIndex &index, const ir::TypeInfo &type, const ir::Shape &shape,
                  void *buffer, size_t length, ir::Layout layout = ir::Layout::NHWC);
+  /**
+   * @brief     Set input data's information, allowing the buffer to be used directly as memory of
+   *            the input tensor instead of being copied
+   * @param[in] index   Input index
+   * @param[in] buffer  Input data's buffer pointer. It must be kept alive until execution finishes
+   * @param[in] length  Input data's length
+   * @param[in] layout  Input data's data format
+   * @note      It falls back to copy if the input tensor cannot use the buffer as it is
+   */
+  void bindInput(const ir::IOIndex &index, const void *buffer, size_t length,
+                 ir::Layout layout = ir::Layout::NHWC);
+  /**
+   * @brief     Set output data's information, allowing the buffer to be used directly as memory
+   *            of the output tensor instead of being copied
+   * @param[in] index   Output index
+   * @param[in] buffer  Output data's buffer pointer. It must be kept alive until execution finishes
+   * @param[in] length  Output data's length
+   * @param[in] layout  Output data's data format
+   * @note      It falls back to copy if the output tensor cannot use the buffer as it is
+   */
+  void bindOutput(const ir::IOIndex &index, void *buffer, size_t length,
+                  ir::Layout layout = ir::Layout::NHWC);
   /**
    * @brief     Set input data's data format
    * @param[in] index   Input index
@@ -121,15 +152,19 @@ public:
   void execute();
 
   /**
-   * @brief Start asynchronous execution
-   * @note  It returns after execution thread is started
-   *        It should be called after setting input and output buffer
+   * @brief     Start asynchronous execution
+   * @param[in] callback  Function to be called on the worker thread when execution is finished.
+   *                      Its argument is nullptr on success, otherwise the exception thrown
+   * @note      It returns after execution is queued to the runtime thread pool
+   *            It should be called after setting input and output buffer
+   *            waitFinish() must not be called in @c callback
    */
-  void startExecute(void);
+  void startExecute(const std::function<void(std::exception_ptr)> &callback = nullptr);
 
   /**
    * @brief Return when execution is finished
-   * @note  It waits until execution is finished
+   * @note  It waits until execution and its callback are finished
+   *        It rethrows the exception thrown during execution if any
    */
   void waitFinish(void);
 
@@ -151,8 +186,11 @@ private:
 private:
   const std::shared_ptr<ExecutorMap> _executors;
   IODescription _io_desc;
-  std::unique_ptr<std::thread> _exec_thread;
-  bool finished{false};
+  std::mutex _async_mutex;
+  std::condition_variable _async_cv;
+  bool _async_running{false};
+  std::exception_ptr _async_error;
+  std::atomic<bool> finished{false};
 };
 
 } // namespace exec
@@ -24,9 +24,18 @@
 #include "IExecutor.h"
 #include "misc/EventCollector.h"
 #include "misc/EventRecorder.h"
+#include "util/TraceRingBuffer.h"
+
+#include <mutex>
+#include <unordered_map>
 
 namespace onert
 {
+namespace ir
+{
+class LoweredGraph;
+} // namespace ir
+
 namespace exec
 {
 class IExecutionObserver
@@ -41,6 +50,10 @@ public:
   /// @brief Invoked just after model (not individual operation) execution ends
   virtual void handleEnd(IExecutor *) { return; }
 
+  /// @brief Whether jobs may begin and end on several threads at once while this observes them.
+  ///        Otherwise, an executor running jobs in parallel runs them one at a time.
+  virtual bool supportConcurrentJobs() const { return false; }
+
   virtual ~IExecutionObserver() = default;
 };
 
@@ -72,9 +85,6 @@ public:
   void handleEnd(IExecutor *, const ir::OpSequence *, const backend::Backend *) override;
   void handleEnd(IExecutor *) override;
 
-private:
-  static std::string opSequenceTag(const ir::OpSequence *op_seq, const ir::Operations &operations);
-
 private:
   std::ofstream _ofs;
   EventRecorder _recorder;
@@ -82,6 +92,57 @@ private:
   const ir::Graph &_graph;
 };
 
+/**
+ * @brief Observer which records fixed-size binary events into bounded per-thread ring buffers,
+ *        and writes them as Chrome trace events when it is destroyed or asked to flush
+ *
+ * Unlike ChromeTracingObserver, names of events are made once at construction, and recording an
+ * event takes neither a lock nor memory allocation. So it can be used for a long-running process,
+ * which keeps only the last events of each thread. Each executor should have its own file, since
+ * a flush overwrites the file.
+ */
+class RingTracingObserver : public IExecutionObserver
+{
+public:
+  RingTracingObserver(const std::string &filepath, const ir::LoweredGraph &lowered_graph,
+                      uint32_t capacity);
+  ~RingTracingObserver();
+  void handleBegin(IExecutor *) override;
+  void handleBegin(IExecutor *, const ir::OpSequence *, const backend::Backend *) override;
+  void handleEnd(IExecutor *, const ir::OpSequence *, const backend::Backend *) override;
+  void handleEnd(IExecutor *) override;
+  bool supportConcurrentJobs() const override { return true; }
+
+public:
+  /**
+   * @brief Write the events kept so far to the file
+   */
+  void flush();
+  /**
+   * @brief Request all RingTracingObserver objects to flush when their executions end
+   *
+   * @note  This only increases an atomic counter, so it may be called from a signal handler
+   */
+  static void requestFlush();
+
+private:
+  void record(const ir::OpSequence *op_seq, util::TraceEvent::Phase phase);
+
+private:
+  struct Tag
+  {
+    std::string tid;
+    std::string name;
+  };
+
+  std::string _filepath;
+  util::TraceRingBuffer _buffer;
+  std::vector<Tag> _tags; //< Tag of the whole graph followed by tags of op sequences
+  std::unordered_map<const ir::OpSequence *, uint32_t> _op_seq_ids;
+  std::mutex _flush_mutex;
+  uint64_t _flush_request; //< Last request of requestFlush() this has handled
+};
+
 } // namespace exec
 } // namespace onert
 
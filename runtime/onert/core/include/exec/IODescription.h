@@ -34,10 +34,13 @@ struct InputDesc
   const void *buffer;
   const size_t size;
   const ir::Layout layout;
+  // Whether buffer may be used directly as the input tensor's memory instead of being copied
+  const bool bind;
 
   InputDesc(void) = delete;
-  InputDesc(const ir::OperandInfo &info, const void *buffer, const size_t size, ir::Layout layout)
-      : info(info), buffer(buffer), size(size), layout(layout)
+  InputDesc(const ir::OperandInfo &info, const void *buffer, const size_t size, ir::Layout layout,
+            bool bind = false)
+      : info(info), buffer(buffer), size(size), layout(layout), bind(bind)
   {
   }
 };
@@ -50,10 +53,13 @@ struct OutputDesc
   void *buffer;
   const size_t size;
   const ir::Layout layout;
+  // Whether buffer may be used directly as the output tensor's memory instead of being copied
+  const bool bind;
 
   OutputDesc(void) = delete;
-  OutputDesc(const ir::OperandInfo &info, void *buffer, const size_t size, ir::Layout layout)
-      : info(info), buffer(buffer), size(size), layout(layout)
+  OutputDesc(const ir::OperandInfo &info, void *buffer, const size_t size, ir::Layout layout,
+             bool bind = false)
+      : info(info), buffer(buffer), size(size), layout(layout), bind(bind)
   {
   }
 };
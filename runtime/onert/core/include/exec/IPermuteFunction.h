@@ -80,6 +80,7 @@ public:
             permute<uint8_t>(src_tensor, dst_tensor, rank);
             break;
           case ir::DataType::QUANT_INT8_SYMM:
+          case ir::DataType::QUANT_INT8_ASYMM:
             permute<int8_t>(src_tensor, dst_tensor, rank);
             break;
           default:
@@ -269,6 +270,7 @@ private:
       case ir::DataType::UINT8:
         return typeid(uint8_t);
       case ir::DataType::QUANT_INT8_SYMM:
+      case ir::DataType::QUANT_INT8_ASYMM:
         return typeid(int8_t);
       default:
         throw std::runtime_error("IPermuteFunction: Not supported data type");
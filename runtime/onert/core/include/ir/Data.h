@@ -18,6 +18,8 @@
 #define __ONERT_IR_DATA_H__
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 
 namespace onert
 {
@@ -69,6 +71,40 @@ private:
   const size_t _size;
 };
 
+/**
+ * @brief Data mapped from a model file, which is only paged in when it is accessed
+ *
+ * Mapped pages are read-only, so any consumer must not write to @c base()
+ */
+class MMapedData final : public Data
+{
+public:
+  /**
+   * @brief Construct a MMapedData object
+   *
+   * @param fd          File descriptor of the model file
+   * @param mmap_offset Offset to start mapping from. Must be a multiple of the page size
+   * @param mmap_size   Size to map
+   * @param data_offset Offset of the data in the file. Must not be less than @c mmap_offset
+   * @param data_size   Size of the data
+   */
+  MMapedData(int fd, std::ptrdiff_t mmap_offset, size_t mmap_size, std::ptrdiff_t data_offset,
+             size_t data_size);
+
+public:
+  ~MMapedData();
+
+public:
+  size_t size(void) const override { return _size; }
+  const uint8_t *base(void) const override { return _mmap_base + _offset; }
+
+private:
+  uint8_t *_mmap_base;
+  const size_t _mmap_size;
+  const std::ptrdiff_t _offset;
+  const size_t _size;
+};
+
 } // namespace ir
 } // namespace onert
 
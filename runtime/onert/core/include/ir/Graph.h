@@ -24,6 +24,7 @@
 #include "ir/Operations.h"
 #include "ir/OpSequence.h"
 #include "ir/OpSequences.h"
+#include "ir/PreparedDataCache.h"
 #include "ir/Subgraphs.h"
 
 namespace onert
@@ -88,6 +89,16 @@ public:
 private:
   std::shared_ptr<backend::custom::IKernelBuilder> _kernel_builder;
 
+  // Data prepared from constants by kernels, which is shared by copies of this graph
+public:
+  const std::shared_ptr<PreparedDataCache> &preparedDataCache() const
+  {
+    return _prepared_data_cache;
+  }
+
+private:
+  std::shared_ptr<PreparedDataCache> _prepared_data_cache{std::make_shared<PreparedDataCache>()};
+
   // Accessors
 public:
   const OperandIndexSequence &getInputs() const { return _inputs; }
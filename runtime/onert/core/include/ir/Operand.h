@@ -65,6 +65,7 @@ public:
     _const = true;
   }
   const Data *data(void) const { return _data.get(); }
+  std::shared_ptr<const Data> shareData(void) const { return _data; }
 
   void releaseData(void) { _data.reset(); }
 
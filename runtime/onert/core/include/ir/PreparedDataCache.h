@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_IR_PREPARED_DATA_CACHE_H__
+#define __ONERT_IR_PREPARED_DATA_CACHE_H__
+
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "ir/Data.h"
+#include "ir/Index.h"
+#include "ir/OperandIndexMap.h"
+
+namespace onert
+{
+namespace ir
+{
+
+/**
+ * @brief Class to keep data which kernels prepare from constant operands, e.g. transposed weights
+ *
+ * Copies of a graph share its cache. So the lowered graphs of the execution contexts of a model
+ * prepare such data only once for all of them.
+ */
+class PreparedDataCache
+{
+public:
+  using Prepare = std::function<std::shared_ptr<const void>()>;
+
+public:
+  /**
+   * @brief Get the data prepared from a constant operand, preparing it if not prepared yet
+   *
+   * @param index   Index of the operand
+   * @param data    Data of the operand to prepare from
+   * @param prepare Function to prepare data, which may return nullptr if there is nothing to
+   *                prepare
+   * @return Prepared data, or nullptr if there is nothing to prepare
+   *
+   * @note  Data prepared from other data of the same operand, e.g. by a graph whose data has been
+   *        replaced, is not returned
+   */
+  std::shared_ptr<const void> get(const OperandIndex &index,
+                                  const std::shared_ptr<const Data> &data, const Prepare &prepare);
+
+private:
+  struct Entry
+  {
+    // Data is compared by the object, since its address may be reused by other data
+    std::weak_ptr<const Data> data;
+    std::shared_ptr<const void> prepared;
+  };
+
+  // Kernels of different contexts may prepare at the same time, on their first run
+  std::mutex _mutex;
+  OperandIndexMap<Entry> _entries;
+};
+
+} // namespace ir
+} // namespace onert
+
+#endif // __ONERT_IR_PREPARED_DATA_CACHE_H__
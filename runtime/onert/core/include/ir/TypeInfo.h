@@ -18,6 +18,7 @@
 #define __ONERT_IR_TYPEINFO_H__
 
 #include <cstdint>
+#include <vector>
 
 #include "ir/DataType.h"
 
@@ -36,10 +37,44 @@ public:
   {
   }
 
+  /**
+   * @brief Construct TypeInfo of a tensor quantized per channel
+   * @param[in] type         Data type
+   * @param[in] scales       Scale of each channel
+   * @param[in] offsets      Zero point of each channel, of the same size as scales
+   * @param[in] channel_dim  Dimension along which the channels are quantized
+   */
+  TypeInfo(DataType type, const std::vector<float> &scales, const std::vector<int32_t> &offsets,
+           int32_t channel_dim)
+      : _type(type), _scale(scales.empty() ? 0 : scales[0]),
+        _offset(offsets.empty() ? 0 : offsets[0]), _scales(scales), _offsets(offsets),
+        _channel_dim(channel_dim)
+  {
+  }
+
 public:
   DataType type() const { return _type; }
+  /**
+   * @brief Scale of the tensor, or that of the first channel if quantized per channel
+   */
   float scale() const { return _scale; }
+  /**
+   * @brief Zero point of the tensor, or that of the first channel if quantized per channel
+   */
   int32_t offset() const { return _offset; }
+  /**
+   * @brief Whether it has a scale and a zero point for each channel
+   */
+  bool isPerChannel() const { return _scales.size() > 1; }
+  /**
+   * @brief Scales of each channel, empty unless quantized per channel
+   */
+  const std::vector<float> &scales() const { return _scales; }
+  /**
+   * @brief Zero points of each channel, empty unless quantized per channel
+   */
+  const std::vector<int32_t> &offsets() const { return _offsets; }
+  int32_t channelDim() const { return _channel_dim; }
 
 public:
   void type(const DataType type) { _type = type; }
@@ -48,6 +83,9 @@ private:
   DataType _type;
   float _scale;
   int32_t _offset;
+  std::vector<float> _scales;
+  std::vector<int32_t> _offsets;
+  int32_t _channel_dim{0};
 };
 
 bool operator==(const TypeInfo &lhs, const TypeInfo &rhs);
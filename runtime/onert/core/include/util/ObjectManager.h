@@ -65,6 +65,18 @@ public:
     return index;
   }
 
+  /**
+   * @brief Replace the object that is associated with the given index, keeping the index
+   *
+   * @param[in] index Index of the object to be replaced, which must exist
+   * @param[in] object Object to replace with
+   * @return N/A
+   */
+  void set(const Index &index, std::unique_ptr<Object> &&object)
+  {
+    _objects.at(index) = std::move(object);
+  }
+
   /**
    * @brief Remove the object that is associated with the given index
    *
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_UTIL_THREAD_BUDGET_H__
+#define __ONERT_UTIL_THREAD_BUDGET_H__
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+namespace onert
+{
+namespace util
+{
+
+/**
+ * @brief Singleton class for the number of threads the runtime may use for computation
+ *
+ * Executors register the threads on which they run kernels at the same time, and kernels split the
+ * budget among them for their intra-op parallelism. So executors and kernels (e.g. Eigen and ruy
+ * in cker) do not oversubscribe cores together.
+ *
+ * Each session may limit its kernels further with its own number of threads. The limit is kept for
+ * each thread running kernels of the session, so sessions with different limits can run together.
+ */
+class ThreadBudget
+{
+public:
+  /**
+   * @brief Get the singleton object of this class
+   *
+   * @return ThreadBudget& Singleton object
+   */
+  static ThreadBudget &get();
+
+public:
+  /**
+   * @brief Get the total number of threads, which is the number of hardware threads
+   */
+  uint32_t maxThreads() const { return _max_threads; }
+  /**
+   * @brief Get the number of threads which a kernel on the calling thread may use for itself
+   */
+  uint32_t threadsPerKernel() const;
+
+public:
+  /**
+   * @brief Limit the number of threads for kernels running on the calling thread
+   *
+   * @param num_threads Number of threads. 0 means no limit other than the total number of threads
+   */
+  void setThreadLimit(uint32_t num_threads);
+  /**
+   * @brief Get the limit set by setThreadLimit() on the calling thread
+   */
+  uint32_t threadLimit() const;
+
+public:
+  /**
+   * @brief Register threads which run kernels at the same time
+   */
+  void acquire(uint32_t num_threads) { _num_kernel_threads += num_threads; }
+  /**
+   * @brief Unregister threads registered by acquire()
+   */
+  void release(uint32_t num_threads) { _num_kernel_threads -= num_threads; }
+
+private:
+  ThreadBudget();
+
+private:
+  const uint32_t _max_threads;
+  std::atomic<uint32_t> _num_kernel_threads;
+};
+
+/**
+ * @brief Helper class for limiting threads of kernels on the calling thread which is handled
+ *        automatically with ctor/dtor
+ */
+class ThreadLimitScope
+{
+public:
+  /**
+   * @param num_threads Number of threads for each kernel. 0 keeps the current limit
+   */
+  ThreadLimitScope(uint32_t num_threads) : _prev_limit{ThreadBudget::get().threadLimit()}
+  {
+    if (num_threads > 0)
+      ThreadBudget::get().setThreadLimit(num_threads);
+  }
+  ~ThreadLimitScope() { ThreadBudget::get().setThreadLimit(_prev_limit); }
+
+private:
+  uint32_t _prev_limit;
+};
+
+/**
+ * @brief Helper class for registering threads to ThreadBudget which is handled automatically with
+ *        ctor/dtor
+ */
+class ThreadBudgetScope
+{
+public:
+  /**
+   * @param num_threads Number of threads which run kernels at the same time
+   * @param max_threads Number of threads which kernels of the session may use in total. 0 means no
+   *                    limit of the session
+   */
+  ThreadBudgetScope(uint32_t num_threads, uint32_t max_threads = 0)
+      : _num_threads{num_threads}, _limit_scope{threadLimitOf(max_threads, num_threads)}
+  {
+    ThreadBudget::get().acquire(_num_threads);
+  }
+  ~ThreadBudgetScope() { ThreadBudget::get().release(_num_threads); }
+
+public:
+  /**
+   * @brief Get the number of threads for each kernel when kernels on @c num_threads threads share
+   *        @c max_threads threads
+   *
+   * @return Number of threads for each kernel, or 0 if @c max_threads is 0
+   */
+  static uint32_t threadLimitOf(uint32_t max_threads, uint32_t num_threads)
+  {
+    if (max_threads == 0)
+      return 0;
+    return std::max(1u, max_threads / std::max(1u, num_threads));
+  }
+
+private:
+  uint32_t _num_threads;
+  ThreadLimitScope _limit_scope;
+};
+
+} // namespace util
+} // namespace onert
+
+#endif // __ONERT_UTIL_THREAD_BUDGET_H__
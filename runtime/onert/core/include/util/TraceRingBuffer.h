@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_UTIL_TRACE_RING_BUFFER_H__
+#define __ONERT_UTIL_TRACE_RING_BUFFER_H__
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace onert
+{
+namespace util
+{
+
+/**
+ * @brief Fixed-size binary trace event
+ */
+struct TraceEvent
+{
+  enum class Phase : uint32_t
+  {
+    BEGIN,
+    END
+  };
+
+  uint64_t ts;  //< Timestamp in nanoseconds from an arbitrary point in time
+  uint32_t id;  //< Identifier of what happens, whose meaning is decided by the user
+  Phase phase;
+};
+
+/**
+ * @brief Bounded buffer of trace events, which has a ring for each recording thread
+ *
+ * Recording writes an event to the ring of the calling thread without any lock or memory
+ * allocation, and overwrites the oldest event when the ring is full. A lock is taken only when a
+ * thread records for the first time.
+ */
+class TraceRingBuffer
+{
+public:
+  /**
+   * @brief Construct a new TraceRingBuffer object
+   *
+   * @param capacity Number of events kept for each thread, which is rounded up to a power of 2
+   *                 and clamped to max_capacity
+   */
+  explicit TraceRingBuffer(uint32_t capacity);
+  ~TraceRingBuffer();
+
+public:
+  static constexpr uint32_t max_capacity = 1u << 24;
+
+public:
+  uint32_t capacity() const { return _capacity; }
+
+  void record(uint32_t id, TraceEvent::Phase phase)
+  {
+    const auto now = std::chrono::steady_clock::now().time_since_epoch();
+    ring().push(
+        TraceEvent{static_cast<uint64_t>(
+                       std::chrono::duration_cast<std::chrono::nanoseconds>(now).count()),
+                   id, phase});
+  }
+
+  /**
+   * @brief Get the events kept in each thread, from the oldest to the newest
+   *
+   * @note  Events which are recorded during this call may be missing or broken
+   */
+  std::vector<std::vector<TraceEvent>> collect() const;
+
+private:
+  class Ring
+  {
+  public:
+    explicit Ring(uint32_t capacity) : _events{new TraceEvent[capacity]}, _mask{capacity - 1} {}
+
+  public:
+    void push(const TraceEvent &event)
+    {
+      // Only the owner thread writes, so a relaxed load of head is enough
+      const auto head = _head.load(std::memory_order_relaxed);
+      _events[head & _mask] = event;
+      _head.store(head + 1, std::memory_order_release);
+    }
+    std::vector<TraceEvent> events() const;
+
+  private:
+    std::unique_ptr<TraceEvent[]> _events;
+    const uint64_t _mask;
+    std::atomic<uint64_t> _head{0};
+  };
+
+  Ring &ring();
+  Ring &registerThread();
+
+private:
+  // Unique among all buffers in the process, so that a per-thread cache of a destroyed buffer
+  // never matches a new one
+  const uint64_t _uid;
+  const uint32_t _capacity;
+  mutable std::mutex _mu;
+  std::unordered_map<std::thread::id, std::unique_ptr<Ring>> _rings;
+};
+
+/**
+ * @brief Get events of a thread whose BEGIN and END are both kept
+ *
+ * When a ring wraps, the BEGIN of its oldest END events may have been overwritten, and the newest
+ * BEGIN events may not have ended yet. Such events are dropped, so that BEGIN and END events are
+ * nested properly in the result.
+ *
+ * @param events Events of a thread from the oldest to the newest
+ */
+std::vector<TraceEvent> pairedEvents(const std::vector<TraceEvent> &events);
+
+} // namespace util
+} // namespace onert
+
+#endif // __ONERT_UTIL_TRACE_RING_BUFFER_H__
@@ -44,7 +44,7 @@ void DynamicTensorManager::allocate(const ir::OperandIndex &ind, const ir::Shape
     auto capacity = tensor->total_size();
     auto alloc = _dynamic_mem_mgr->allocate(ind, capacity);
 
-    tensor->setBuffer(alloc);
+    tensor->overwriteBuffer(alloc);
   };
 
   if (tensor->buffer() == nullptr)
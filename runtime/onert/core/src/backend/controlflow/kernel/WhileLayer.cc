@@ -20,6 +20,8 @@
 #include "exec/ExecutorBase.h"
 #include "PermuteLayer.h"
 
+#include <algorithm>
+
 namespace onert
 {
 namespace backend
@@ -29,6 +31,53 @@ namespace controlflow
 namespace kernel
 {
 
+namespace
+{
+
+using TensorVector = std::vector<std::shared_ptr<backend::ITensor>>;
+
+/**
+ * @brief Loop-carried variable whose tensors use buffers of WhileLayer instead of their own
+ *        memory, so that it does not need to be copied between cond and body subgraphs
+ */
+struct LoopVar
+{
+  backend::ITensor *cond_input;
+  backend::ITensor *body_input;
+  backend::ITensor *body_output;
+  uint8_t *cur;  // Buffer of cond_input and body_input
+  uint8_t *next; // Buffer of body_output, same as cur if body_output is body_input
+};
+
+bool isSharable(const backend::ITensor *tensor, const backend::ITensor &ref)
+{
+  return tensor != nullptr && !tensor->is_dynamic() && !tensor->has_padding() &&
+         tensor->layout() == ref.layout() && tensor->data_type() == ref.data_type() &&
+         tensor->total_size() == ref.total_size() && getShape(tensor) == getShape(&ref);
+}
+
+bool appearsOnlyAt(const TensorVector &tensors, const backend::ITensor *tensor, size_t pos)
+{
+  for (size_t i = 0; i < tensors.size(); ++i)
+  {
+    if (i != pos && tensors[i].get() == tensor)
+      return false;
+  }
+  return true;
+}
+
+void unbind(const std::vector<LoopVar> &vars)
+{
+  for (const auto &var : vars)
+  {
+    var.cond_input->setUserBuffer(nullptr);
+    var.body_input->setUserBuffer(nullptr);
+    var.body_output->setUserBuffer(nullptr);
+  }
+}
+
+} // namespace
+
 WhileLayer::WhileLayer(std::vector<std::shared_ptr<backend::ITensor>> input_tensors,
                        std::vector<std::shared_ptr<backend::ITensor>> output_tensors,
                        const ir::SubgraphIndex &cond_subg_index,
@@ -61,13 +110,63 @@ void WhileLayer::run()
   const auto &cond_input_tensors = cond_exec->getInputTensors();
   const auto &body_input_tensors = body_exec->getInputTensors();
   const auto &body_output_tensors = body_exec->getOutputTensors();
+  const auto &cond_output_tensors = cond_exec->getOutputTensors();
+  const auto num_vars = cond_input_tensors.size();
+  assert(body_input_tensors.size() == num_vars);
+  assert(body_output_tensors.size() == num_vars);
+
+  // Let cond inputs, body inputs and body outputs of a loop-carried variable use double buffers,
+  // which are swapped after each run of body subg instead of copying the values. Tensors which
+  // cannot use the buffers are copied as before.
+  std::vector<LoopVar> vars;
+  TensorVector cond_input_to_body_input_src = cond_input_tensors;
+  TensorVector body_output_to_cond_input_src = body_output_tensors;
+  _loop_var_buffers.resize(num_vars * 2);
+  for (size_t i = 0; i < num_vars; ++i)
+  {
+    auto cond_input = cond_input_tensors[i].get();
+    auto body_input = body_input_tensors[i].get();
+    auto body_output = body_output_tensors[i].get();
+    if (cond_input == nullptr || !isSharable(cond_input, *cond_input) ||
+        !isSharable(body_input, *cond_input) || !isSharable(body_output, *cond_input))
+      continue;
+
+    // A tensor used as another variable or as cond output must keep its own value
+    if (!appearsOnlyAt(cond_input_tensors, cond_input, i) ||
+        !appearsOnlyAt(body_input_tensors, body_input, i) ||
+        !appearsOnlyAt(body_output_tensors, body_output, i) ||
+        !appearsOnlyAt(body_input_tensors, body_output, i) ||
+        !appearsOnlyAt(body_output_tensors, body_input, i) ||
+        std::find(cond_output_tensors.begin(), cond_output_tensors.end(),
+                  cond_input_tensors[i]) != cond_output_tensors.end())
+      continue;
+
+    auto &front = _loop_var_buffers[i * 2];
+    auto &back = _loop_var_buffers[i * 2 + 1];
+    const bool invariant = (body_output == body_input);
+    front.resize(std::max(front.size(), cond_input->total_size()));
+    if (!invariant)
+      back.resize(std::max(back.size(), cond_input->total_size()));
+
+    LoopVar var{cond_input, body_input, body_output, front.data(),
+                invariant ? front.data() : back.data()};
+    if (!cond_input->setUserBuffer(var.cur) || !body_input->setUserBuffer(var.cur) ||
+        !body_output->setUserBuffer(var.next))
+    {
+      unbind({var});
+      continue;
+    }
+    vars.emplace_back(var);
+    cond_input_to_body_input_src[i] = nullptr;
+    body_output_to_cond_input_src[i] = nullptr;
+  }
 
   const auto permute_op_input_to_cond_input =
       std::make_shared<PermuteLayer>(_input_tensors, cond_input_tensors);
   const auto permute_cond_input_to_body_input =
-      std::make_shared<PermuteLayer>(cond_input_tensors, body_input_tensors);
+      std::make_shared<PermuteLayer>(cond_input_to_body_input_src, body_input_tensors);
   const auto permute_body_output_to_cond_input =
-      std::make_shared<PermuteLayer>(body_output_tensors, cond_input_tensors);
+      std::make_shared<PermuteLayer>(body_output_to_cond_input_src, cond_input_tensors);
   const auto permute_cond_input_to_op_output =
       std::make_shared<PermuteLayer>(cond_input_tensors, _output_tensors);
 
@@ -77,23 +176,42 @@ void WhileLayer::run()
   permute_body_output_to_cond_input->prepare();
   permute_cond_input_to_op_output->prepare();
 
-  cond_exec->execute(_input_tensors, permute_op_input_to_cond_input);
-
-  assert(cond_exec->getOutputTensors().size() == 1);
-  auto &cond_output_tensor = cond_exec->getOutputTensors().at(0);
   auto getResultCond = [](backend::ITensor *tensor) -> bool {
     bool ret = false;
     tensor->access([&](ITensor &tensor) { ret = *reinterpret_cast<bool *>(tensor.buffer()); });
     return ret;
   };
 
-  // Loop while Cond subgraph's output is true
-  while (getResultCond(cond_output_tensor.get()))
+  try
+  {
+    cond_exec->execute(_input_tensors, permute_op_input_to_cond_input);
+
+    assert(cond_output_tensors.size() == 1);
+    auto &cond_output_tensor = cond_output_tensors.at(0);
+
+    // Loop while Cond subgraph's output is true
+    while (getResultCond(cond_output_tensor.get()))
+    {
+      body_exec->execute(cond_input_to_body_input_src, permute_cond_input_to_body_input);
+      for (auto &var : vars)
+      {
+        if (var.cur == var.next)
+          continue;
+        std::swap(var.cur, var.next);
+        var.cond_input->setUserBuffer(var.cur);
+        var.body_input->setUserBuffer(var.cur);
+        var.body_output->setUserBuffer(var.next);
+      }
+      cond_exec->execute(body_output_to_cond_input_src, permute_body_output_to_cond_input);
+    }
+    permute_cond_input_to_op_output->run();
+  }
+  catch (...)
   {
-    body_exec->execute(cond_input_tensors, permute_cond_input_to_body_input);
-    cond_exec->execute(body_output_tensors, permute_body_output_to_cond_input);
+    unbind(vars);
+    throw;
   }
-  permute_cond_input_to_op_output->run();
+  unbind(vars);
 }
 
 } // namespace kernel
@@ -21,6 +21,8 @@
 #include <exec/IExecutor.h>
 #include <exec/IFunction.h>
 
+#include <vector>
+
 namespace onert
 {
 namespace backend
@@ -57,6 +59,8 @@ private:
   const std::vector<std::shared_ptr<backend::ITensor>> _input_tensors;
   const std::vector<std::shared_ptr<backend::ITensor>> _output_tensors;
   const std::shared_ptr<exec::ExecutorMap> &_executor_map;
+  // Two buffers per loop-carried variable, which are used by cond/body subgraphs in turn
+  std::vector<std::vector<uint8_t>> _loop_var_buffers;
 };
 
 } // namespace kernel
@@ -38,7 +38,8 @@ public:
 
 public:
   Tensor(const ir::OperandInfo &info, const ir::Layout layout)
-      : _info(info), _layout(layout), _buffer(nullptr), _num_references(0), _allocator(nullptr)
+      : _info(info), _layout(layout), _buffer(nullptr), _num_references(0), _allocator(nullptr),
+        _user_buffer(nullptr)
   {
     // DO NOTHING
   }
@@ -56,10 +57,15 @@ public:
     _allocator = alloc;
   }
 
+  // This works just as setBuffer but it simply overwrite existing Allocator without nullptr check
+  void overwriteBuffer(const std::shared_ptr<cpu_common::Allocator> &alloc) { _allocator = alloc; }
+
 public:
   uint8_t *buffer() const override
   {
-    if (_allocator != nullptr)
+    if (_user_buffer != nullptr)
+      return _user_buffer;
+    else if (_allocator != nullptr)
       return _allocator->base();
     else
       return _buffer;
@@ -85,7 +91,17 @@ public:
   bool has_padding() const override { return false; }
   void access(const std::function<void(ITensor &tensor)> &fn) final;
   bool is_dynamic() const override { return _info.isDynamic(); }
-  void set_dynamic() override { _info.setDynamic(); }
+  void set_dynamic() override
+  {
+    _info.setDynamic();
+    // User buffer cannot hold the tensor whose shape is changing
+    _user_buffer = nullptr;
+  }
+  bool setUserBuffer(uint8_t *buffer) override
+  {
+    _user_buffer = buffer;
+    return true;
+  }
 
   void increase_ref()
   {
@@ -137,6 +153,7 @@ private:
   uint8_t *_buffer;
   int32_t _num_references;
   std::shared_ptr<cpu_common::Allocator> _allocator;
+  uint8_t *_user_buffer;
 };
 
 } // namespace operand
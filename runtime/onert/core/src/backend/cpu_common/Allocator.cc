@@ -26,13 +26,18 @@ namespace cpu_common
 {
 
 Allocator::Allocator(uint32_t capacity)
+    : _base{new uint8_t[capacity](), [](uint8_t *base) { delete[] base; }}
 {
-  _base = std::make_unique<uint8_t[]>(capacity);
-
   VERBOSE(ALLOC) << "allocation capacity: " << capacity << std::endl;
   VERBOSE(ALLOC) << "base pointer: " << static_cast<void *>(_base.get()) << std::endl;
 }
 
+Allocator::Allocator(uint8_t *base, const std::function<void(uint8_t *)> &releaser)
+    : _base{base, releaser}
+{
+  // DO NOTHING
+}
+
 } // namespace cpu_common
 } // namespace backend
 } // namespace onert
@@ -17,6 +17,8 @@
 #include "MemoryManager.h"
 
 #include <cassert>
+#include <map>
+#include <mutex>
 
 #include "MemoryPlannerFactory.h"
 #include "util/ConfigSource.h"
@@ -70,32 +72,123 @@ uint8_t *MemoryManager::getBuffer(const ir::OperandIndex &ind) const
   return _mem_alloc->base() + mem_blk.offset;
 }
 
+/**
+ * @brief Pool of heap blocks which keeps released blocks for later requests
+ *
+ * Blocks are not zero-initialized. The pool is shared with the Allocator objects it handed out
+ * blocks to, so it lives as long as any of them. Free blocks are kept up to a total size, and the
+ * smallest ones are freed first beyond it since they are the cheapest to allocate again.
+ */
+class DynamicMemoryManager::BufferPool : public std::enable_shared_from_this<BufferPool>
+{
+public:
+  BufferPool(uint64_t max_pooled_bytes) : _max_pooled_bytes{max_pooled_bytes} {}
+
+public:
+  std::shared_ptr<cpu_common::Allocator> allocate(uint32_t size)
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+
+    ++_stats.num_allocations;
+
+    // Reuse the smallest free block which fits, unless more than half of it would be wasted
+    uint8_t *base = nullptr;
+    uint32_t capacity = size;
+    auto found = _free_blocks.lower_bound(size);
+    if (found != _free_blocks.end() && found->first / 2 <= size)
+    {
+      capacity = found->first;
+      base = found->second.release();
+      _free_blocks.erase(found);
+      _stats.pooled_bytes -= capacity;
+    }
+    else
+    {
+      ++_stats.num_heap_allocations;
+      base = new uint8_t[capacity];
+    }
+
+    auto pool = shared_from_this();
+    return std::make_shared<cpu_common::Allocator>(
+        base, [pool, capacity](uint8_t *block) { pool->reclaim(block, capacity); });
+  }
+
+  void clear(void)
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _free_blocks.clear();
+    _stats.pooled_bytes = 0;
+  }
+
+  Stats stats(void) const
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    return _stats;
+  }
+
+private:
+  void reclaim(uint8_t *block, uint32_t capacity)
+  {
+    std::unique_ptr<uint8_t[]> owned{block};
+    if (capacity > _max_pooled_bytes)
+      return;
+
+    std::lock_guard<std::mutex> lock{_mutex};
+    _free_blocks.emplace(capacity, std::move(owned));
+    _stats.pooled_bytes += capacity;
+    while (_stats.pooled_bytes > _max_pooled_bytes)
+    {
+      auto smallest = _free_blocks.begin();
+      _stats.pooled_bytes -= smallest->first;
+      _free_blocks.erase(smallest);
+    }
+  }
+
+private:
+  const uint64_t _max_pooled_bytes;
+  mutable std::mutex _mutex;
+  std::multimap<uint32_t, std::unique_ptr<uint8_t[]>> _free_blocks;
+  Stats _stats;
+};
+
+DynamicMemoryManager::DynamicMemoryManager(uint64_t max_pooled_bytes)
+    : _pool{std::make_shared<BufferPool>(max_pooled_bytes)}
+{
+  // DO NOTHING
+}
+
 std::shared_ptr<cpu_common::Allocator> DynamicMemoryManager::allocate(const ir::OperandIndex &ind,
                                                                       uint32_t capacity)
 {
-  auto mem_alloc = std::make_shared<cpu_common::Allocator>(capacity);
+  auto mem_alloc = _pool->allocate(capacity);
+  std::lock_guard<std::mutex> lock{_mutex};
   _mem_alloc_map[ind] = mem_alloc;
   return mem_alloc;
 }
 
 void DynamicMemoryManager::deallocate(const ir::OperandIndex &ind)
 {
+  std::lock_guard<std::mutex> lock{_mutex};
   auto find = _mem_alloc_map.find(ind);
   if (find == _mem_alloc_map.end())
     throw std::runtime_error("Cannot find Allocator for the requested index");
 
-  auto alloc = find->second;
-  alloc.reset();
+  // Give the buffer back to the pool. Tensors still holding the allocator see nullptr buffer
+  find->second->release();
 }
 
 void DynamicMemoryManager::deallocate(void)
 {
+  std::lock_guard<std::mutex> lock{_mutex};
   for (auto &mem_alloc : _mem_alloc_map)
   {
     mem_alloc.second->release();
   }
+  _pool->clear();
 }
 
+DynamicMemoryManager::Stats DynamicMemoryManager::stats(void) const { return _pool->stats(); }
+
 } // namespace cpu_common
 } // namespace backend
 } // namespace onert
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "MemoryManager.h"
+#include "ir/Index.h"
+
+#include <thread>
+#include <vector>
+
+using onert::backend::cpu_common::DynamicMemoryManager;
+using onert::ir::OperandIndex;
+
+TEST(DynamicMemoryManager, reuse_released_buffer)
+{
+  DynamicMemoryManager mgr;
+
+  auto alloc = mgr.allocate(OperandIndex{0}, 1024);
+  ASSERT_NE(alloc->base(), nullptr);
+  uint8_t *base = alloc->base();
+
+  // Released buffer is handed out again for a request which fits in it
+  mgr.deallocate(OperandIndex{0});
+  ASSERT_EQ(alloc->base(), nullptr);
+  auto realloc = mgr.allocate(OperandIndex{0}, 1000);
+  ASSERT_EQ(realloc->base(), base);
+
+  // The buffer is in use, so a new one is needed
+  auto other = mgr.allocate(OperandIndex{1}, 1000);
+  ASSERT_NE(other->base(), base);
+
+  ASSERT_EQ(mgr.stats().num_allocations, 3u);
+  ASSERT_EQ(mgr.stats().num_heap_allocations, 2u);
+}
+
+TEST(DynamicMemoryManager, neg_no_reuse_of_too_large_buffer)
+{
+  DynamicMemoryManager mgr;
+
+  mgr.allocate(OperandIndex{0}, 4096);
+  mgr.deallocate(OperandIndex{0});
+
+  // Most of the released buffer would be wasted
+  mgr.allocate(OperandIndex{0}, 16);
+  ASSERT_EQ(mgr.stats().num_heap_allocations, 2u);
+}
+
+TEST(DynamicMemoryManager, buffer_outlives_manager)
+{
+  std::shared_ptr<onert::backend::cpu_common::Allocator> alloc;
+  {
+    DynamicMemoryManager mgr;
+    alloc = mgr.allocate(OperandIndex{0}, 64);
+  }
+  ASSERT_NE(alloc->base(), nullptr);
+  alloc->base()[63] = 1;
+  alloc->release();
+}
+
+TEST(DynamicMemoryManager, neg_deallocate_unknown_index)
+{
+  DynamicMemoryManager mgr;
+  EXPECT_ANY_THROW(mgr.deallocate(OperandIndex{0}));
+}
+
+TEST(DynamicMemoryManager, pooled_bytes_bounded)
+{
+  DynamicMemoryManager mgr{1024};
+
+  for (uint32_t i = 0; i < 3; ++i)
+    mgr.allocate(OperandIndex{i}, 256 * (i + 1));
+  mgr.deallocate(OperandIndex{0});
+  mgr.deallocate(OperandIndex{1});
+  ASSERT_EQ(mgr.stats().pooled_bytes, 256u + 512u);
+
+  // Smallest blocks are freed until the pool fits in its bound again
+  mgr.deallocate(OperandIndex{2});
+  ASSERT_EQ(mgr.stats().pooled_bytes, 768u);
+
+  // A block larger than the bound is never kept
+  mgr.allocate(OperandIndex{3}, 2048);
+  mgr.deallocate(OperandIndex{3});
+  ASSERT_EQ(mgr.stats().pooled_bytes, 768u);
+  ASSERT_EQ(mgr.stats().num_heap_allocations, 4u);
+}
+
+TEST(DynamicMemoryManager, concurrent_allocation)
+{
+  DynamicMemoryManager mgr;
+
+  // Jobs run by different workers allocate and deallocate their own outputs
+  std::vector<std::thread> threads;
+  for (uint32_t t = 0; t < 4; ++t)
+  {
+    threads.emplace_back([&mgr, t]() {
+      for (uint32_t i = 0; i < 100; ++i)
+      {
+        const OperandIndex ind{t * 100 + i};
+        mgr.allocate(ind, 64 * (i % 4 + 1))->base()[0] = 1;
+        mgr.deallocate(ind);
+      }
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+
+  ASSERT_EQ(mgr.stats().num_allocations, 400u);
+}
@@ -19,6 +19,7 @@
 #include "ParamChecker.h"
 #include "ExecutorFactory.h"
 #include "OperationValidator.h"
+#include "Fp16WeightConverter.h"
 #include "Fp32ToFp16Converter.h"
 
 #include <backend/controlflow/Config.h>
@@ -34,6 +35,7 @@
 #include "util/ConfigSource.h"
 #include "util/logging.h"
 #include "ir/OperationDumper.h"
+#include "ir/pass/EpilogueFusionPass.h"
 #include "misc/string_helpers.h"
 
 namespace onert
@@ -64,6 +66,8 @@ CompilerOptions fetchCompilerOptionsFromGlobalConfig(const ir::Subgraphs &subgs)
   CompilerOptions options;
   options.backend_list = nnfw::misc::split(util::getConfigString(util::config::BACKENDS), ';');
   options.trace_filepath = util::getConfigString(util::config::TRACE_FILEPATH);
+  const auto trace_ring_size = util::getConfigInt(util::config::TRACE_RING_SIZE);
+  options.trace_ring_size = trace_ring_size > 0 ? static_cast<uint32_t>(trace_ring_size) : 0;
   options.graph_dump_level = util::getConfigInt(util::config::GRAPH_DOT_DUMP);
   options.op_seq_max_node = util::getConfigInt(util::config::OP_SEQ_MAX_NODE);
   options.executor = util::getConfigString(util::config::EXECUTOR);
@@ -71,6 +75,11 @@ CompilerOptions fetchCompilerOptionsFromGlobalConfig(const ir::Subgraphs &subgs)
   options.he_profiling_mode = util::getConfigBool(util::config::PROFILING_MODE);
   options.disable_compile = util::getConfigBool(util::config::DISABLE_COMPILE);
   options.fp16_enable = util::getConfigBool(util::config::FP16_ENABLE);
+  options.epilogue_fusion = util::getConfigBool(util::config::EPILOGUE_FUSION);
+  const auto num_threads = util::getConfigInt(util::config::NUM_THREADS);
+  options.num_threads = num_threads > 0 ? static_cast<uint32_t>(num_threads) : 0;
+  const auto num_contexts = util::getConfigInt(util::config::NUM_CONTEXTS);
+  options.num_contexts = num_contexts > 0 ? static_cast<uint32_t>(num_contexts) : 0;
 
   {
     // Backend for all
@@ -149,10 +158,16 @@ void Compiler::checkProfilerConditions()
 
   if (_options.executor != "Dataflow")
     throw std::runtime_error("Profiling mode works only with 'Dataflow' executor");
+
+  if (_options.num_contexts != 1)
+    throw std::runtime_error("Profiling mode works only with a single execution context");
 }
 
 void Compiler::compile(void)
 {
+  if (_options.num_contexts == 0)
+    throw std::runtime_error("At least one execution context is required");
+
   std::set<ir::OpCode> cf_ops;
   _subgraphs->iterate([&](const ir::SubgraphIndex &, const ir::Graph &graph) {
     const auto ops = getControlFlowOp(graph);
@@ -181,6 +196,7 @@ void Compiler::compile(void)
                                           _options.backend_list.end(), "/")
                       << std::endl;
     VERBOSE(Compiler) << "trace_filepath           : " << _options.trace_filepath << std::endl;
+    VERBOSE(Compiler) << "trace_ring_size          : " << _options.trace_ring_size << std::endl;
     VERBOSE(Compiler) << "graph_dump_level         : " << _options.graph_dump_level << std::endl;
     VERBOSE(Compiler) << "op_seq_max_node          : " << _options.op_seq_max_node << std::endl;
     VERBOSE(Compiler) << "executor                 : " << _options.executor << std::endl;
@@ -189,6 +205,8 @@ void Compiler::compile(void)
     VERBOSE(Compiler) << "he_profiling_mode        : " << _options.he_profiling_mode << std::endl;
     VERBOSE(Compiler) << "disable_compile          : " << _options.disable_compile << std::endl;
     VERBOSE(Compiler) << "fp16_enable              : " << _options.fp16_enable << std::endl;
+    VERBOSE(Compiler) << "epilogue_fusion          : " << _options.epilogue_fusion << std::endl;
+    VERBOSE(Compiler) << "num_contexts             : " << _options.num_contexts << std::endl;
     VERBOSE(Compiler) << std::noboolalpha;
   }
 
@@ -201,10 +219,16 @@ void Compiler::compile(void)
   //       execution between interpreter and compiled executor (including control flow)
   if (!checkCompilable())
   {
-    _executors = std::make_shared<exec::ExecutorMap>();
-    _subgraphs->iterate([&](const ir::SubgraphIndex &index, ir::Graph &subg) {
-      _executors->insert(std::make_pair(index, std::make_unique<interp::InterpExecutor>(subg)));
-    });
+    _contexts.clear();
+    for (uint32_t ctx_index = 0; ctx_index < _options.num_contexts; ++ctx_index)
+    {
+      auto executors = std::make_shared<exec::ExecutorMap>();
+      _subgraphs->iterate([&](const ir::SubgraphIndex &index, ir::Graph &subg) {
+        executors->insert(std::make_pair(index, std::make_unique<interp::InterpExecutor>(subg)));
+      });
+      _contexts.emplace_back(executors);
+    }
+    _executors = _contexts.front();
     _state = State::COMPILED;
     return;
   }
@@ -219,7 +243,10 @@ void Compiler::compile(void)
   auto dump_level = static_cast<dumper::dot::DotDumper::Level>(_options.graph_dump_level);
 
   // Lower: Assign backend
-  std::unordered_map<ir::SubgraphIndex, std::unique_ptr<ir::LoweredGraph>> lowered_subgs;
+  // Each execution context has its own lowered graphs. They are copies of the same graph, so
+  // constant data of operands is shared among contexts instead of being duplicated.
+  using LoweredSubgraphs = std::unordered_map<ir::SubgraphIndex, std::unique_ptr<ir::LoweredGraph>>;
+  std::vector<LoweredSubgraphs> lowered_subgs_list(_options.num_contexts);
   _subgraphs->iterate([&](const ir::SubgraphIndex &index, ir::Graph &subg) {
     onert::dumper::dot::DotDumper dot_dumper(subg, dump_level);
     dot_dumper.dump(nnfw::misc::str("before_lower_subg-", index.value()));
@@ -227,21 +254,38 @@ void Compiler::compile(void)
     // mark an input tensor "dynamic" when the tensor has unknown dim
     setInputToDynamicTensor(subg);
 
-    // Lower: Assign backend
-    lowered_subgs[index] = std::make_unique<ir::LoweredGraph>(subg, _options);
-
-    // Check backend(s) for subgraph support FP16
-    bool backends_support_fp16 = true;
-    auto &contexts = (*lowered_subgs[index]).backend_contexts();
-    for (auto it = contexts.begin(); it != contexts.end(); it++)
+    // Epilogues are fused before the subgraph is copied for each context, so that constants
+    // folded into weights are shared by all contexts
+    if (_options.epilogue_fusion)
     {
-      backends_support_fp16 &= it->first->config()->supportFP16();
+      ir::pass::EpilogueFusionPass(subg).run();
     }
 
-    if (_options.fp16_enable && backends_support_fp16)
+    // fp16 weights are converted once and shared by all contexts, like the fp32 ones are
+    Fp16WeightConverter::ConvertedData fp16_weights;
+    for (auto &lowered_subgs : lowered_subgs_list)
     {
-      // NOTE: the only acl_cl backend enables fp16 mode
-      Fp32ToFp16Converter(*lowered_subgs[index]).run();
+      // Lower: Assign backend
+      lowered_subgs[index] = std::make_unique<ir::LoweredGraph>(subg, _options);
+
+      // Check backend(s) for subgraph support FP16
+      bool backends_support_fp16 = true;
+      auto &contexts = (*lowered_subgs[index]).backend_contexts();
+      for (auto it = contexts.begin(); it != contexts.end(); it++)
+      {
+        backends_support_fp16 &= it->first->config()->supportFP16();
+      }
+
+      if (_options.fp16_enable && backends_support_fp16)
+      {
+        // NOTE: the only acl_cl backend enables fp16 mode
+        Fp32ToFp16Converter(*lowered_subgs[index]).run();
+      }
+      else if (_options.fp16_enable)
+      {
+        // NOTE: Backends computing in fp32, like cpu, store only weights as fp16
+        Fp16WeightConverter(*lowered_subgs[index], fp16_weights).run();
+      }
     }
 
     subg.setSubgraphs(nullptr);
@@ -254,31 +298,56 @@ void Compiler::compile(void)
    *************************************************************/
 
   // operation validation
-  for (auto &pair : lowered_subgs)
+  for (auto &pair : lowered_subgs_list.front())
   {
     auto &lowered_subg = pair.second;
     compiler::OperationValidator{lowered_subg->graph()}();
   }
 
-  _executors = std::make_shared<exec::ExecutorMap>();
-  for (auto &pair : lowered_subgs)
+  _contexts.clear();
+  for (uint32_t ctx_index = 0; ctx_index < _options.num_contexts; ++ctx_index)
   {
-    const auto &subg_index = pair.first;
-    auto &lowered_subg = pair.second;
-    auto indexed_ranks = lowered_subg->indexed_ranks();
+    // Only the first context dumps and traces, since the others are exactly the same
+    auto options = _options;
+    if (ctx_index != 0)
+    {
+      options.trace_filepath.clear();
+    }
+
+    auto executors = std::make_shared<exec::ExecutorMap>();
+    for (auto &pair : lowered_subgs_list[ctx_index])
+    {
+      const auto &subg_index = pair.first;
+      auto &lowered_subg = pair.second;
+      auto indexed_ranks = lowered_subg->indexed_ranks();
 
-    onert::dumper::dot::DotDumper dot_dumper_lowered(lowered_subg.get(), dump_level);
-    dot_dumper_lowered.dump("after_lower_subg-" + std::to_string(subg_index.value()));
+      if (ctx_index == 0)
+      {
+        onert::dumper::dot::DotDumper dot_dumper_lowered(lowered_subg.get(), dump_level);
+        dot_dumper_lowered.dump("after_lower_subg-" + std::to_string(subg_index.value()));
+
+        ir::OperationDumper dumper("START SUBGRAPH " + std::to_string(subg_index.value()));
+        lowered_subg->graph().operations().iterate(
+            [&](const ir::OperationIndex &, const ir::Operation &op) { op.accept(dumper); });
+      }
 
-    ir::OperationDumper dumper("START SUBGRAPH " + std::to_string(subg_index.value()));
-    lowered_subg->graph().operations().iterate(
-        [&](const ir::OperationIndex &, const ir::Operation &op) { op.accept(dumper); });
+      // Ring tracing writes a file for each executor, so executors of other subgraphs must not
+      // overwrite the file of the primary subgraph
+      auto subg_options = options;
+      if (options.trace_ring_size > 0 && !options.trace_filepath.empty() &&
+          subg_index != ir::SubgraphIndex{0})
+      {
+        subg_options.trace_filepath += "." + std::to_string(subg_index.value());
+      }
 
-    auto executor = std::unique_ptr<exec::IExecutor>{
-        ExecutorFactory::get().create(std::move(lowered_subg), _options, _executors)};
-    executor->setIndexedRanks(indexed_ranks);
-    _executors->insert(std::make_pair(subg_index, std::move(executor)));
+      auto executor = std::unique_ptr<exec::IExecutor>{
+          ExecutorFactory::get().create(std::move(lowered_subg), subg_options, executors)};
+      executor->setIndexedRanks(indexed_ranks);
+      executors->insert(std::make_pair(subg_index, std::move(executor)));
+    }
+    _contexts.emplace_back(executors);
   }
+  _executors = _contexts.front();
 
   /********************************
    * Code generation phase finished
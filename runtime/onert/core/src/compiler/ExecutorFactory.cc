@@ -185,6 +185,23 @@ void ExecutorFactory::runTensorRegistration(ir::LoweredGraph *lowered_graph,
   }
 }
 
+std::unique_ptr<exec::IExecutionObserver>
+ExecutorFactory::createTracingObserver(const ir::LoweredGraph &lowered_graph,
+                                       const compiler::CompilerOptions &options)
+{
+  if (options.trace_filepath.empty())
+  {
+    return nullptr;
+  }
+  if (options.trace_ring_size > 0)
+  {
+    return std::make_unique<exec::RingTracingObserver>(options.trace_filepath, lowered_graph,
+                                                       options.trace_ring_size);
+  }
+  return std::make_unique<exec::ChromeTracingObserver>(options.trace_filepath,
+                                                       lowered_graph.graph());
+}
+
 exec::IExecutor *
 ExecutorFactory::createLinearExecutor(std::unique_ptr<ir::LoweredGraph> lowered_graph,
                                       const compiler::CompilerOptions &options,
@@ -287,14 +304,14 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<ir::LoweredGraph> lowered_
     });
   }
 
+  auto tracer = createTracingObserver(*lowered_graph, options);
+
   auto exec = new exec::LinearExecutor{std::move(lowered_graph), tensor_builders,
-                                       std::move(code_map), order};
+                                       std::move(code_map), order, options.num_threads};
 
-  if (!options.trace_filepath.empty())
+  if (tracer)
   {
-    std::unique_ptr<exec::IExecutionObserver> ctp =
-        std::make_unique<exec::ChromeTracingObserver>(options.trace_filepath, exec->graph());
-    exec->addObserver(std::move(ctp));
+    exec->addObserver(std::move(tracer));
   }
 
   return exec;
@@ -390,16 +407,18 @@ exec::IExecutor *ExecutorFactory::createDataflowExecutor(
     });
   }
 
+  auto tracer = createTracingObserver(*lowered_graph, options);
+
   exec::ExecutorBase *exec = nullptr;
   if (parallel)
   {
-    exec =
-        new exec::ParallelExecutor{std::move(lowered_graph), tensor_builders, std::move(code_map)};
+    exec = new exec::ParallelExecutor{std::move(lowered_graph), tensor_builders,
+                                      std::move(code_map), options.num_threads};
   }
   else
   {
-    auto dataflow_exec =
-        new exec::DataflowExecutor{std::move(lowered_graph), tensor_builders, std::move(code_map)};
+    auto dataflow_exec = new exec::DataflowExecutor{std::move(lowered_graph), tensor_builders,
+                                                    std::move(code_map), options.num_threads};
     if (options.he_profiling_mode)
     {
       std::vector<const backend::Backend *> backends;
@@ -415,11 +434,9 @@ exec::IExecutor *ExecutorFactory::createDataflowExecutor(
     exec = dataflow_exec;
   }
 
-  if (!options.trace_filepath.empty())
+  if (tracer)
   {
-    std::unique_ptr<exec::IExecutionObserver> ctp =
-        std::make_unique<exec::ChromeTracingObserver>(options.trace_filepath, exec->graph());
-    exec->addObserver(std::move(ctp));
+    exec->addObserver(std::move(tracer));
   }
 
   return exec;
@@ -44,6 +44,9 @@ private:
   static void initializeBackendContext(ir::LoweredGraph *lowered_graph);
   static void runTensorRegistration(ir::LoweredGraph *lowered_graph,
                                     const std::vector<ir::OpSequenceIndex> &order);
+  static std::unique_ptr<exec::IExecutionObserver>
+  createTracingObserver(const ir::LoweredGraph &lowered_graph,
+                        const compiler::CompilerOptions &options);
   static exec::IExecutor *
   createLinearExecutor(std::unique_ptr<ir::LoweredGraph> lowered_graph,
                        const compiler::CompilerOptions &options,
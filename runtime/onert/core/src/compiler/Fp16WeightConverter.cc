@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Fp16WeightConverter.h"
+#include "ir/operation/Conv2D.h"
+#include "ir/operation/DepthwiseConv2D.h"
+#include "ir/operation/FullyConnected.h"
+#include "util/logging.h"
+
+namespace
+{
+
+const std::string kCpuBackendConfigId = "cpu";
+
+void copyDataFromFp32ToFp16(const float *from, onert::ir::float16 *into, size_t num_elements)
+{
+  for (size_t i = 0; i < num_elements; ++i)
+  {
+    into[i] = static_cast<onert::ir::float16>(from[i]);
+  }
+}
+
+} // namespace
+
+namespace onert
+{
+
+namespace compiler
+{
+
+Fp16WeightConverter::Fp16WeightConverter(ir::LoweredGraph &lowered_graph,
+                                         ConvertedData &converted)
+    : _lowered_graph{lowered_graph}, _converted{converted}
+{
+  VERBOSE(Fp16WeightConverter) << "Fp16 weights Enable on" << std::endl;
+}
+
+void Fp16WeightConverter::run()
+{
+  _lowered_graph.graph().operands().iterate([&](const ir::OperandIndex &ind, ir::Operand &obj) {
+    if (!isConvertible(ind, obj))
+      return;
+
+    auto data = obj.shareData();
+    assert(data != nullptr);
+
+    // The key stays valid while the graph which lowered graphs are copied from holds fp32 data
+    auto &new_data = _converted[data.get()];
+    if (new_data == nullptr)
+    {
+      size_t num_elements = obj.operandSize() / ir::sizeOfDataType(ir::DataType::FLOAT32);
+      size_t new_ptr_size = num_elements * sizeof(ir::float16);
+      auto new_ptr = std::make_unique<uint8_t[]>(new_ptr_size);
+      copyDataFromFp32ToFp16(reinterpret_cast<const float *>(data->base()),
+                             reinterpret_cast<ir::float16 *>(new_ptr.get()), num_elements);
+      new_data = std::make_shared<ir::CachedData>(new_ptr.get(), new_ptr_size);
+    }
+    obj.releaseData();
+
+    obj.data(std::shared_ptr<ir::Data>{new_data});
+    obj.type(ir::DataType::FLOAT16);
+    VERBOSE(Fp16WeightConverter) << "Weight Operand #" << ind.value() << ": fp16" << std::endl;
+  });
+}
+
+bool Fp16WeightConverter::isConvertible(const ir::OperandIndex &ind, const ir::Operand &obj) const
+{
+  if (!obj.isConstant() || obj.typeInfo().type() != ir::DataType::FLOAT32)
+    return false;
+
+  // Every use must be a supported operation on cpu backend, since others expect fp32 data
+  if (obj.getUses().size() == 0)
+    return false;
+  for (const auto &op_ind : obj.getUses())
+  {
+    if (!isWeightOfSupportedOperation(ind, op_ind))
+      return false;
+  }
+
+  const auto lower_info = _lowered_graph.getLowerInfo(ind);
+  if (lower_info == nullptr || lower_info->use_factors().size() == 0)
+    return false;
+  for (const auto &factor : lower_info->use_factors())
+  {
+    if (factor.backend()->config()->id() != kCpuBackendConfigId)
+      return false;
+  }
+
+  return true;
+}
+
+bool Fp16WeightConverter::isWeightOfSupportedOperation(const ir::OperandIndex &ind,
+                                                       const ir::OperationIndex &op_ind) const
+{
+  const auto &node = _lowered_graph.graph().operations().at(op_ind);
+  const auto &operands = _lowered_graph.graph().operands();
+
+  ir::OperandIndex input_ind;
+  ir::OperandIndex weight_ind;
+  switch (node.opcode())
+  {
+    case ir::OpCode::Conv2D:
+      input_ind = node.getInputs().at(ir::operation::Conv2D::Input::INPUT);
+      weight_ind = node.getInputs().at(ir::operation::Conv2D::Input::KERNEL);
+      break;
+    case ir::OpCode::DepthwiseConv2D:
+      input_ind = node.getInputs().at(ir::operation::DepthwiseConv2D::Input::INPUT);
+      weight_ind = node.getInputs().at(ir::operation::DepthwiseConv2D::Input::KERNEL);
+      break;
+    case ir::OpCode::FullyConnected:
+      input_ind = node.getInputs().at(ir::operation::FullyConnected::Input::INPUT);
+      weight_ind = node.getInputs().at(ir::operation::FullyConnected::Input::WEIGHT);
+      break;
+    default:
+      return false;
+  }
+
+  // Only float operation with fp16 weights is supported, not fp16 nor quantized one
+  return weight_ind == ind && operands.at(input_ind).typeInfo().type() == ir::DataType::FLOAT32;
+}
+
+} // namespace compiler
+
+} // namespace onert
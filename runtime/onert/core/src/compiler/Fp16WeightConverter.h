@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_COMPILER_FP16_WEIGHT_CONVERTER_H__
+#define __ONERT_COMPILER_FP16_WEIGHT_CONVERTER_H__
+
+#include "ir/LoweredGraph.h"
+
+#include <memory>
+#include <unordered_map>
+
+namespace onert
+{
+
+namespace compiler
+{
+
+/**
+ * @brief Class to store constant weights as fp16 for backends which compute in fp32
+ *
+ * Unlike Fp32ToFp16Converter, activations stay fp32 and no converting operation is added.
+ * Only the weights of Conv2D, DepthwiseConv2D and FullyConnected on cpu backend are converted,
+ * which the backend converts back to fp32 while computing.
+ */
+class Fp16WeightConverter
+{
+public:
+  /**
+   * @brief fp16 data converted from each fp32 data
+   *
+   * Lowered graphs copied from one graph, e.g. of execution contexts, have the same fp32 data.
+   * Given the same map, they share the fp16 data converted for the first of them.
+   */
+  using ConvertedData = std::unordered_map<const ir::Data *, std::shared_ptr<ir::Data>>;
+
+public:
+  Fp16WeightConverter(ir::LoweredGraph &lowered_graph, ConvertedData &converted);
+
+public:
+  void run();
+
+private:
+  bool isConvertible(const ir::OperandIndex &ind, const ir::Operand &obj) const;
+  bool isWeightOfSupportedOperation(const ir::OperandIndex &ind,
+                                    const ir::OperationIndex &op_ind) const;
+
+private:
+  ir::LoweredGraph &_lowered_graph;
+  ConvertedData &_converted;
+};
+
+} // namespace compiler
+
+} // namespace onert
+
+#endif // __ONERT_COMPILER_FP16_WEIGHT_CONVERTER_H__
@@ -79,8 +79,9 @@ bool DataflowExecutor::noWaitingJobs()
 
 DataflowExecutor::DataflowExecutor(std::unique_ptr<ir::LoweredGraph> lowered_graph,
                                    const backend::TensorBuilderSet &tensor_builders,
-                                   compiler::CodeMap &&code_map)
-    : ExecutorBase{std::move(lowered_graph), tensor_builders}, _code_map{std::move(code_map)}
+                                   compiler::CodeMap &&code_map, uint32_t max_threads)
+    : ExecutorBase{std::move(lowered_graph), tensor_builders, max_threads},
+      _code_map{std::move(code_map)}
 {
   VERBOSE(DataflowExecutor) << "Constructing Dataflow Executor" << std::endl;
 
@@ -48,9 +48,11 @@ public:
    * @param lowered_graph LoweredGraph object
    * @param tensor_builders Tensor builders that are currently used
    * @param code_map OpSequence and its code map
+   * @param max_threads Number of threads which kernels may use in total, 0 for no limit
    */
   DataflowExecutor(std::unique_ptr<ir::LoweredGraph> lowered_graph,
-                   const backend::TensorBuilderSet &tensor_builders, compiler::CodeMap &&code_map);
+                   const backend::TensorBuilderSet &tensor_builders, compiler::CodeMap &&code_map,
+                   uint32_t max_threads);
 
   void executeImpl() override;
 
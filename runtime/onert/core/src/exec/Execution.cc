@@ -16,13 +16,45 @@
 
 #include "exec/Execution.h"
 
+#include "ThreadPool.h"
 #include "util/logging.h"
 
+#include <algorithm>
+#include <thread>
+
 namespace onert
 {
 namespace exec
 {
 
+namespace
+{
+
+/**
+ * @brief Thread pool which runs all asynchronous executions, so that each of them does not need
+ *        to spawn a thread
+ */
+ThreadPool &asyncThreadPool()
+{
+  static ThreadPool pool{std::max(1u, std::thread::hardware_concurrency())};
+  return pool;
+}
+
+class AsyncFunction : public IFunction
+{
+public:
+  AsyncFunction(std::function<void()> &&fn) : _fn{std::move(fn)} {}
+
+public:
+  void run() override { _fn(); }
+  void runSync() override { run(); }
+
+private:
+  std::function<void()> _fn;
+};
+
+} // namespace
+
 Execution::Execution(const std::shared_ptr<ExecutorMap> &executors) : _executors{executors}
 {
   assert(executors != nullptr);
@@ -32,6 +64,12 @@ Execution::Execution(const std::shared_ptr<ExecutorMap> &executors) : _executors
   _io_desc.outputs.resize(primary_subg.getOutputs().size());
 }
 
+Execution::~Execution()
+{
+  std::unique_lock<std::mutex> lock{_async_mutex};
+  _async_cv.wait(lock, [this] { return !_async_running; });
+}
+
 void Execution::changeInputShape(const ir::IOIndex &index, const ir::Shape &new_shape)
 {
   // This should be called BEFORE setInput.
@@ -119,14 +157,35 @@ void Execution::setInputLayout(const ir::IOIndex &index, ir::Layout layout)
 {
   const auto &input_desc = _io_desc.inputs.at(index.value());
   _io_desc.inputs.at(index.value()) =
-      std::make_unique<InputDesc>(input_desc->info, input_desc->buffer, input_desc->size, layout);
+      std::make_unique<InputDesc>(input_desc->info, input_desc->buffer, input_desc->size, layout,
+                                  input_desc->bind);
 }
 
 void Execution::setOutputLayout(const ir::IOIndex &index, ir::Layout layout)
 {
   const auto &output_desc = _io_desc.outputs.at(index.value());
   _io_desc.outputs.at(index.value()) = std::make_unique<OutputDesc>(
-      output_desc->info, output_desc->buffer, output_desc->size, layout);
+      output_desc->info, output_desc->buffer, output_desc->size, layout, output_desc->bind);
+}
+
+void Execution::bindInput(const ir::IOIndex &index, const void *buffer, size_t length,
+                          ir::Layout layout)
+{
+  setInput(index, buffer, length, layout);
+
+  const auto &input_desc = _io_desc.inputs.at(index.value());
+  _io_desc.inputs.at(index.value()) =
+      std::make_unique<InputDesc>(input_desc->info, buffer, length, layout, true);
+}
+
+void Execution::bindOutput(const ir::IOIndex &index, void *buffer, size_t length,
+                           ir::Layout layout)
+{
+  setOutput(index, buffer, length, layout);
+
+  const auto &output_desc = _io_desc.outputs.at(index.value());
+  _io_desc.outputs.at(index.value()) =
+      std::make_unique<OutputDesc>(output_desc->info, buffer, length, layout, true);
 }
 
 void Execution::execute()
@@ -139,19 +198,54 @@ void Execution::execute()
   VERBOSE(Execution) << "Execution finished" << std::endl;
 }
 
-void Execution::startExecute()
+void Execution::startExecute(const std::function<void(std::exception_ptr)> &callback)
 {
-  VERBOSE(Execution) << "Create asynchronous execution thread" << std::endl;
+  VERBOSE(Execution) << "Start asynchronous execution" << std::endl;
+
+  {
+    std::lock_guard<std::mutex> lock{_async_mutex};
+    if (_async_running)
+      throw std::runtime_error("Asynchronous execution is already in progress");
+    _async_running = true;
+    _async_error = nullptr;
+  }
+  finished = false;
 
-  _exec_thread = std::make_unique<std::thread>(&Execution::execute, this);
+  asyncThreadPool().enqueue(std::make_unique<AsyncFunction>([this, callback] {
+    std::exception_ptr error;
+    try
+    {
+      execute();
+    }
+    catch (...)
+    {
+      error = std::current_exception();
+    }
+
+    if (callback)
+      callback(error);
+
+    std::lock_guard<std::mutex> lock{_async_mutex};
+    _async_error = error;
+    _async_running = false;
+    _async_cv.notify_all();
+  }));
 }
 
 void Execution::waitFinish()
 {
   VERBOSE(Execution) << "Wait to finish execution" << std::endl;
 
-  _exec_thread->join();
+  std::unique_lock<std::mutex> lock{_async_mutex};
+  _async_cv.wait(lock, [this] { return !_async_running; });
   finished = true;
+
+  if (_async_error)
+  {
+    auto error = _async_error;
+    _async_error = nullptr;
+    std::rethrow_exception(error);
+  }
 }
 
 bool Execution::isFinished(void) const { return finished; }
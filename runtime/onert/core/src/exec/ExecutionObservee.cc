@@ -60,5 +60,15 @@ void ExecutionObservee::notifyJobEnd(IExecutor *executor, const ir::OpSequence *
   }
 }
 
+bool ExecutionObservee::supportConcurrentJobs() const
+{
+  for (auto &o : _observers)
+  {
+    if (!o->supportConcurrentJobs())
+      return false;
+  }
+  return true;
+}
+
 } // namespace exec
 } // namespace onert
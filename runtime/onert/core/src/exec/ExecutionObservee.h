@@ -45,6 +45,10 @@ public:
                       const backend::Backend *backend);
   void notifyJobEnd(IExecutor *executor, const ir::OpSequence *op_seq,
                     const backend::Backend *backend);
+  /**
+   * @brief Whether all the observers support jobs which begin and end concurrently
+   */
+  bool supportConcurrentJobs() const;
 
 private:
   std::list<std::unique_ptr<IExecutionObserver>> _observers;
@@ -16,13 +16,51 @@
 
 #include "exec/ExecutionObservers.h"
 
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
+#include <sstream>
 #include <string>
 
 #include "util/logging.h"
 #include "exec/IExecutor.h"
 #include "misc/polymorphic_downcast.h"
+#include "ir/LoweredGraph.h"
 #include "ir/OpSequence.h"
 
+namespace
+{
+
+std::string opSequenceTag(const onert::ir::OpSequence *op_seq,
+                          const onert::ir::Operations &operations)
+{
+  if (op_seq->size() == 0)
+    return "Empty OpSequence";
+
+  const auto &first_op_idx = op_seq->operations().at(0);
+  const auto &first_op_node = operations.at(first_op_idx);
+  std::string tag = "$" + std::to_string(first_op_idx.value());
+  tag += " " + first_op_node.name();
+  if (op_seq->size() > 1)
+  {
+    tag += " (+" + std::to_string(op_seq->size() - 1) + ")";
+  }
+  return tag;
+}
+
+// Timestamp in microseconds as Chrome trace event expects
+std::string timestamp(uint64_t ns)
+{
+  std::stringstream ss;
+  ss << ns / 1000 << '.' << std::setw(3) << std::setfill('0') << ns % 1000;
+  return ss.str();
+}
+
+// Number of requests of RingTracingObserver::requestFlush()
+std::atomic<uint64_t> ring_flush_requests{0};
+
+} // namespace
+
 namespace onert
 {
 
@@ -102,21 +140,91 @@ void ChromeTracingObserver::handleEnd(IExecutor *)
   _collector.onEvent(EventCollector::Event{EventCollector::Edge::END, "runtime", "Graph"});
 }
 
-std::string ChromeTracingObserver::opSequenceTag(const ir::OpSequence *op_seq,
-                                                 const ir::Operations &operations)
+RingTracingObserver::RingTracingObserver(const std::string &filepath,
+                                         const ir::LoweredGraph &lowered_graph, uint32_t capacity)
+    : _filepath{filepath}, _buffer{capacity}, _flush_request{ring_flush_requests.load()}
 {
-  if (op_seq->size() == 0)
-    return "Empty OpSequence";
+  _tags.emplace_back(Tag{"runtime", "Graph"});
+  lowered_graph.op_seqs().iterate(
+      [&](const ir::OpSequenceIndex &op_seq_index, const ir::OpSequence &op_seq) {
+        const auto backend = lowered_graph.getLowerInfo(op_seq_index)->backend();
+        _op_seq_ids[&op_seq] = static_cast<uint32_t>(_tags.size());
+        _tags.emplace_back(Tag{backend->config()->id(),
+                               opSequenceTag(&op_seq, lowered_graph.graph().operations())});
+      });
+}
 
-  const auto &first_op_idx = op_seq->operations().at(0);
-  const auto &first_op_node = operations.at(first_op_idx);
-  std::string tag = "$" + std::to_string(first_op_idx.value());
-  tag += " " + first_op_node.name();
-  if (op_seq->size() > 1)
+RingTracingObserver::~RingTracingObserver() { flush(); }
+
+void RingTracingObserver::handleBegin(IExecutor *)
+{
+  _buffer.record(0, util::TraceEvent::Phase::BEGIN);
+}
+
+void RingTracingObserver::handleBegin(IExecutor *, const ir::OpSequence *op_seq,
+                                      const backend::Backend *)
+{
+  record(op_seq, util::TraceEvent::Phase::BEGIN);
+}
+
+void RingTracingObserver::handleEnd(IExecutor *, const ir::OpSequence *op_seq,
+                                    const backend::Backend *)
+{
+  record(op_seq, util::TraceEvent::Phase::END);
+}
+
+void RingTracingObserver::handleEnd(IExecutor *)
+{
+  _buffer.record(0, util::TraceEvent::Phase::END);
+
+  const auto request = ring_flush_requests.load(std::memory_order_relaxed);
+  if (request != _flush_request)
   {
-    tag += " (+" + std::to_string(op_seq->size() - 1) + ")";
+    _flush_request = request;
+    flush();
   }
-  return tag;
+}
+
+void RingTracingObserver::record(const ir::OpSequence *op_seq, util::TraceEvent::Phase phase)
+{
+  auto it = _op_seq_ids.find(op_seq);
+  if (it != _op_seq_ids.end())
+  {
+    _buffer.record(it->second, phase);
+  }
+}
+
+void RingTracingObserver::requestFlush() { ring_flush_requests.fetch_add(1); }
+
+void RingTracingObserver::flush()
+{
+  std::lock_guard<std::mutex> lock{_flush_mutex};
+
+  // Events whose BEGIN or END has been overwritten or not recorded yet are not written
+  std::vector<util::TraceEvent> events;
+  for (const auto &thread_events : _buffer.collect())
+  {
+    const auto paired = util::pairedEvents(thread_events);
+    events.insert(events.end(), paired.begin(), paired.end());
+  }
+  std::stable_sort(events.begin(), events.end(),
+                   [](const util::TraceEvent &lhs, const util::TraceEvent &rhs) {
+                     return lhs.ts < rhs.ts;
+                   });
+
+  EventRecorder recorder;
+  for (const auto &event : events)
+  {
+    DurationEvent evt;
+    evt.name = _tags.at(event.id).name;
+    evt.tid = _tags.at(event.id).tid;
+    evt.ph = (event.phase == util::TraceEvent::Phase::BEGIN) ? "B" : "E";
+    evt.ts = timestamp(event.ts);
+    recorder.emit(evt);
+  }
+
+  std::ofstream ofs{_filepath, std::ofstream::out};
+  recorder.writeToFile(ofs);
 }
 
 } // namespace exec
@@ -18,6 +18,7 @@
 
 #include "backend/ITensor.h"
 #include "util/logging.h"
+#include "util/ThreadBudget.h"
 
 namespace onert
 {
@@ -25,8 +26,10 @@ namespace exec
 {
 
 ExecutorBase::ExecutorBase(std::unique_ptr<ir::LoweredGraph> &&lowered_graph,
-                           const backend::TensorBuilderSet &tensor_builders)
-    : _lowered_graph{std::move(lowered_graph)}, _graph{_lowered_graph->graph()}, _mutex()
+                           const backend::TensorBuilderSet &tensor_builders,
+                           uint32_t max_threads)
+    : _lowered_graph{std::move(lowered_graph)}, _graph{_lowered_graph->graph()}, _mutex(),
+      _max_threads{max_threads}
 {
   auto build_input_tensor_list = [&](const onert::ir::OperandIndexSequence &ind_seq) {
     std::vector<std::shared_ptr<backend::ITensor>> list;
@@ -115,6 +118,7 @@ std::unique_ptr<ISource> ExecutorBase::source(const ir::IOIndex &index, const ir
     case DataType::UINT8:
       return source<uint8_t>(index, buffer, length, io_layout);
     case DataType::QUANT_INT8_SYMM:
+    case DataType::QUANT_INT8_ASYMM:
       return source<int8_t>(index, buffer, length, io_layout);
     default:
       throw std::runtime_error("Not supported yet");
@@ -138,6 +142,7 @@ std::unique_ptr<ISink> ExecutorBase::sink(const ir::IOIndex &index, const ir::Ty
     case DataType::UINT8:
       return sink<uint8_t>(index, buffer, length, io_layout);
     case DataType::QUANT_INT8_SYMM:
+    case DataType::QUANT_INT8_ASYMM:
       return sink<int8_t>(index, buffer, length, io_layout);
     default:
       throw std::runtime_error("Not supported yet");
@@ -230,6 +235,9 @@ void ExecutorBase::execute(const IODescription &desc)
   std::vector<std::unique_ptr<ISource>> sources{_graph.getInputs().size()};
   std::vector<std::unique_ptr<ISink>> sinks{_graph.getOutputs().size()};
 
+  // Drop user buffers left bound by a previous execution that has failed
+  unbindUserBuffers();
+
   // Set input(s)
   for (uint32_t n = 0; n < _graph.getInputs().size(); ++n)
   {
@@ -253,6 +261,12 @@ void ExecutorBase::execute(const IODescription &desc)
     handleDynamicInputTensor(input_index, desc);
 
     const auto &input = *desc.inputs.at(n);
+    if (input.bind && bindUserBuffer(*_input_tensors[n], input.info,
+                                     const_cast<void *>(input.buffer), input.size, input.layout))
+    {
+      continue;
+    }
+
     sources.at(n) =
         source(input_index, input.info.typeInfo(), input.buffer, input.size, input.layout);
 
@@ -261,7 +275,23 @@ void ExecutorBase::execute(const IODescription &desc)
     _input_tensors[n]->access(setter);
   }
 
-  executeImpl();
+  // Bind output(s) which are written by kernels directly
+  for (uint32_t n = 0; n < _graph.getOutputs().size(); ++n)
+  {
+    const auto &output = desc.outputs.at(n);
+    if (output != nullptr && output->bind)
+    {
+      bindUserBuffer(*_output_tensors[n], output->info, output->buffer, output->size,
+                     output->layout);
+    }
+  }
+
+  {
+    // Kernels share the thread budget with the ones running on other threads, within the limit of
+    // this session
+    util::ThreadBudgetScope budget_scope{numKernelThreads(), _max_threads};
+    executeImpl();
+  }
 
   // Get output(s)
   for (uint32_t n = 0; n < _graph.getOutputs().size(); ++n)
@@ -279,6 +309,12 @@ void ExecutorBase::execute(const IODescription &desc)
     output.info.shape(
         convertShape(output_tensor_shape, _output_tensors[n]->layout(), output.layout));
 
+    // Kernels have already written the result to the bound buffer
+    if (output.bind && _output_tensors[n]->buffer() == output.buffer)
+    {
+      continue;
+    }
+
     sinks.at(n) =
         sink(output_index, output.info.typeInfo(), output.buffer, output.size, output.layout);
 
@@ -299,6 +335,40 @@ void ExecutorBase::execute(const IODescription &desc)
       }
     }
   }
+
+  unbindUserBuffers();
+}
+
+bool ExecutorBase::bindUserBuffer(backend::ITensor &tensor, const ir::OperandInfo &info,
+                                  void *buffer, size_t length, ir::Layout io_layout)
+{
+  const auto tensor_layout = tensor.layout();
+  const bool need_permute =
+      ((io_layout == ir::Layout::NHWC) && (tensor_layout == ir::Layout::NCHW)) ||
+      ((io_layout == ir::Layout::NCHW) && (tensor_layout == ir::Layout::NHWC));
+  const auto elem_size = ir::sizeOfDataType(tensor.data_type());
+
+  if (tensor.is_dynamic() || tensor.has_padding() || need_permute ||
+      tensor.data_type() != info.typeInfo().type() || getShape(&tensor) != info.shape() ||
+      length < tensor.total_size() || reinterpret_cast<uintptr_t>(buffer) % elem_size != 0)
+  {
+    return false;
+  }
+
+  return tensor.setUserBuffer(reinterpret_cast<uint8_t *>(buffer));
+}
+
+void ExecutorBase::unbindUserBuffers()
+{
+  for (auto &tensor : _input_tensors)
+  {
+    if (tensor != nullptr)
+      tensor->setUserBuffer(nullptr);
+  }
+  for (auto &tensor : _output_tensors)
+  {
+    tensor->setUserBuffer(nullptr);
+  }
 }
 
 /**
@@ -50,9 +50,10 @@ public:
    * @brief Construct a new ExecutorBase object
    * @param graph Graph object
    * @param tensor_builders Tensor builders that are currently used
+   * @param max_threads Number of threads which kernels may use in total, 0 for no limit
    */
   ExecutorBase(std::unique_ptr<ir::LoweredGraph> &&lowered_graph,
-               const backend::TensorBuilderSet &tensor_builders);
+               const backend::TensorBuilderSet &tensor_builders, uint32_t max_threads);
 
   virtual ~ExecutorBase() = default;
 
@@ -77,6 +78,11 @@ public:
 
   virtual void executeImpl(void) = 0;
 
+  /**
+   * @brief Get the number of threads on which this executor runs kernels at the same time
+   */
+  virtual uint32_t numKernelThreads(void) const { return 1; }
+
   void addObserver(std::unique_ptr<IExecutionObserver> ref) { _subject.add(std::move(ref)); };
 
   const std::vector<std::shared_ptr<backend::ITensor>> &getInputTensors() { return _input_tensors; }
@@ -165,9 +171,18 @@ protected:
   std::unordered_map<std::shared_ptr<backend::ITensor>, DynAllocInfo> _output_to_dyn_alloc_info;
   backend::TensorManagerSet _tensor_mgrs;
   std::mutex _mutex;
+  const uint32_t _max_threads;
 
 private:
   void handleDynamicInputTensor(ir::IOIndex input_index, const IODescription &desc);
+  /**
+   * @brief Use user buffer as memory of the tensor if it can be done without any conversion
+   *
+   * @return @c true if the buffer is bound, otherwise @c false and the buffer should be copied
+   */
+  bool bindUserBuffer(backend::ITensor &tensor, const ir::OperandInfo &info, void *buffer,
+                      size_t length, ir::Layout io_layout);
+  void unbindUserBuffers();
 };
 
 } // namespace exec
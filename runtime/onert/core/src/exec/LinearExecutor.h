@@ -45,11 +45,13 @@ public:
    * @param lowered_graph LoweredGraph object
    * @param tensor_builders Tensor builders that are currently used
    * @param code_map OpSequence and its code map
+   * @param order Order of OpSequences to run
+   * @param max_threads Number of threads which kernels may use in total, 0 for no limit
    */
   LinearExecutor(std::unique_ptr<ir::LoweredGraph> lowered_graph,
                  const backend::TensorBuilderSet &tensor_builders, compiler::CodeMap &&code_map,
-                 const std::vector<ir::OpSequenceIndex> &order)
-      : ExecutorBase{std::move(lowered_graph), tensor_builders}
+                 const std::vector<ir::OpSequenceIndex> &order, uint32_t max_threads)
+      : ExecutorBase{std::move(lowered_graph), tensor_builders, max_threads}
   {
     for (auto index : order)
     {
@@ -16,9 +16,11 @@
 
 #include "ParallelExecutor.h"
 
+#include <algorithm>
 #include <cassert>
 
 #include "util/logging.h"
+#include "util/ThreadBudget.h"
 #include "exec/IFunction.h"
 
 namespace onert
@@ -30,16 +32,25 @@ class HookFunction : public IFunction
 {
 public:
   HookFunction(IFunction *fn, const std::function<void()> &setup,
-               const std::function<void()> &teardown)
-      : _fn{fn}, _setup{setup}, _teardown{teardown}
+               const std::function<void()> &teardown, std::mutex *lock, uint32_t thread_limit)
+      : _fn{fn}, _setup{setup}, _teardown{teardown}, _lock{lock}, _thread_limit{thread_limit}
   {
   }
 
 public:
   void run() override
   {
+    util::ThreadLimitScope limit_scope{_thread_limit};
     _setup();
-    _fn->run();
+    if (_lock)
+    {
+      std::lock_guard<std::mutex> guard{*_lock};
+      _fn->run();
+    }
+    else
+    {
+      _fn->run();
+    }
     _teardown();
   }
   void runSync() override { throw("runSync is needed just for profiling in Dataflow executor"); }
@@ -48,98 +59,139 @@ private:
   IFunction *_fn;
   std::function<void()> _setup;
   std::function<void()> _teardown;
+  std::mutex *_lock;
+  uint32_t _thread_limit;
 };
 
 void ParallelExecutor::notify(uint32_t finished_job_id)
 {
-  std::unique_lock<std::mutex> lock{_mu_jobs};
+  // NOTE This is called on the worker thread which has just run the finished job. Jobs which become
+  //      ready are dispatched from here directly, without going through the caller's thread.
+  for (auto id : _output_info[finished_job_id])
+  {
+    assert(_num_pending_inputs[id].load() > 0);
+    if (_num_pending_inputs[id].fetch_sub(1) == 1) // No dependent jobs left, ready for execution
+    {
+      dispatch(id);
+    }
+  }
+
+  if (_num_remaining_jobs.fetch_sub(1) == 1)
+  {
+    std::lock_guard<std::mutex> lock{_mu_jobs};
+    _cv_jobs.notify_all();
+  }
+}
 
-  DataflowExecutor::notify(finished_job_id);
+void ParallelExecutor::dispatch(uint32_t job_index)
+{
+  VERBOSE(ParallelExecutor) << "Assigning fn #" << job_index << std::endl;
 
-  lock.unlock();
-  _cv_jobs.notify_all();
+  _scheduler->assign(_job_fns[job_index].get());
 }
 
 ParallelExecutor::ParallelExecutor(std::unique_ptr<ir::LoweredGraph> lowered_graph,
                                    const backend::TensorBuilderSet &tensor_builders,
-                                   compiler::CodeMap &&code_map)
-    : DataflowExecutor{std::move(lowered_graph), tensor_builders, std::move(code_map)}
+                                   compiler::CodeMap &&code_map, uint32_t max_threads)
+    : DataflowExecutor{std::move(lowered_graph), tensor_builders, std::move(code_map),
+                       max_threads}
 {
   VERBOSE(ParallelExecutor) << "Constructing Parallel Executor" << std::endl;
-}
 
-void ParallelExecutor::executeImpl()
-{
-  // Init scheduler
+  const auto num_jobs = static_cast<uint32_t>(_finished_jobs.size());
+
+  // Init scheduler once, so that worker threads are reused across executions
   // TODO Consider to have distinct backend set in LowerInfoMap
   ir::BackendSet backends;
   for (auto &itr : _lowered_graph->getLowerInfo()->op_seq)
   {
     backends.add(itr.second->backend());
   }
-  _scheduler = std::make_unique<ParallelScheduler>(backends);
+  // Workers are limited by the threads of this session as well as the budget of the process
+  const auto max_workers = _max_threads > 0
+                               ? std::min(_max_threads, util::ThreadBudget::get().maxThreads())
+                               : util::ThreadBudget::get().maxThreads();
+  _scheduler = std::make_unique<ParallelScheduler>(backends, num_jobs, max_workers);
+  // Kernels run on workers, which do not inherit the limit of the thread calling execute()
+  const auto thread_limit =
+      util::ThreadBudgetScope::threadLimitOf(_max_threads, _scheduler->numWorkers());
+
+  std::vector<int64_t> ranks(num_jobs);
+  for (uint32_t job_index = 0; job_index < num_jobs; ++job_index)
+  {
+    auto &job = _finished_jobs[job_index];
+    assert(job->index() == job_index);
 
-  assert(noWaitingJobs());
+    auto op_sequence_index = _job_to_op_seq[job_index];
+    auto op_seq = &_lowered_graph->op_seqs().at(op_sequence_index);
+    auto backend = _lowered_graph->getLowerInfo()->op_seq.at(op_sequence_index)->backend();
+    auto setup = [this, op_seq, backend]() {
+      if (_serialize_jobs)
+        _mu_observed_jobs.lock();
+      _subject.notifyJobBegin(this, op_seq, backend);
+    };
+    auto teardown = [this, job_index, op_seq, backend]() {
+      _subject.notifyJobEnd(this, op_seq, backend);
+      if (_serialize_jobs)
+        _mu_observed_jobs.unlock();
+      notify(job_index);
+    };
 
-  // Execution setup
-  _waiting_jobs.swap(_finished_jobs); // Move finished jobs to waiting jobs
+    _job_fns.emplace_back(std::make_unique<HookFunction>(
+        job->fn(), setup, teardown, _scheduler->exclusiveLock(backend), thread_limit));
+    ranks[job_index] = calculateRank(op_seq->operations());
 
-  for (uint32_t i = 0; i < _waiting_jobs.size(); ++i)
-  {
-    VERBOSE(ParallelExecutor) << i << ": " << _input_info[i] << std::endl;
-    if (_input_info[i] == 0)
+    if (_initial_input_info[job_index] == 0)
     {
-      emplaceToReadyJobs(i);
+      _initial_jobs.push_back(job_index);
     }
   }
-  assert(!_ready_jobs.empty()); // Cannot begin if there is no initial jobs
 
-  VERBOSE(ParallelExecutor) << "INITIAL JOBS : " << _ready_jobs.size() << std::endl;
+  // Initial jobs are injected to the scheduler in FIFO order, so higher rank goes first
+  std::stable_sort(_initial_jobs.begin(), _initial_jobs.end(),
+                   [&](uint32_t lhs, uint32_t rhs) { return ranks[lhs] > ranks[rhs]; });
 
-  _subject.notifyModelBegin(this);
-  while (true)
+  // Jobs dispatched from a worker are run in LIFO order by the worker itself, so higher rank goes
+  // last
+  for (auto &output_info : _output_info)
   {
-    std::unique_lock<std::mutex> lock{_mu_jobs};
+    output_info.sort([&](uint32_t lhs, uint32_t rhs) { return ranks[lhs] < ranks[rhs]; });
+  }
 
-    if (_ready_jobs.empty())
-    {
-      _cv_jobs.wait(lock, [this] { return !_ready_jobs.empty() || noWaitingJobs(); });
-      // Check finish condition
-      if (_ready_jobs.empty() && noWaitingJobs())
-      {
-        break;
-      }
-    }
+  _num_pending_inputs = std::make_unique<std::atomic<uint32_t>[]>(num_jobs);
+}
 
-    auto job = std::move(_ready_jobs.begin()->second);
-    _ready_jobs.erase(_ready_jobs.begin());
+void ParallelExecutor::executeImpl()
+{
+  assert(!_initial_jobs.empty()); // Cannot begin if there is no initial jobs
 
-    lock.unlock();
+  // Execution setup
+  const auto num_jobs = static_cast<uint32_t>(_finished_jobs.size());
+  for (uint32_t i = 0; i < num_jobs; ++i)
+  {
+    _num_pending_inputs[i].store(_initial_input_info[i]);
+  }
+  _num_remaining_jobs.store(num_jobs);
+  // Observers are added after construction, so this is checked for each execution. Workers see
+  // this since jobs are dispatched after it is set.
+  _serialize_jobs = !_subject.supportConcurrentJobs();
 
-    VERBOSE(ParallelExecutor) << "Assigning fn #" << job->index() << std::endl;
+  VERBOSE(ParallelExecutor) << "INITIAL JOBS : " << _initial_jobs.size() << std::endl;
 
-    auto job_index = job->index();
-    auto op_sequence_index = _job_to_op_seq[job_index];
-    auto op_seq = &_lowered_graph->op_seqs().at(op_sequence_index);
-    auto backend = _lowered_graph->getLowerInfo()->op_seq.at(op_sequence_index)->backend();
-    auto setup = [&, op_seq, backend]() { _subject.notifyJobBegin(this, op_seq, backend); };
-    auto teardown = [&, job_index, op_seq, backend]() {
-      _subject.notifyJobEnd(this, op_seq, backend);
-      notify(job_index);
-    };
+  _subject.notifyModelBegin(this);
 
-    _scheduler->assign(std::make_unique<HookFunction>(job->fn(), setup, teardown), backend);
-    _finished_jobs[job_index] = std::move(job);
+  for (auto job_index : _initial_jobs)
+  {
+    dispatch(job_index);
   }
 
-  assert(noWaitingJobs());
-
   // Wait for all the jobs done
-  _scheduler->finish();
-  _subject.notifyModelEnd(this);
+  {
+    std::unique_lock<std::mutex> lock{_mu_jobs};
+    _cv_jobs.wait(lock, [this] { return _num_remaining_jobs.load() == 0; });
+  }
 
-  // Reset input info for the next execution
-  _input_info = _initial_input_info;
+  _subject.notifyModelEnd(this);
 }
 
 } // namespace exec
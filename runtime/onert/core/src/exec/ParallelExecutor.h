@@ -17,8 +17,10 @@
 #ifndef __ONERT_EXEC_PARALLEL_EXECUTOR_H__
 #define __ONERT_EXEC_PARALLEL_EXECUTOR_H__
 
+#include <atomic>
+#include <condition_variable>
 #include <list>
-#include <queue>
+#include <mutex>
 #include <unordered_map>
 
 #include "exec/FunctionSequence.h"
@@ -49,15 +51,45 @@ public:
    * @param lowered_graph LoweredGraph object
    * @param tensor_builders Tensor builders that are currently used
    * @param code_map OpSequence and its code map
+   * @param max_threads Number of threads which workers and kernels may use in total, 0 for no
+   *                    limit
    */
   ParallelExecutor(std::unique_ptr<ir::LoweredGraph> lowered_graph,
-                   const backend::TensorBuilderSet &tensor_builders, compiler::CodeMap &&code_map);
+                   const backend::TensorBuilderSet &tensor_builders, compiler::CodeMap &&code_map,
+                   uint32_t max_threads);
 
   void executeImpl() override;
 
+  uint32_t numKernelThreads() const override { return _scheduler->numWorkers(); }
+
+private:
+  void dispatch(uint32_t job_index);
+
 private:
+  /**
+   * @brief Functions to be run for each job, wrapping the job with observer notification and
+   *        dispatching of its dependent jobs
+   */
+  std::vector<std::unique_ptr<IFunction>> _job_fns;
+  /**
+   * @brief Jobs without dependency, in descending order of rank
+   */
+  std::vector<uint32_t> _initial_jobs;
+  /**
+   * @brief Number of unfinished dependencies of each job for current execution
+   */
+  std::unique_ptr<std::atomic<uint32_t>[]> _num_pending_inputs;
+  std::atomic<uint32_t> _num_remaining_jobs{0};
   std::condition_variable _cv_jobs;
   std::mutex _mu_jobs;
+  /**
+   * @brief Lock held by a job from its begin to its end, for observers which cannot be notified
+   *        of jobs concurrently. It is used only if _serialize_jobs is set for current execution.
+   */
+  std::mutex _mu_observed_jobs;
+  bool _serialize_jobs{false};
+  // NOTE This must be declared last, so that worker threads are joined before the other members
+  //      are destroyed
   std::unique_ptr<ParallelScheduler> _scheduler;
 };
 
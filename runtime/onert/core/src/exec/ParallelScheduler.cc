@@ -16,9 +16,12 @@
 
 #include "ParallelScheduler.h"
 
+#include <algorithm>
 #include <cassert>
 
 #include <memory>
+#include "backend/Backend.h"
+#include "backend/IConfig.h"
 #include "util/logging.h"
 
 namespace onert
@@ -26,29 +29,33 @@ namespace onert
 namespace exec
 {
 
-ParallelScheduler::ParallelScheduler(const ir::BackendSet &backends)
+ParallelScheduler::ParallelScheduler(const ir::BackendSet &backends, uint32_t num_jobs,
+                                     uint32_t num_threads)
 {
   assert(!backends.empty());
 
   for (auto backend : backends)
   {
-    _thread_pools[backend] = std::make_unique<ThreadPool>();
+    // NOTE Kernels of some backends(e.g. the queue of acl_cl) are not reentrant
+    if (!backend->config()->supportConcurrentKernels())
+    {
+      _exclusive_locks[backend] = std::make_unique<std::mutex>();
+    }
   }
-}
 
-void ParallelScheduler::assign(std::unique_ptr<IFunction> &&fn, const backend::Backend *backend)
-{
-  assert(!_thread_pools.empty());
+  // No more workers than jobs since the rest would never have anything to run
+  _num_workers = std::max(1u, std::min(num_threads, num_jobs));
+  _thread_pool = std::make_unique<WorkStealingThreadPool>(_num_workers, num_jobs);
 
-  _thread_pools.at(backend)->enqueue(std::move(fn));
+  VERBOSE(ParallelScheduler) << "Worker threads : " << _num_workers << std::endl;
 }
 
-void ParallelScheduler::finish()
+void ParallelScheduler::assign(IFunction *fn) { _thread_pool->enqueue(fn); }
+
+std::mutex *ParallelScheduler::exclusiveLock(const backend::Backend *backend) const
 {
-  for (auto &itr : _thread_pools)
-  {
-    itr.second->finish();
-  }
+  auto itr = _exclusive_locks.find(backend);
+  return itr != _exclusive_locks.end() ? itr->second.get() : nullptr;
 }
 
 } // namespace exec
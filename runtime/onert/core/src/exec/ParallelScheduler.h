@@ -19,39 +19,55 @@
 
 #include <unordered_map>
 #include <memory>
+#include <mutex>
 
 #include "exec/IFunction.h"
 #include "ir/BackendSet.h"
-#include "ThreadPool.h"
+#include "WorkStealingThreadPool.h"
 
 namespace onert
 {
 namespace exec
 {
 
+/**
+ * @brief Class to run jobs of all backends on a work-stealing thread pool
+ *
+ * Workers are shared by backends. Jobs of a backend whose kernels cannot run concurrently are
+ * serialized by the lock of the backend instead of a dedicated thread.
+ */
 class ParallelScheduler
 {
 public:
   /**
    * @brief Constructs ParallelScheduler object
    *
-   * @param backends Backend set
+   * @param backends    Backend set
+   * @param num_jobs    Number of jobs that can be assigned at once
+   * @param num_threads Maximum number of worker threads
+   */
+  ParallelScheduler(const ir::BackendSet &backends, uint32_t num_jobs, uint32_t num_threads);
+  /**
+   * @brief Assign a task to the thread pool
+   *
+   * @param[in] fn Function to be assigned. It is not owned, and must outlive its execution
    */
-  ParallelScheduler(const ir::BackendSet &backends);
+  void assign(IFunction *fn);
   /**
-   * @brief Assign a task to the given backend
+   * @brief Get the lock which kernels of the given backend must hold while running
    *
-   * @param[in] fn Function to be assigned
-   * @param[in] fn Target backend
+   * @return Lock of the backend, or nullptr if its kernels can run concurrently
    */
-  void assign(std::unique_ptr<IFunction> &&fn, const backend::Backend *backend);
+  std::mutex *exclusiveLock(const backend::Backend *backend) const;
   /**
-   * @brief Block until all jobs are finished
+   * @brief Get the number of worker threads
    */
-  void finish();
+  uint32_t numWorkers() const { return _num_workers; }
 
 private:
-  std::unordered_map<const backend::Backend *, std::unique_ptr<ThreadPool>> _thread_pools;
+  std::unordered_map<const backend::Backend *, std::unique_ptr<std::mutex>> _exclusive_locks;
+  uint32_t _num_workers;
+  std::unique_ptr<WorkStealingThreadPool> _thread_pool;
 };
 
 } // namespace exec
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_WORK_STEALING_DEQUE_H__
+#define __ONERT_EXEC_WORK_STEALING_DEQUE_H__
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Bounded Chase-Lev work-stealing deque of pointers
+ *
+ * The owner thread pushes and pops at the bottom without taking any lock, while other threads
+ * steal from the top. The capacity is fixed at construction since the number of jobs of an
+ * executor is known in advance.
+ *
+ * @note  Based on "Correct and Efficient Work-Stealing for Weak Memory Models" (Le et al., 2013)
+ */
+template <typename T> class WorkStealingDeque
+{
+public:
+  /**
+   * @brief Construct a WorkStealingDeque object
+   *
+   * @param capacity Maximum number of elements. Rounded up to a power of two
+   */
+  WorkStealingDeque(uint32_t capacity)
+  {
+    uint32_t size = 1;
+    while (size < capacity)
+      size <<= 1;
+    _mask = size - 1;
+    _buffer = std::make_unique<std::atomic<T *>[]>(size);
+  }
+
+public:
+  /**
+   * @brief Push an element at the bottom. Only the owner thread may call this
+   *
+   * @return false if the deque is full, otherwise true
+   */
+  bool push(T *elem)
+  {
+    const int64_t b = _bottom.load(std::memory_order_relaxed);
+    const int64_t t = _top.load(std::memory_order_acquire);
+    if (b - t > static_cast<int64_t>(_mask))
+      return false;
+
+    _buffer[b & _mask].store(elem, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    _bottom.store(b + 1, std::memory_order_relaxed);
+    return true;
+  }
+
+  /**
+   * @brief Pop an element from the bottom. Only the owner thread may call this
+   *
+   * @return Popped element, or nullptr if the deque is empty
+   */
+  T *pop()
+  {
+    const int64_t b = _bottom.load(std::memory_order_relaxed) - 1;
+    _bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = _top.load(std::memory_order_relaxed);
+
+    if (t > b)
+    {
+      // Empty
+      _bottom.store(b + 1, std::memory_order_relaxed);
+      return nullptr;
+    }
+
+    T *elem = _buffer[b & _mask].load(std::memory_order_relaxed);
+    if (t == b)
+    {
+      // The last element, race against thieves
+      if (!_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                        std::memory_order_relaxed))
+      {
+        elem = nullptr;
+      }
+      _bottom.store(b + 1, std::memory_order_relaxed);
+    }
+    return elem;
+  }
+
+  /**
+   * @brief Steal an element from the top. Any thread may call this
+   *
+   * @return Stolen element, or nullptr if the deque is empty or another thread won the race
+   */
+  T *steal()
+  {
+    int64_t t = _top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const int64_t b = _bottom.load(std::memory_order_acquire);
+
+    if (t >= b)
+      return nullptr;
+
+    T *elem = _buffer[t & _mask].load(std::memory_order_relaxed);
+    if (!_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed))
+    {
+      return nullptr;
+    }
+    return elem;
+  }
+
+private:
+  std::atomic<int64_t> _top{0};
+  std::atomic<int64_t> _bottom{0};
+  uint64_t _mask;
+  std::unique_ptr<std::atomic<T *>[]> _buffer;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_WORK_STEALING_DEQUE_H__
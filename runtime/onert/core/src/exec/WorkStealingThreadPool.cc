@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "WorkStealingThreadPool.h"
+
+#include <cassert>
+
+namespace onert
+{
+namespace exec
+{
+
+namespace
+{
+
+// Pool and worker id of the current thread, to find the deque owned by the caller
+thread_local const WorkStealingThreadPool *current_pool = nullptr;
+thread_local uint32_t current_worker_id = 0;
+
+} // namespace
+
+WorkStealingThreadPool::WorkStealingThreadPool(uint32_t num_threads, uint32_t capacity)
+{
+  assert(num_threads >= 1);
+
+  for (uint32_t i = 0; i < num_threads; i++)
+  {
+    _deques.emplace_back(std::make_unique<WorkStealingDeque<IFunction>>(capacity));
+  }
+  for (uint32_t i = 0; i < num_threads; i++)
+  {
+    _threads.emplace_back(&WorkStealingThreadPool::work, this, i);
+  }
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+  {
+    std::unique_lock<std::mutex> lock{_mu};
+    _terminated = true;
+  }
+  _cv.notify_all();
+
+  for (auto &thread : _threads)
+  {
+    thread.join();
+  }
+}
+
+void WorkStealingThreadPool::enqueue(IFunction *fn)
+{
+  assert(fn != nullptr);
+
+  if (current_pool != this || !_deques[current_worker_id]->push(fn))
+  {
+    std::lock_guard<std::mutex> lock{_mu_injected};
+    _injected.push(fn);
+  }
+  _num_queued.fetch_add(1);
+
+  // Wake up a sleeping worker, if any, so it can run or steal the function
+  if (_num_sleeping.load() > 0)
+  {
+    {
+      std::lock_guard<std::mutex> lock{_mu};
+    }
+    _cv.notify_one();
+  }
+}
+
+IFunction *WorkStealingThreadPool::take(uint32_t worker_id)
+{
+  // 1. Own deque
+  if (auto fn = _deques[worker_id]->pop())
+    return fn;
+
+  // 2. Injection queue
+  {
+    std::lock_guard<std::mutex> lock{_mu_injected};
+    if (!_injected.empty())
+    {
+      auto fn = _injected.front();
+      _injected.pop();
+      return fn;
+    }
+  }
+
+  // 3. Steal from the other workers
+  const auto num_workers = static_cast<uint32_t>(_deques.size());
+  for (uint32_t i = 1; i < num_workers; i++)
+  {
+    if (auto fn = _deques[(worker_id + i) % num_workers]->steal())
+      return fn;
+  }
+
+  return nullptr;
+}
+
+void WorkStealingThreadPool::work(uint32_t worker_id)
+{
+  current_pool = this;
+  current_worker_id = worker_id;
+
+  while (true)
+  {
+    if (auto fn = take(worker_id))
+    {
+      _num_queued.fetch_sub(1);
+      fn->run();
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock{_mu};
+    _num_sleeping.fetch_add(1);
+    _cv.wait(lock, [this] { return _terminated || _num_queued.load() > 0; });
+    _num_sleeping.fetch_sub(1);
+
+    if (_terminated && _num_queued.load() <= 0)
+    {
+      return;
+    }
+  }
+}
+
+} // namespace exec
+} // namespace onert
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_WORK_STEALING_THREAD_POOL_H__
+#define __ONERT_EXEC_WORK_STEALING_THREAD_POOL_H__
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include "exec/IFunction.h"
+#include "WorkStealingDeque.h"
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Thread pool where each worker owns a work-stealing deque
+ *
+ * Functions enqueued from a worker of this pool are pushed to the worker's own deque without
+ * locking, and idle workers steal from the others. Functions enqueued from any other thread go
+ * through a shared injection queue.
+ *
+ * @note  The pool does not own the functions. They must outlive their execution.
+ */
+class WorkStealingThreadPool
+{
+public:
+  /**
+   * @brief Construct WorkStealingThreadPool object
+   *
+   * @param num_threads Number of threads
+   * @param capacity    Maximum number of functions that can be pending in a worker's deque
+   */
+  WorkStealingThreadPool(uint32_t num_threads, uint32_t capacity);
+  /**
+   * @brief Destroy WorkStealingThreadPool object. Pending functions are run before threads join
+   */
+  ~WorkStealingThreadPool();
+
+public:
+  /**
+   * @brief Enqueue a function
+   *
+   * @param fn A function to be run
+   */
+  void enqueue(IFunction *fn);
+
+private:
+  void work(uint32_t worker_id);
+  IFunction *take(uint32_t worker_id);
+
+private:
+  std::vector<std::unique_ptr<WorkStealingDeque<IFunction>>> _deques;
+  std::queue<IFunction *> _injected;
+  std::mutex _mu_injected;
+  std::atomic<int32_t> _num_queued{0};
+  std::atomic<uint32_t> _num_sleeping{0};
+  bool _terminated{false};
+  std::mutex _mu;
+  std::condition_variable _cv;
+  std::vector<std::thread> _threads;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_WORK_STEALING_THREAD_POOL_H__
@@ -23,6 +23,7 @@
 
 #include <cker/Shape.h>
 #include <cker/Types.h>
+#include <stdexcept>
 
 namespace onert
 {
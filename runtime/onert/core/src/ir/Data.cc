@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ir/Data.h"
+
+#include <stdexcept>
+
+#include <sys/mman.h>
+
+namespace onert
+{
+namespace ir
+{
+
+MMapedData::MMapedData(int fd, std::ptrdiff_t mmap_offset, size_t mmap_size,
+                       std::ptrdiff_t data_offset, size_t data_size)
+    : _mmap_base{nullptr}, _mmap_size{mmap_size}, _offset{data_offset - mmap_offset},
+      _size{data_size}
+{
+  void *base = mmap(NULL, _mmap_size, PROT_READ, MAP_PRIVATE, fd, mmap_offset);
+  if (base == MAP_FAILED)
+    throw std::runtime_error("Failed to map model data");
+  _mmap_base = static_cast<uint8_t *>(base);
+}
+
+MMapedData::~MMapedData() { munmap(_mmap_base, _mmap_size); }
+
+} // namespace ir
+} // namespace onert
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ir/PreparedDataCache.h"
+
+#include <cassert>
+
+namespace onert
+{
+namespace ir
+{
+
+std::shared_ptr<const void> PreparedDataCache::get(const OperandIndex &index,
+                                                   const std::shared_ptr<const Data> &data,
+                                                   const Prepare &prepare)
+{
+  assert(data != nullptr);
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  auto it = _entries.find(index);
+  if (it != _entries.end() && it->second.data.lock() == data)
+  {
+    return it->second.prepared;
+  }
+
+  auto prepared = prepare();
+  _entries[index] = Entry{data, prepared};
+  return prepared;
+}
+
+} // namespace ir
+} // namespace onert
@@ -38,6 +38,12 @@ bool operator==(const TypeInfo &lhs, const TypeInfo &rhs)
     return false;
   }
 
+  if (lhs.scales() != rhs.scales() || lhs.offsets() != rhs.offsets() ||
+      lhs.channelDim() != rhs.channelDim())
+  {
+    return false;
+  }
+
   return true;
 }
 
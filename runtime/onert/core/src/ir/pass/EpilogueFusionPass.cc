@@ -0,0 +1,327 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "EpilogueFusionPass.h"
+
+#include "ir/Graph.h"
+#include "ir/operation/Add.h"
+#include "ir/operation/AvgPool2D.h"
+#include "ir/operation/Conv2D.h"
+#include "ir/operation/DepthwiseConv2D.h"
+#include "ir/operation/Div.h"
+#include "ir/operation/FullyConnected.h"
+#include "ir/operation/MaxPool2D.h"
+#include "ir/operation/Mul.h"
+#include "ir/operation/Sub.h"
+#include "util/logging.h"
+
+#include <vector>
+
+namespace onert
+{
+namespace ir
+{
+namespace pass
+{
+
+namespace
+{
+
+template <typename Op> const Activation *activationOf(const Operation &op)
+{
+  return &static_cast<const Op &>(op).param().activation;
+}
+
+template <typename Op>
+std::unique_ptr<Operation> cloneWith(const Operation &op, Activation activation,
+                                     const OperandIndex &output)
+{
+  const auto &typed = static_cast<const Op &>(op);
+  auto param = typed.param();
+  param.activation = activation;
+  return std::make_unique<Op>(typed.getInputs(), OperandIndexSequence{output}, param);
+}
+
+// Fused activation of an operation, or nullptr if the operation does not have one
+const Activation *fusedActivation(const Operation &op)
+{
+  switch (op.opcode())
+  {
+    case OpCode::Conv2D:
+      return activationOf<operation::Conv2D>(op);
+    case OpCode::DepthwiseConv2D:
+      return activationOf<operation::DepthwiseConv2D>(op);
+    case OpCode::FullyConnected:
+      return activationOf<operation::FullyConnected>(op);
+    case OpCode::Add:
+      return activationOf<operation::Add>(op);
+    case OpCode::Sub:
+      return activationOf<operation::Sub>(op);
+    case OpCode::Mul:
+      return activationOf<operation::Mul>(op);
+    case OpCode::Div:
+      return activationOf<operation::Div>(op);
+    case OpCode::AvgPool2D:
+      return activationOf<operation::AvgPool2D>(op);
+    case OpCode::MaxPool2D:
+      return activationOf<operation::MaxPool2D>(op);
+    default:
+      return nullptr;
+  }
+}
+
+// Clone of an operation which has fused activation, with the activation and output replaced
+std::unique_ptr<Operation> cloneWithFusedActivation(const Operation &op, Activation activation,
+                                                    const OperandIndex &output)
+{
+  switch (op.opcode())
+  {
+    case OpCode::Conv2D:
+      return cloneWith<operation::Conv2D>(op, activation, output);
+    case OpCode::DepthwiseConv2D:
+      return cloneWith<operation::DepthwiseConv2D>(op, activation, output);
+    case OpCode::FullyConnected:
+      return cloneWith<operation::FullyConnected>(op, activation, output);
+    case OpCode::Add:
+      return cloneWith<operation::Add>(op, activation, output);
+    case OpCode::Sub:
+      return cloneWith<operation::Sub>(op, activation, output);
+    case OpCode::Mul:
+      return cloneWith<operation::Mul>(op, activation, output);
+    case OpCode::Div:
+      return cloneWith<operation::Div>(op, activation, output);
+    case OpCode::AvgPool2D:
+      return cloneWith<operation::AvgPool2D>(op, activation, output);
+    case OpCode::MaxPool2D:
+      return cloneWith<operation::MaxPool2D>(op, activation, output);
+    default:
+      throw std::runtime_error{"EpilogueFusionPass: Operation without fused activation"};
+  }
+}
+
+bool isFloatConstant(const Operand &operand)
+{
+  return operand.isConstant() && operand.typeInfo().type() == DataType::FLOAT32;
+}
+
+std::vector<float> floatsOf(const Operand &operand)
+{
+  const auto *base = reinterpret_cast<const float *>(operand.data()->base());
+  return std::vector<float>(base, base + operand.shape().num_elements());
+}
+
+void setFloats(Operand &operand, const std::vector<float> &values)
+{
+  operand.data(std::make_shared<CachedData>(reinterpret_cast<const uint8_t *>(values.data()),
+                                            values.size() * sizeof(float)));
+}
+
+} // namespace
+
+void EpilogueFusionPass::run()
+{
+  // A fusion may make another one possible, like Add and ReLU after Conv2D
+  bool fused = true;
+  while (fused)
+  {
+    fused = false;
+    std::vector<OperationIndex> indices;
+    _graph.operations().iterate(
+        [&](const OperationIndex &index, const Operation &) { indices.emplace_back(index); });
+    for (const auto &index : indices)
+    {
+      if (_graph.operations().exist(index) && tryFuse(index))
+      {
+        fused = true;
+      }
+    }
+  }
+
+  VERBOSE(EpilogueFusionPass) << "Fused " << _num_fused << " operations, which saves writing and "
+                              << "reading " << _saved_bytes << " bytes of intermediate tensors"
+                              << std::endl;
+}
+
+bool EpilogueFusionPass::tryFuse(const OperationIndex &index)
+{
+  auto &operations = _graph.operations();
+  auto &operands = _graph.operands();
+  const auto &consumer = operations.at(index);
+
+  // Input to be fused with its producer, activation after fusion, and the constant to be folded
+  OperandIndex fused_input;
+  Activation activation = Activation::NONE;
+  OperandIndex constant;
+  switch (consumer.opcode())
+  {
+    case OpCode::ReLU:
+      activation = Activation::RELU;
+      break;
+    case OpCode::ReLU1:
+      activation = Activation::RELU1;
+      break;
+    case OpCode::ReLU6:
+      activation = Activation::RELU6;
+      break;
+    case OpCode::Add:
+    case OpCode::Sub:
+    case OpCode::Mul:
+    {
+      const auto lhs = consumer.getInputs().at(0);
+      const auto rhs = consumer.getInputs().at(1);
+      // Only (x - constant) is a bias of x
+      const bool rhs_const = operands.at(rhs).isConstant();
+      const bool lhs_const = operands.at(lhs).isConstant() && consumer.opcode() != OpCode::Sub;
+      if (rhs_const == lhs_const)
+        return false;
+      fused_input = rhs_const ? lhs : rhs;
+      constant = rhs_const ? rhs : lhs;
+      activation = *fusedActivation(consumer);
+      break;
+    }
+    default:
+      return false;
+  }
+  if (fused_input.undefined())
+  {
+    fused_input = consumer.getInputs().at(0);
+  }
+
+  const auto &intermediate = operands.at(fused_input);
+  if (intermediate.getDef().size() != 1 || intermediate.getUses().size() != 1 ||
+      _graph.getInputs().contains(fused_input) || _graph.getOutputs().contains(fused_input))
+  {
+    return false;
+  }
+  const auto producer_index = *intermediate.getDef().begin();
+  const auto &producer = operations.at(producer_index);
+  const auto *producer_activation = fusedActivation(producer);
+  if (producer_activation == nullptr || *producer_activation != Activation::NONE)
+  {
+    return false;
+  }
+  if (!constant.undefined() && !foldIntoWeights(producer, consumer, constant))
+  {
+    return false;
+  }
+
+  VERBOSE(EpilogueFusionPass) << "Fuse " << consumer.name() << "(#" << index.value() << ") into "
+                              << producer.name() << "(#" << producer_index.value() << ")"
+                              << std::endl;
+
+  const auto output = consumer.getOutputs().at(0);
+  const size_t intermediate_size = intermediate.operandSize();
+  operations.set(producer_index, cloneWithFusedActivation(producer, activation, output));
+
+  auto &output_operand = operands.at(output);
+  output_operand.removeDef(index);
+  output_operand.insertDef(producer_index);
+  if (!constant.undefined())
+  {
+    auto &constant_operand = operands.at(constant);
+    constant_operand.removeUse(index);
+    if (constant_operand.getUses().size() == 0)
+    {
+      _graph.removeOperand(constant);
+    }
+  }
+  _graph.removeOperand(fused_input);
+  operations.remove(index);
+
+  ++_num_fused;
+  _saved_bytes += intermediate_size;
+  return true;
+}
+
+bool EpilogueFusionPass::foldIntoWeights(const Operation &producer, const Operation &consumer,
+                                         const OperandIndex &constant_index)
+{
+  // Kernel and bias are the second and the third inputs of these operations
+  const auto opcode = producer.opcode();
+  if (opcode != OpCode::Conv2D && opcode != OpCode::DepthwiseConv2D &&
+      opcode != OpCode::FullyConnected)
+  {
+    return false;
+  }
+  // Output channels are the last dimension of feature maps in NHWC
+  if (opcode != OpCode::FullyConnected && _graph.layout() != Layout::NHWC)
+  {
+    return false;
+  }
+  const auto kernel_index = producer.getInputs().at(1);
+  const auto bias_index = producer.getInputs().at(2);
+  if (bias_index.undefined())
+  {
+    return false;
+  }
+
+  auto &operands = _graph.operands();
+  auto &kernel = operands.at(kernel_index);
+  auto &bias = operands.at(bias_index);
+  const auto &constant = operands.at(constant_index);
+  if (!isFloatConstant(kernel) || !isFloatConstant(bias) || !isFloatConstant(constant) ||
+      kernel.getUses().size() != 1 || bias.getUses().size() != 1 || kernel_index == bias_index)
+  {
+    return false;
+  }
+
+  // The constant must be broadcast along output channels only
+  const auto num_channels = bias.shape().num_elements();
+  const auto &constant_shape = constant.shape();
+  if (constant_shape.rank() == 0 || constant_shape.num_elements() != num_channels ||
+      static_cast<uint64_t>(constant_shape.dim(constant_shape.rank() - 1)) != num_channels)
+  {
+    return false;
+  }
+
+  auto bias_values = floatsOf(bias);
+  const auto values = floatsOf(constant);
+  for (uint64_t c = 0; c < num_channels; ++c)
+  {
+    switch (consumer.opcode())
+    {
+      case OpCode::Add:
+        bias_values[c] += values[c];
+        break;
+      case OpCode::Sub:
+        bias_values[c] -= values[c];
+        break;
+      default:
+        assert(consumer.opcode() == OpCode::Mul);
+        bias_values[c] *= values[c];
+        break;
+    }
+  }
+
+  if (consumer.opcode() == OpCode::Mul)
+  {
+    // Kernel of DepthwiseConv2D is [1, H, W, C] and the others' are [C, ...]
+    auto kernel_values = floatsOf(kernel);
+    const size_t inner_size = kernel_values.size() / num_channels;
+    for (size_t i = 0; i < kernel_values.size(); ++i)
+    {
+      const size_t c = (opcode == OpCode::DepthwiseConv2D) ? i % num_channels : i / inner_size;
+      kernel_values[i] *= values[c];
+    }
+    setFloats(kernel, kernel_values);
+  }
+  setFloats(bias, bias_values);
+  return true;
+}
+
+} // namespace pass
+} // namespace ir
+} // namespace onert
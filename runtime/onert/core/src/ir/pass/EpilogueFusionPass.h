@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_GRAPH_PASS_EPILOGUE_FUSION_PASS_H__
+#define __ONERT_GRAPH_PASS_EPILOGUE_FUSION_PASS_H__
+
+#include "Pass.h"
+#include "ir/Index.h"
+
+#include <cstddef>
+
+namespace onert
+{
+namespace ir
+{
+class Operation;
+} // namespace ir
+} // namespace onert
+
+namespace onert
+{
+namespace ir
+{
+namespace pass
+{
+
+/**
+ * @brief Pass to fuse an elementwise epilogue into the operation which produces its input, so
+ *        that the intermediate tensor is neither written nor read
+ *
+ * Following operations are fused when the intermediate tensor has no other use
+ * - ReLU, ReLU1 and ReLU6 into the fused activation of Conv2D, DepthwiseConv2D, FullyConnected,
+ *   Add, Sub, Mul, Div, AvgPool2D and MaxPool2D
+ * - Float Add, Sub and Mul with a per-channel constant into constant kernel and bias of Conv2D,
+ *   DepthwiseConv2D and FullyConnected, together with the fused activation of the Add, Sub or Mul
+ *
+ * The fused operation keeps its index and takes the output of the removed one.
+ */
+class EpilogueFusionPass : public Pass
+{
+public:
+  using Pass::Pass;
+
+public:
+  std::string id() final { return "EpilogueFusionPass"; }
+
+  void run() final;
+
+  uint32_t numFused() const { return _num_fused; }
+  size_t savedBytes() const { return _saved_bytes; }
+
+private:
+  bool tryFuse(const OperationIndex &index);
+  bool foldIntoWeights(const Operation &producer, const Operation &consumer,
+                       const OperandIndex &constant_index);
+
+private:
+  uint32_t _num_fused = 0;
+  size_t _saved_bytes = 0;
+};
+
+} // namespace pass
+} // namespace ir
+} // namespace onert
+
+#endif // __ONERT_GRAPH_PASS_EPILOGUE_FUSION_PASS_H__
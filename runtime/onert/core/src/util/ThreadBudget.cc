@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/ThreadBudget.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace onert
+{
+namespace util
+{
+
+namespace
+{
+
+uint32_t numHardwareThreads()
+{
+  // hardware_concurrency() may return 0 when it is not computable
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// Limit of the session whose kernels run on this thread
+thread_local uint32_t thread_limit = 0;
+
+} // namespace
+
+ThreadBudget &ThreadBudget::get()
+{
+  static ThreadBudget instance;
+  return instance;
+}
+
+ThreadBudget::ThreadBudget() : _max_threads{numHardwareThreads()}, _num_kernel_threads{0}
+{
+  // DO NOTHING
+}
+
+uint32_t ThreadBudget::threadsPerKernel() const
+{
+  const uint32_t num_kernel_threads = std::max(1u, _num_kernel_threads.load());
+  const uint32_t share = std::max(1u, _max_threads / num_kernel_threads);
+  return thread_limit > 0 ? std::min(share, thread_limit) : share;
+}
+
+void ThreadBudget::setThreadLimit(uint32_t num_threads) { thread_limit = num_threads; }
+
+uint32_t ThreadBudget::threadLimit() const { return thread_limit; }
+
+} // namespace util
+} // namespace onert
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/TraceRingBuffer.h"
+
+#include <cassert>
+
+namespace onert
+{
+namespace util
+{
+
+namespace
+{
+
+uint32_t roundUpToPowerOf2(uint32_t value)
+{
+  uint32_t ret = 1;
+  while (ret < value && ret < TraceRingBuffer::max_capacity)
+    ret <<= 1;
+  return ret;
+}
+
+uint64_t nextUid()
+{
+  static std::atomic<uint64_t> uid{1};
+  return uid++;
+}
+
+} // namespace
+
+TraceRingBuffer::TraceRingBuffer(uint32_t capacity)
+    : _uid{nextUid()}, _capacity{roundUpToPowerOf2(capacity)}
+{
+}
+
+TraceRingBuffer::~TraceRingBuffer() = default;
+
+constexpr uint32_t TraceRingBuffer::max_capacity;
+
+std::vector<TraceEvent> TraceRingBuffer::Ring::events() const
+{
+  const auto head = _head.load(std::memory_order_acquire);
+  const auto capacity = _mask + 1;
+  const auto begin = head > capacity ? head - capacity : 0;
+
+  std::vector<TraceEvent> ret;
+  ret.reserve(head - begin);
+  for (auto i = begin; i < head; ++i)
+  {
+    ret.emplace_back(_events[i & _mask]);
+  }
+  return ret;
+}
+
+TraceRingBuffer::Ring &TraceRingBuffer::ring()
+{
+  // Threads usually record to one or a few buffers (e.g. executors of nested subgraphs), so a
+  // small direct-mapped cache avoids the lock in most cases
+  struct CacheEntry
+  {
+    uint64_t uid;
+    Ring *ring;
+  };
+  static constexpr uint32_t kCacheSize = 4;
+  static thread_local CacheEntry cache[kCacheSize] = {};
+
+  auto &entry = cache[_uid % kCacheSize];
+  if (entry.uid != _uid)
+  {
+    entry.ring = &registerThread();
+    entry.uid = _uid;
+  }
+  assert(entry.ring != nullptr);
+  return *entry.ring;
+}
+
+TraceRingBuffer::Ring &TraceRingBuffer::registerThread()
+{
+  std::lock_guard<std::mutex> lock{_mu};
+
+  auto &ring = _rings[std::this_thread::get_id()];
+  if (ring == nullptr)
+  {
+    ring = std::make_unique<Ring>(_capacity);
+  }
+  return *ring;
+}
+
+std::vector<std::vector<TraceEvent>> TraceRingBuffer::collect() const
+{
+  std::lock_guard<std::mutex> lock{_mu};
+
+  std::vector<std::vector<TraceEvent>> ret;
+  for (const auto &pair : _rings)
+  {
+    ret.emplace_back(pair.second->events());
+  }
+  return ret;
+}
+
+std::vector<TraceEvent> pairedEvents(const std::vector<TraceEvent> &events)
+{
+  std::vector<bool> paired(events.size(), false);
+  std::vector<size_t> open; // Indices of BEGIN events not ended yet
+  for (size_t i = 0; i < events.size(); ++i)
+  {
+    if (events[i].phase == TraceEvent::Phase::BEGIN)
+    {
+      open.push_back(i);
+    }
+    else if (!open.empty() && events[open.back()].id == events[i].id)
+    {
+      paired[open.back()] = true;
+      paired[i] = true;
+      open.pop_back();
+    }
+  }
+
+  std::vector<TraceEvent> ret;
+  for (size_t i = 0; i < events.size(); ++i)
+  {
+    if (paired[i])
+      ret.emplace_back(events[i]);
+  }
+  return ret;
+}
+
+} // namespace util
+} // namespace onert
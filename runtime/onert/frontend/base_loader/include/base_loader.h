@@ -23,10 +23,14 @@
 
 #include "flatbuffers/flexbuffers.h"
 
+#include <cstddef>
 #include <map>
 #include <memory>
-#include <fstream>
 #include <limits>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 namespace onert
 {
@@ -56,7 +60,11 @@ public:
    *
    * @param graph reference on subgraphs
    */
-  explicit BaseLoader(std::unique_ptr<ir::Subgraphs> &subgs) : _subgraphs(subgs), _model{nullptr} {}
+  explicit BaseLoader(std::unique_ptr<ir::Subgraphs> &subgs)
+      : _base{nullptr}, _size(0), _fd(-1), _subgraphs(subgs), _model{nullptr}
+  {
+    _pagesize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  }
 
   /**
    * @brief Load a model from file
@@ -66,7 +74,13 @@ public:
   void loadFromFile(const char *file_path);
 
 protected:
-  ~BaseLoader() = default;
+  ~BaseLoader()
+  {
+    if (_base != nullptr)
+      munmap(_base, _size);
+    if (_fd != -1)
+      close(_fd);
+  }
 
   void loadModel();
 
@@ -157,8 +171,14 @@ protected:
   void loadRange(const Operator *op, ir::Graph &subg);
 
 protected:
-  // Buffer for loading (if needed)
-  std::vector<char> _buffer;
+  // Base address of the mapped model file
+  uint8_t *_base;
+  // Size of the mapped model file
+  size_t _size;
+  // File descriptor of the model file, kept open to map constant data
+  int _fd;
+  // Page size for aligning mapping offsets
+  size_t _pagesize;
   // Reference on loadable subgraphs
   std::unique_ptr<ir::Subgraphs> &_subgraphs;
   const Model *_model;
@@ -171,9 +191,8 @@ protected:
 template <typename LoaderDomain, typename SpecificLoader>
 void BaseLoader<LoaderDomain, SpecificLoader>::BaseLoader::loadFromFile(const char *file_path)
 {
-  std::ifstream stream(file_path, std::fstream::in | std::fstream::binary);
-
-  if (!stream)
+  _fd = open(file_path, O_RDONLY);
+  if (_fd < 0)
   {
     std::string msg = "Failed to open file `";
     msg += file_path;
@@ -181,18 +200,20 @@ void BaseLoader<LoaderDomain, SpecificLoader>::BaseLoader::loadFromFile(const ch
     throw std::runtime_error{msg};
   }
 
-  stream.seekg(0, stream.end);
-  auto size = stream.tellg();
-  stream.seekg(0, stream.beg);
+  struct stat file_stat;
+  if (fstat(_fd, &file_stat) != 0)
+    throw std::runtime_error("Failed to get file size");
+  _size = file_stat.st_size;
 
-  _buffer.resize(size);
-  stream.read(_buffer.data(), size);
-
-  stream.close();
+  // Map the file instead of reading it, so that only the pages which are actually accessed are
+  // loaded and constant data can be shared with backends without copying
+  void *base = mmap(NULL, _size, PROT_READ, MAP_PRIVATE, _fd, 0);
+  if (base == MAP_FAILED)
+    throw std::runtime_error("Failed to map file");
+  _base = static_cast<uint8_t *>(base);
 
   // Prepare verifier
-  _verifier = std::make_unique<Verifier>(reinterpret_cast<const std::uint8_t *>(_buffer.data()),
-                                         _buffer.size());
+  _verifier = std::make_unique<Verifier>(_base, _size);
 
   loadModel();
 }
@@ -233,6 +254,8 @@ BaseLoader<LoaderDomain, SpecificLoader>::BaseLoader::tensorTypeToDataType(const
       return ir::DataType::BOOL8;
     case TensorType::TensorType_UINT8:
       return ir::DataType::QUANT_UINT8_ASYMM;
+    case TensorType::TensorType_INT8:
+      return ir::DataType::QUANT_INT8_ASYMM;
     default:
       throw std::runtime_error(
           std::string("Unsupported tensor type: ").append(EnumNameTensorType(type)));
@@ -276,36 +299,51 @@ ir::OperandIndex BaseLoader<LoaderDomain, SpecificLoader>::loadOperand(const Ten
   ir::DataType data_type = tensorTypeToDataType(tensor->type());
   // Quantization
   auto q_params = tensor->quantization();
-  float scale = 0.0;
-  long zero_point = 0;
+  std::vector<float> scales;
+  std::vector<int32_t> zero_points;
   if (q_params != nullptr)
   {
     if (q_params->scale())
     {
-      if (q_params->scale()->size() != 1)
-      {
-        throw std::runtime_error("Only 1 scale for a tensor is supported.");
-      }
-      scale = q_params->scale()->Get(0);
+      scales.assign(q_params->scale()->begin(), q_params->scale()->end());
     }
 
     if (q_params->zero_point())
     {
-      if (q_params->zero_point()->size() != 1)
+      for (const auto zero_point : *q_params->zero_point())
       {
-        throw std::runtime_error("Only 1 zero_point value for a tensor is supported.");
+        // zero_point is long while TypeInfo.zero_point is defined as int32_t.
+        assert(zero_point >= std::numeric_limits<int32_t>::min());
+        assert(zero_point <= std::numeric_limits<int32_t>::max());
+        zero_points.push_back(static_cast<int32_t>(zero_point));
       }
-      zero_point = q_params->zero_point()->Get(0);
-      // zero_point is long while TypeInfo.zero_point is defined as int32_t.
-      assert(zero_point >= std::numeric_limits<int32_t>::min());
-      assert(zero_point <= std::numeric_limits<int32_t>::max());
+    }
+
+    // Weights and biases of int8 kernels may be quantized per channel
+    if (scales.size() > 1 && data_type != ir::DataType::QUANT_INT8_ASYMM &&
+        data_type != ir::DataType::INT32)
+    {
+      throw std::runtime_error("Only int8 weights and int32 biases can be quantized per channel.");
+    }
+    if (zero_points.size() > 1 && zero_points.size() != scales.size())
+    {
+      throw std::runtime_error("The numbers of scales and zero_points do not match.");
     }
     auto details = q_params->details_as_CustomQuantization();
     if (details != nullptr)
       throw std::runtime_error("Custom Quantization is not supported");
   }
   // Create TypeInfo
-  ir::TypeInfo type_info(data_type, scale, zero_point);
+  if (scales.size() > 1)
+  {
+    // Some converters emit only one zero_point for all channels
+    zero_points.resize(scales.size(), zero_points.empty() ? 0 : zero_points[0]);
+  }
+  ir::TypeInfo type_info =
+      scales.size() > 1
+          ? ir::TypeInfo(data_type, scales, zero_points, q_params->quantized_dimension())
+          : ir::TypeInfo(data_type, scales.empty() ? 0.0f : scales[0],
+                         zero_points.empty() ? 0 : zero_points[0]);
   // Create operand
   const auto operand_index = subg.addOperand(shape, type_info);
 
@@ -313,7 +351,23 @@ ir::OperandIndex BaseLoader<LoaderDomain, SpecificLoader>::loadOperand(const Ten
   const auto *data = _model->buffers()->Get(tensor->buffer())->data();
   if (data != nullptr)
   {
-    auto ptr = std::make_unique<ir::CachedData>(data->data(), data->size());
+    std::unique_ptr<ir::Data> ptr;
+    // Map the data of its own if it is larger than a page. Otherwise, copying it costs less.
+    // Kernels may load constants with aligned instructions, so data less aligned than an
+    // allocated buffer is copied as well.
+    const std::ptrdiff_t data_offset = data->data() - _base;
+    if (data->size() >= _pagesize && data_offset % alignof(std::max_align_t) == 0)
+    {
+      const auto pagesize = static_cast<std::ptrdiff_t>(_pagesize);
+      const std::ptrdiff_t mmap_offset = (data_offset / pagesize) * pagesize;
+      const size_t mmap_size = data->size() + (data_offset - mmap_offset);
+      ptr = std::make_unique<ir::MMapedData>(_fd, mmap_offset, mmap_size, data_offset,
+                                             data->size());
+    }
+    else
+    {
+      ptr = std::make_unique<ir::CachedData>(data->data(), data->size());
+    }
     subg.setOperandValue(operand_index, std::move(ptr));
   }
 
@@ -565,7 +619,8 @@ void BaseLoader<LoaderDomain, SpecificLoader>::loadFC(const Operator *op, ir::Gr
   const auto &input_operand = subg.operands().at(inputs.at(ir::operation::FullyConnected::INPUT));
   auto &weights_operand = subg.operands().at(inputs.at(ir::operation::FullyConnected::WEIGHT));
   if (input_operand.typeInfo().type() == ir::DataType::FLOAT32 &&
-      weights_operand.typeInfo().type() == ir::DataType::QUANT_UINT8_ASYMM)
+      (weights_operand.typeInfo().type() == ir::DataType::QUANT_UINT8_ASYMM ||
+       weights_operand.typeInfo().type() == ir::DataType::QUANT_INT8_ASYMM))
   {
     weights_operand.type(ir::DataType::QUANT_INT8_SYMM);
   }
@@ -1810,7 +1865,7 @@ template <typename LoaderDomain, typename SpecificLoader>
 void BaseLoader<LoaderDomain, SpecificLoader>::loadModel()
 {
   LoaderDomain::VerifyModelBuffer(*_verifier.get());
-  _model = LoaderDomain::GetModel(_buffer.data());
+  _model = LoaderDomain::GetModel(_base);
   // Version unused
   // const auto version = _model->version();
   // Description unused
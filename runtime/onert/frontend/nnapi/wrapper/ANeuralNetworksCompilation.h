@@ -24,6 +24,9 @@
 #include "ir/Subgraphs.h"
 #include "exec/IExecutor.h"
 
+#include <atomic>
+#include <vector>
+
 struct ANeuralNetworksCompilation
 {
 public:
@@ -35,12 +38,22 @@ public:
   onert::compiler::State state(void) noexcept { return _compiler->state(); }
   void publish(std::shared_ptr<onert::exec::ExecutorMap> &executors) noexcept
   {
-    _compiler->release(executors);
+    // Executions take execution contexts in turn, so that as many executions as contexts can run
+    // on different threads at the same time
+    std::vector<std::shared_ptr<onert::exec::ExecutorMap>> contexts;
+    _compiler->release(contexts);
+    if (contexts.empty())
+    {
+      _compiler->release(executors);
+      return;
+    }
+    executors = contexts[_num_published++ % contexts.size()];
   }
 
 private:
   std::shared_ptr<onert::ir::Subgraphs> _subgraphs;
   std::shared_ptr<onert::compiler::Compiler> _compiler;
+  std::atomic<uint32_t> _num_published{0};
 };
 
 #endif
@@ -30,7 +30,7 @@ using namespace onert::ir;
 class CompiledMockUpModel
 {
 public:
-  CompiledMockUpModel()
+  CompiledMockUpModel(const std::string &executor = "", uint32_t num_contexts = 1)
   {
     // Model: two elementwise add operation
     // model input: lhs, rhs1
@@ -74,14 +74,19 @@ public:
     auto subgs = std::make_shared<onert::ir::Subgraphs>();
     subgs->push(onert::ir::SubgraphIndex{0}, graph);
     auto compiler = new onert::compiler::Compiler{subgs};
+    if (!executor.empty())
+      compiler->options().executor = executor;
+    compiler->options().num_contexts = num_contexts;
     compiler->compile();
     compiler->release(executors);
+    compiler->release(contexts);
     delete compiler;
   }
 
 public:
   std::shared_ptr<Graph> graph;
   std::shared_ptr<onert::exec::ExecutorMap> executors;
+  std::vector<std::shared_ptr<onert::exec::ExecutorMap>> contexts;
 };
 
 TEST(ExecInstance, simple)
@@ -114,6 +119,35 @@ TEST(ExecInstance, simple)
   delete execution;
 }
 
+TEST(ExecInstance, bindIO)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.executors;
+
+  auto input1 = IOIndex{0};
+  auto input2 = IOIndex{1};
+  auto output = IOIndex{0};
+
+  const float input1_buffer[4] = {1, 0, -1, -2};
+  const float input2_buffer[4] = {1, -3, 2, -4};
+  float output_buffer[4] = {};
+  const float output_expected[4] = {5, -2, 0, -1};
+
+  auto execution = new onert::exec::Execution(executors);
+
+  execution->bindInput(input1, reinterpret_cast<const void *>(input1_buffer), 16);
+  execution->bindInput(input2, reinterpret_cast<const void *>(input2_buffer), 16);
+  execution->bindOutput(output, reinterpret_cast<void *>(output_buffer), 16);
+  execution->execute();
+
+  for (auto i = 0; i < 4; i++)
+  {
+    EXPECT_EQ(output_buffer[i], output_expected[i]);
+  }
+
+  delete execution;
+}
+
 TEST(ExecInstance, twoCompile)
 {
   auto mockup = CompiledMockUpModel();
@@ -275,6 +309,46 @@ TEST(ExecInstance, twoThreads)
   }
 }
 
+// Support concurrent execution of a compiled model on multiple contexts
+TEST(ExecInstance, twoContexts)
+{
+  auto mockup = CompiledMockUpModel("", 2);
+  auto contexts = mockup.contexts;
+  ASSERT_EQ(contexts.size(), 2u);
+  ASSERT_EQ(contexts[0], mockup.executors);
+  ASSERT_NE(contexts[0], contexts[1]);
+
+  const float exe1_input1_buffer[4] = {1, 0, -1, -2};
+  const float exe1_input2_buffer[4] = {1, -3, 2, -4};
+  float exe1_output_buffer[4] = {};
+  const float exe1_output_expected[4] = {5, -2, 0, -1};
+
+  Inference execution1{exe1_input1_buffer, exe1_input2_buffer, exe1_output_buffer, contexts[0]};
+
+  const float exe2_input1_buffer[4] = {2, 1, -2, 0};
+  const float exe2_input2_buffer[4] = {-3, 3, 1, 2};
+  float exe2_output_buffer[4] = {};
+  const float exe2_output_expected[4] = {2, 5, -2, 7};
+
+  Inference execution2{exe2_input1_buffer, exe2_input2_buffer, exe2_output_buffer, contexts[1]};
+
+  auto repeat = [](Inference &inference) {
+    for (auto n = 0; n < 100; n++)
+      inference.inference();
+  };
+  std::thread t1{repeat, std::ref(execution1)};
+  std::thread t2{repeat, std::ref(execution2)};
+
+  t1.join();
+  t2.join();
+
+  for (auto i = 0; i < 4; i++)
+  {
+    EXPECT_EQ(exe1_output_buffer[i], exe1_output_expected[i]);
+    EXPECT_EQ(exe2_output_buffer[i], exe2_output_expected[i]);
+  }
+}
+
 // Support asynchronous execution
 TEST(ExecInstance, async)
 {
@@ -307,4 +381,38 @@ TEST(ExecInstance, async)
   delete execution;
 }
 
+// Worker threads of ParallelExecutor are kept across executions
+TEST(ExecInstance, parallelExecutorReuse)
+{
+  auto mockup = CompiledMockUpModel("Parallel");
+  auto executors = mockup.executors;
+
+  auto input1 = IOIndex{0};
+  auto input2 = IOIndex{1};
+  auto output = IOIndex{0};
+
+  const float input1_buffer[4] = {1, 0, -1, -2};
+  const float input2_buffer[4] = {1, -3, 2, -4};
+  const float output_expected[4] = {5, -2, 0, -1};
+
+  auto execution = new onert::exec::Execution(executors);
+
+  for (auto n = 0; n < 10; n++)
+  {
+    float output_buffer[4] = {};
+
+    execution->setInput(input1, reinterpret_cast<const void *>(input1_buffer), 16);
+    execution->setInput(input2, reinterpret_cast<const void *>(input2_buffer), 16);
+    execution->setOutput(output, reinterpret_cast<void *>(output_buffer), 16);
+    execution->execute();
+
+    for (auto i = 0; i < 4; i++)
+    {
+      EXPECT_EQ(output_buffer[i], output_expected[i]);
+    }
+  }
+
+  delete execution;
+}
+
 } // namespace
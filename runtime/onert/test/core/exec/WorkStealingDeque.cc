@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "exec/WorkStealingDeque.h"
+
+using onert::exec::WorkStealingDeque;
+
+TEST(WorkStealingDeque, pushPop)
+{
+  WorkStealingDeque<int> deque{4};
+  int values[4] = {0, 1, 2, 3};
+
+  ASSERT_EQ(deque.pop(), nullptr);
+  for (auto &value : values)
+  {
+    ASSERT_TRUE(deque.push(&value));
+  }
+
+  // Owner pops in LIFO order
+  for (int i = 3; i >= 0; --i)
+  {
+    ASSERT_EQ(deque.pop(), &values[i]);
+  }
+  ASSERT_EQ(deque.pop(), nullptr);
+}
+
+TEST(WorkStealingDeque, steal)
+{
+  WorkStealingDeque<int> deque{4};
+  int values[3] = {0, 1, 2};
+
+  ASSERT_EQ(deque.steal(), nullptr);
+  for (auto &value : values)
+  {
+    ASSERT_TRUE(deque.push(&value));
+  }
+
+  // Thieves steal in FIFO order
+  ASSERT_EQ(deque.steal(), &values[0]);
+  ASSERT_EQ(deque.pop(), &values[2]);
+  ASSERT_EQ(deque.steal(), &values[1]);
+  ASSERT_EQ(deque.steal(), nullptr);
+  ASSERT_EQ(deque.pop(), nullptr);
+}
+
+TEST(WorkStealingDeque, capacity)
+{
+  // Capacity is rounded up to a power of two
+  WorkStealingDeque<int> deque{3};
+  int values[5] = {0, 1, 2, 3, 4};
+
+  for (int i = 0; i < 4; ++i)
+  {
+    ASSERT_TRUE(deque.push(&values[i]));
+  }
+  ASSERT_FALSE(deque.push(&values[4]));
+
+  // Space freed by a thief can be reused
+  ASSERT_EQ(deque.steal(), &values[0]);
+  ASSERT_TRUE(deque.push(&values[4]));
+  ASSERT_EQ(deque.pop(), &values[4]);
+}
+
+TEST(WorkStealingDeque, concurrentSteal)
+{
+  constexpr int num_values = 10000;
+  constexpr int num_thieves = 3;
+
+  WorkStealingDeque<int> deque{num_values};
+  std::vector<int> values(num_values);
+  std::vector<std::atomic<int>> taken(num_values);
+  for (int i = 0; i < num_values; ++i)
+  {
+    values[i] = i;
+    taken[i] = 0;
+  }
+
+  std::atomic<bool> done{false};
+  std::vector<std::thread> thieves;
+  for (int i = 0; i < num_thieves; ++i)
+  {
+    thieves.emplace_back([&]() {
+      while (!done.load())
+      {
+        if (auto value = deque.steal())
+          taken[*value]++;
+      }
+    });
+  }
+
+  // Owner pushes and pops while the others steal
+  for (int i = 0; i < num_values; ++i)
+  {
+    ASSERT_TRUE(deque.push(&values[i]));
+    if (i % 2 == 1)
+    {
+      if (auto value = deque.pop())
+        taken[*value]++;
+    }
+  }
+  while (auto value = deque.pop())
+  {
+    taken[*value]++;
+  }
+  done = true;
+  for (auto &thief : thieves)
+  {
+    thief.join();
+  }
+
+  // Every element is taken exactly once
+  for (int i = 0; i < num_values; ++i)
+  {
+    ASSERT_EQ(taken[i].load(), 1) << "at " << i;
+  }
+}
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "exec/WorkStealingThreadPool.h"
+
+namespace
+{
+
+using namespace onert::exec;
+
+class CountFunction : public IFunction
+{
+public:
+  CountFunction(std::atomic<uint32_t> &count) : _count{count} {}
+
+public:
+  void run() override { _count++; }
+  void runSync() override { run(); }
+
+private:
+  std::atomic<uint32_t> &_count;
+};
+
+// Threads which have run functions
+struct ThreadRecord
+{
+  std::mutex mu;
+  std::set<std::thread::id> ids;
+};
+
+// Enqueues its children from the worker it runs on
+class FanOutFunction : public IFunction
+{
+public:
+  FanOutFunction(WorkStealingThreadPool &pool, std::atomic<uint32_t> &count, ThreadRecord &record)
+      : _pool{pool}, _count{count}, _record{record}
+  {
+  }
+
+public:
+  void run() override
+  {
+    for (auto &child : _children)
+    {
+      _pool.enqueue(child.get());
+    }
+    {
+      std::lock_guard<std::mutex> lock{_record.mu};
+      _record.ids.insert(std::this_thread::get_id());
+    }
+    // Give the other workers time to steal
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    _count++;
+  }
+  void runSync() override { run(); }
+
+  void addChild(std::unique_ptr<FanOutFunction> &&child)
+  {
+    _children.emplace_back(std::move(child));
+  }
+
+private:
+  WorkStealingThreadPool &_pool;
+  std::atomic<uint32_t> &_count;
+  ThreadRecord &_record;
+  std::vector<std::unique_ptr<FanOutFunction>> _children;
+};
+
+} // namespace
+
+TEST(WorkStealingThreadPool, runAll)
+{
+  constexpr uint32_t num_fns = 100;
+
+  std::atomic<uint32_t> count{0};
+  std::vector<std::unique_ptr<CountFunction>> fns;
+  for (uint32_t i = 0; i < num_fns; ++i)
+  {
+    fns.emplace_back(std::make_unique<CountFunction>(count));
+  }
+
+  WorkStealingThreadPool pool{4, num_fns};
+  for (auto &fn : fns)
+  {
+    pool.enqueue(fn.get());
+  }
+
+  while (count.load() < num_fns)
+  {
+    std::this_thread::yield();
+  }
+  ASSERT_EQ(count.load(), num_fns);
+}
+
+TEST(WorkStealingThreadPool, shutdown)
+{
+  constexpr uint32_t num_fns = 100;
+
+  std::atomic<uint32_t> count{0};
+  std::vector<std::unique_ptr<CountFunction>> fns;
+  for (uint32_t i = 0; i < num_fns; ++i)
+  {
+    fns.emplace_back(std::make_unique<CountFunction>(count));
+  }
+
+  {
+    WorkStealingThreadPool pool{2, num_fns};
+    for (auto &fn : fns)
+    {
+      pool.enqueue(fn.get());
+    }
+    // Pending functions are run before the pool is destroyed
+  }
+  ASSERT_EQ(count.load(), num_fns);
+
+  // A pool which has never run anything shuts down as well
+  {
+    WorkStealingThreadPool pool{3, num_fns};
+  }
+}
+
+TEST(WorkStealingThreadPool, steal)
+{
+  constexpr uint32_t num_children = 16;
+
+  std::atomic<uint32_t> count{0};
+  WorkStealingThreadPool pool{4, num_children};
+
+  // Children are pushed to the deque of the worker running the root, and the others steal them
+  ThreadRecord record;
+  FanOutFunction root{pool, count, record};
+  for (uint32_t i = 0; i < num_children; ++i)
+  {
+    root.addChild(std::make_unique<FanOutFunction>(pool, count, record));
+  }
+  pool.enqueue(&root);
+
+  while (count.load() < num_children + 1)
+  {
+    std::this_thread::yield();
+  }
+  ASSERT_EQ(count.load(), num_children + 1);
+  ASSERT_GT(record.ids.size(), 1u);
+}
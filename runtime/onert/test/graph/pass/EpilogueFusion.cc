@@ -0,0 +1,376 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ir/Graph.h"
+#include "ir/operation/Add.h"
+#include "ir/operation/Conv2D.h"
+#include "ir/operation/DepthwiseConv2D.h"
+#include "ir/operation/FullyConnected.h"
+#include "ir/operation/Mul.h"
+#include "ir/operation/ReLU.h"
+#include "ir/operation/Sub.h"
+#include "ir/operation/Tanh.h"
+#include "ir/pass/EpilogueFusionPass.h"
+#include "ir/verifier/Verifier.h"
+
+#include <memory>
+#include <vector>
+
+using namespace onert::ir;
+
+namespace
+{
+
+OperandIndex addConstant(Graph &graph, const Shape &shape, const std::vector<float> &values)
+{
+  auto index = graph.addOperand(shape, TypeInfo{DataType::FLOAT32});
+  graph.operands().at(index).data(std::make_unique<CachedData>(
+      reinterpret_cast<const uint8_t *>(values.data()), values.size() * sizeof(float)));
+  return index;
+}
+
+uint32_t numOperations(const Graph &graph)
+{
+  uint32_t count = 0;
+  graph.operations().iterate([&](const OperationIndex &, const Operation &) { ++count; });
+  return count;
+}
+
+const float *floatsOf(const Graph &graph, const OperandIndex &index)
+{
+  return reinterpret_cast<const float *>(graph.operands().at(index).data()->base());
+}
+
+OperationIndex addConv(Graph &graph, const OperandIndex &input, const OperandIndex &kernel,
+                       const OperandIndex &bias, const OperandIndex &output)
+{
+  operation::Conv2D::Param param;
+  param.stride = Stride{1, 1};
+  param.padding = Padding{PaddingType::VALID};
+  param.activation = Activation::NONE;
+  return graph.addOperation(std::make_unique<operation::Conv2D>(
+      OperandIndexSequence{input, kernel, bias}, OperandIndexSequence{output}, param));
+}
+
+template <typename Op>
+OperationIndex addBinary(Graph &graph, const OperandIndex &lhs, const OperandIndex &rhs,
+                         const OperandIndex &output)
+{
+  typename Op::Param param;
+  param.activation = Activation::NONE;
+  return graph.addOperation(
+      std::make_unique<Op>(OperandIndexSequence{lhs, rhs}, OperandIndexSequence{output}, param));
+}
+
+// input -> Conv2D(1x1, 2 channels) -> output, to be followed by an epilogue
+struct Conv
+{
+  Conv()
+  {
+    input = graph.addOperand(Shape{1, 3, 3, 1}, float_type);
+    kernel = addConstant(graph, Shape{2, 1, 1, 1}, {1.f, 2.f});
+    bias = addConstant(graph, Shape{2}, {0.5f, -0.5f});
+    conv_output = graph.addOperand(Shape{1, 3, 3, 2}, float_type);
+    output = graph.addOperand(Shape{1, 3, 3, 2}, float_type);
+    conv = addConv(graph, input, kernel, bias, conv_output);
+    graph.addInput(input);
+  }
+
+  const operation::Conv2D &fused() const
+  {
+    return static_cast<const operation::Conv2D &>(graph.operations().at(conv));
+  }
+
+  const TypeInfo float_type{DataType::FLOAT32};
+  Graph graph;
+  OperandIndex input;
+  OperandIndex kernel;
+  OperandIndex bias;
+  OperandIndex conv_output;
+  OperandIndex output;
+  OperationIndex conv;
+};
+
+// input -> Conv2D -> Add(constant) -> ReLU -> output
+struct ConvAddReLU
+{
+  ConvAddReLU(bool conv_output_is_model_output = false)
+  {
+    const TypeInfo float_type{DataType::FLOAT32};
+    auto input = graph.addOperand(Shape{1, 3, 3, 1}, float_type);
+    kernel = addConstant(graph, Shape{2, 1, 1, 1}, {1.f, 2.f});
+    bias = addConstant(graph, Shape{2}, {0.5f, -0.5f});
+    conv_output = graph.addOperand(Shape{1, 3, 3, 2}, float_type);
+    auto addend = addConstant(graph, Shape{1, 1, 1, 2}, {1.f, 3.f});
+    auto add_output = graph.addOperand(Shape{1, 3, 3, 2}, float_type);
+    output = graph.addOperand(Shape{1, 3, 3, 2}, float_type);
+
+    operation::Conv2D::Param conv_param;
+    conv_param.stride = Stride{1, 1};
+    conv_param.padding = Padding{PaddingType::VALID};
+    conv_param.activation = Activation::NONE;
+    conv = graph.addOperation(std::make_unique<operation::Conv2D>(
+        OperandIndexSequence{input, kernel, bias}, OperandIndexSequence{conv_output}, conv_param));
+    operation::Add::Param add_param;
+    add_param.activation = Activation::NONE;
+    graph.addOperation(std::make_unique<operation::Add>(OperandIndexSequence{conv_output, addend},
+                                                        OperandIndexSequence{add_output},
+                                                        add_param));
+    graph.addOperation(std::make_unique<operation::ReLU>(OperandIndexSequence{add_output},
+                                                         OperandIndexSequence{output}));
+
+    graph.addInput(input);
+    graph.addOutput(output);
+    if (conv_output_is_model_output)
+      graph.addOutput(conv_output);
+    graph.finishBuilding();
+  }
+
+  Graph graph;
+  OperandIndex kernel;
+  OperandIndex bias;
+  OperandIndex conv_output;
+  OperandIndex output;
+  OperationIndex conv;
+};
+
+} // namespace
+
+TEST(EpilogueFusionPass, conv_add_relu)
+{
+  ConvAddReLU model;
+  auto &graph = model.graph;
+
+  pass::EpilogueFusionPass fusion{graph};
+  fusion.run();
+
+  ASSERT_EQ(fusion.numFused(), 2);
+  ASSERT_EQ(fusion.savedBytes(), 2 * 18 * sizeof(float));
+  ASSERT_EQ(numOperations(graph), 1);
+  ASSERT_TRUE(verifier::EdgeConsistencyChecker().verify(graph));
+
+  const auto &conv = static_cast<const operation::Conv2D &>(graph.operations().at(model.conv));
+  ASSERT_EQ(conv.param().activation, Activation::RELU);
+  ASSERT_EQ(conv.getOutputs().at(0), model.output);
+  ASSERT_EQ(*graph.operands().at(model.output).getDef().begin(), model.conv);
+
+  const auto *bias = floatsOf(graph, model.bias);
+  ASSERT_FLOAT_EQ(bias[0], 1.5f);
+  ASSERT_FLOAT_EQ(bias[1], 2.5f);
+  const auto *kernel = floatsOf(graph, model.kernel);
+  ASSERT_FLOAT_EQ(kernel[0], 1.f);
+  ASSERT_FLOAT_EQ(kernel[1], 2.f);
+}
+
+TEST(EpilogueFusionPass, neg_intermediate_is_model_output)
+{
+  ConvAddReLU model{true};
+  auto &graph = model.graph;
+
+  pass::EpilogueFusionPass fusion{graph};
+  fusion.run();
+
+  // Only ReLU is fused into Add since Conv2D output is observable
+  ASSERT_EQ(fusion.numFused(), 1);
+  ASSERT_EQ(numOperations(graph), 2);
+  ASSERT_TRUE(graph.operands().exist(model.conv_output));
+  const auto *bias = floatsOf(graph, model.bias);
+  ASSERT_FLOAT_EQ(bias[0], 0.5f);
+  ASSERT_FLOAT_EQ(bias[1], -0.5f);
+}
+
+TEST(EpilogueFusionPass, conv_mul)
+{
+  Conv model;
+  auto &graph = model.graph;
+  auto multiplier = addConstant(graph, Shape{2}, {2.f, 3.f});
+  addBinary<operation::Mul>(graph, model.conv_output, multiplier, model.output);
+  graph.addOutput(model.output);
+  graph.finishBuilding();
+
+  pass::EpilogueFusionPass fusion{graph};
+  fusion.run();
+
+  ASSERT_EQ(fusion.numFused(), 1);
+  ASSERT_EQ(numOperations(graph), 1);
+  ASSERT_TRUE(verifier::EdgeConsistencyChecker().verify(graph));
+
+  // Kernel is scaled for each output channel as well as bias
+  const auto *kernel = floatsOf(graph, model.kernel);
+  ASSERT_FLOAT_EQ(kernel[0], 2.f);
+  ASSERT_FLOAT_EQ(kernel[1], 6.f);
+  const auto *bias = floatsOf(graph, model.bias);
+  ASSERT_FLOAT_EQ(bias[0], 1.f);
+  ASSERT_FLOAT_EQ(bias[1], -1.5f);
+}
+
+TEST(EpilogueFusionPass, conv_sub)
+{
+  Conv model;
+  auto &graph = model.graph;
+  auto subtrahend = addConstant(graph, Shape{2}, {1.f, 2.f});
+  addBinary<operation::Sub>(graph, model.conv_output, subtrahend, model.output);
+  graph.addOutput(model.output);
+  graph.finishBuilding();
+
+  pass::EpilogueFusionPass fusion{graph};
+  fusion.run();
+
+  ASSERT_EQ(fusion.numFused(), 1);
+  ASSERT_TRUE(verifier::EdgeConsistencyChecker().verify(graph));
+  const auto *bias = floatsOf(graph, model.bias);
+  ASSERT_FLOAT_EQ(bias[0], -0.5f);
+  ASSERT_FLOAT_EQ(bias[1], -2.5f);
+}
+
+TEST(EpilogueFusionPass, neg_constant_sub_conv)
+{
+  Conv model;
+  auto &graph = model.graph;
+  auto minuend = addConstant(graph, Shape{2}, {1.f, 2.f});
+  addBinary<operation::Sub>(graph, minuend, model.conv_output, model.output);
+  graph.addOutput(model.output);
+  graph.finishBuilding();
+
+  pass::EpilogueFusionPass fusion{graph};
+  fusion.run();
+
+  // (constant - x) is not a bias of x
+  ASSERT_EQ(fusion.numFused(), 0);
+  ASSERT_EQ(numOperations(graph), 2);
+}
+
+TEST(EpilogueFusionPass, depthwise_conv_mul)
+{
+  const TypeInfo float_type{DataType::FLOAT32};
+  Graph graph;
+  auto input = graph.addOperand(Shape{1, 3, 3, 2}, float_type);
+  // Kernel is [1, H, W, C], so channel is the innermost dimension
+  auto kernel = addConstant(graph, Shape{1, 1, 2, 2}, {1.f, 2.f, 3.f, 4.f});
+  auto bias = addConstant(graph, Shape{2}, {1.f, 1.f});
+  auto dwconv_output = graph.addOperand(Shape{1, 3, 2, 2}, float_type);
+  auto multiplier = addConstant(graph, Shape{1, 1, 1, 2}, {10.f, 100.f});
+  auto output = graph.addOperand(Shape{1, 3, 2, 2}, float_type);
+
+  operation::DepthwiseConv2D::Param param;
+  param.stride = Stride{1, 1};
+  param.padding = Padding{PaddingType::VALID};
+  param.multiplier = 1;
+  param.activation = Activation::NONE;
+  graph.addOperation(std::make_unique<operation::DepthwiseConv2D>(
+      OperandIndexSequence{input, kernel, bias}, OperandIndexSequence{dwconv_output}, param));
+  addBinary<operation::Mul>(graph, dwconv_output, multiplier, output);
+  graph.addInput(input);
+  graph.addOutput(output);
+  graph.finishBuilding();
+
+  pass::EpilogueFusionPass fusion{graph};
+  fusion.run();
+
+  ASSERT_EQ(fusion.numFused(), 1);
+  ASSERT_TRUE(verifier::EdgeConsistencyChecker().verify(graph));
+  const auto *kernel_values = floatsOf(graph, kernel);
+  ASSERT_FLOAT_EQ(kernel_values[0], 10.f);
+  ASSERT_FLOAT_EQ(kernel_values[1], 200.f);
+  ASSERT_FLOAT_EQ(kernel_values[2], 30.f);
+  ASSERT_FLOAT_EQ(kernel_values[3], 400.f);
+  const auto *bias_values = floatsOf(graph, bias);
+  ASSERT_FLOAT_EQ(bias_values[0], 10.f);
+  ASSERT_FLOAT_EQ(bias_values[1], 100.f);
+}
+
+TEST(EpilogueFusionPass, fully_connected_add)
+{
+  const TypeInfo float_type{DataType::FLOAT32};
+  Graph graph;
+  auto input = graph.addOperand(Shape{1, 3}, float_type);
+  auto weight = addConstant(graph, Shape{2, 3}, {1.f, 2.f, 3.f, 4.f, 5.f, 6.f});
+  auto bias = addConstant(graph, Shape{2}, {0.f, 1.f});
+  auto fc_output = graph.addOperand(Shape{1, 2}, float_type);
+  auto addend = addConstant(graph, Shape{2}, {0.5f, 0.25f});
+  auto output = graph.addOperand(Shape{1, 2}, float_type);
+
+  operation::FullyConnected::Param param;
+  param.activation = Activation::NONE;
+  auto fc = graph.addOperation(std::make_unique<operation::FullyConnected>(
+      OperandIndexSequence{input, weight, bias}, OperandIndexSequence{fc_output}, param));
+  addBinary<operation::Add>(graph, addend, fc_output, output);
+  graph.addInput(input);
+  graph.addOutput(output);
+  graph.finishBuilding();
+
+  pass::EpilogueFusionPass fusion{graph};
+  fusion.run();
+
+  ASSERT_EQ(fusion.numFused(), 1);
+  ASSERT_TRUE(verifier::EdgeConsistencyChecker().verify(graph));
+  ASSERT_EQ(graph.operations().at(fc).getOutputs().at(0), output);
+  const auto *bias_values = floatsOf(graph, bias);
+  ASSERT_FLOAT_EQ(bias_values[0], 0.5f);
+  ASSERT_FLOAT_EQ(bias_values[1], 1.25f);
+  const auto *weight_values = floatsOf(graph, weight);
+  ASSERT_FLOAT_EQ(weight_values[5], 6.f);
+}
+
+// input -> Conv2D -> Add(residual) -> ReLU -> output
+struct ConvResidualReLU : public Conv
+{
+  ConvResidualReLU()
+  {
+    residual = graph.addOperand(Shape{1, 3, 3, 2}, float_type);
+    auto add_output = graph.addOperand(Shape{1, 3, 3, 2}, float_type);
+    addBinary<operation::Add>(graph, residual, conv_output, add_output);
+    graph.addOperation(std::make_unique<operation::ReLU>(OperandIndexSequence{add_output},
+                                                         OperandIndexSequence{output}));
+    graph.addInput(residual);
+    graph.addOutput(output);
+    graph.finishBuilding();
+  }
+
+  OperandIndex residual;
+};
+
+TEST(EpilogueFusionPass, neg_conv_residual)
+{
+  ConvResidualReLU model;
+  auto &graph = model.graph;
+
+  pass::EpilogueFusionPass fusion{graph};
+  fusion.run();
+
+  // Only ReLU is fused into Add
+  ASSERT_EQ(fusion.numFused(), 1);
+  ASSERT_EQ(numOperations(graph), 2);
+  ASSERT_EQ(model.fused().getInputs().size(), 3u);
+}
+
+TEST(EpilogueFusionPass, neg_conv_tanh)
+{
+  Conv model;
+  auto &graph = model.graph;
+  graph.addOperation(std::make_unique<operation::Tanh>(OperandIndexSequence{model.conv_output},
+                                                       OperandIndexSequence{model.output}));
+  graph.addOutput(model.output);
+  graph.finishBuilding();
+
+  pass::EpilogueFusionPass fusion{graph};
+  fusion.run();
+
+  ASSERT_EQ(fusion.numFused(), 0);
+  ASSERT_EQ(model.fused().param().activation, Activation::NONE);
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <ir/Data.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <vector>
+#include <unistd.h>
+
+TEST(DataTest, mmaped_data)
+{
+  const auto pagesize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+  // File contents : [0, 1, 2, ..., 255, 0, 1, ...] of 2 pages
+  std::vector<uint8_t> contents(pagesize * 2);
+  for (size_t i = 0; i < contents.size(); ++i)
+    contents[i] = static_cast<uint8_t>(i);
+
+  FILE *file = tmpfile();
+  ASSERT_NE(file, nullptr);
+  ASSERT_EQ(fwrite(contents.data(), 1, contents.size(), file), contents.size());
+  ASSERT_EQ(fflush(file), 0);
+  const int fd = fileno(file);
+
+  {
+    // Data at the beginning of a page
+    onert::ir::MMapedData data{fd, 0, pagesize, 0, pagesize};
+    ASSERT_EQ(data.size(), pagesize);
+    ASSERT_EQ(data.base()[0], contents[0]);
+    ASSERT_EQ(data.base()[pagesize - 1], contents[pagesize - 1]);
+  }
+  {
+    // Data spanning two pages, which does not start at the beginning of a page
+    const size_t offset = pagesize - 3;
+    const size_t size = 7;
+    onert::ir::MMapedData data{fd, 0, offset + size, static_cast<std::ptrdiff_t>(offset), size};
+    ASSERT_EQ(data.size(), size);
+    for (size_t i = 0; i < size; ++i)
+      ASSERT_EQ(data.base()[i], contents[offset + i]);
+  }
+
+  fclose(file);
+}
+
+TEST(DataTest, neg_mmaped_data_invalid_fd)
+{
+  EXPECT_ANY_THROW(onert::ir::MMapedData(-1, 0, 16, 0, 16));
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <ir/Graph.h>
+#include <ir/PreparedDataCache.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using onert::ir::CachedData;
+using onert::ir::Data;
+using onert::ir::OperandIndex;
+using onert::ir::PreparedDataCache;
+
+TEST(PreparedDataCacheTest, prepare_once)
+{
+  PreparedDataCache cache;
+  const uint8_t values[] = {1, 2, 3, 4};
+  std::shared_ptr<const Data> data = std::make_shared<CachedData>(values, sizeof(values));
+
+  int num_prepared = 0;
+  auto prepare = [&]() {
+    ++num_prepared;
+    return std::shared_ptr<const void>{std::make_shared<std::vector<float>>(4)};
+  };
+
+  auto prepared = cache.get(OperandIndex{0}, data, prepare);
+  ASSERT_NE(prepared, nullptr);
+  ASSERT_EQ(cache.get(OperandIndex{0}, data, prepare), prepared);
+  ASSERT_EQ(num_prepared, 1);
+
+  // Another operand is prepared on its own
+  ASSERT_NE(cache.get(OperandIndex{1}, data, prepare), prepared);
+  ASSERT_EQ(num_prepared, 2);
+}
+
+TEST(PreparedDataCacheTest, shared_by_graph_copies)
+{
+  onert::ir::Graph graph;
+  onert::ir::Graph copy{graph};
+
+  ASSERT_EQ(graph.preparedDataCache(), copy.preparedDataCache());
+}
+
+TEST(PreparedDataCacheTest, neg_other_data_of_operand)
+{
+  PreparedDataCache cache;
+  const uint8_t values[] = {1, 2, 3, 4};
+  std::shared_ptr<const Data> data = std::make_shared<CachedData>(values, sizeof(values));
+  std::shared_ptr<const Data> replaced = std::make_shared<CachedData>(values, sizeof(values));
+
+  auto prepare = []() {
+    return std::shared_ptr<const void>{std::make_shared<std::vector<float>>(4)};
+  };
+
+  // Data prepared from the data replaced is not used
+  auto prepared = cache.get(OperandIndex{0}, data, prepare);
+  ASSERT_NE(cache.get(OperandIndex{0}, replaced, prepare), prepared);
+
+  // Nothing is kept if there is nothing to prepare
+  auto nothing = []() { return std::shared_ptr<const void>{}; };
+  ASSERT_EQ(cache.get(OperandIndex{2}, data, nothing), nullptr);
+}
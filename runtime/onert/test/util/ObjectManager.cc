@@ -69,6 +69,22 @@ TEST(ObjectManager, push)
   ASSERT_EQ(man.at(index), 100);
 }
 
+TEST(ObjectManager, set)
+{
+  util::ObjectManager<Index, int> man;
+
+  auto index0 = man.emplace(100);
+  auto index1 = man.emplace(200);
+  man.set(index0, std::unique_ptr<int>{new int{300}});
+  ASSERT_EQ(man.at(index0), 300);
+  ASSERT_EQ(man.at(index1), 200);
+
+  // New index does not collide with existing ones
+  auto index2 = man.emplace(400);
+  ASSERT_NE(index2, index0);
+  ASSERT_NE(index2, index1);
+}
+
 TEST(ObjectManager, const_iterate)
 {
   util::ObjectManager<Index, int> man;
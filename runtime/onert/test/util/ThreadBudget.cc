@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "util/ThreadBudget.h"
+
+#include <algorithm>
+#include <thread>
+
+using namespace onert;
+
+namespace
+{
+
+// Share of each kernel when kernels on num_threads threads split max_threads threads
+uint32_t shareOf(uint32_t max_threads, uint32_t num_threads)
+{
+  return std::max(1u, max_threads / num_threads);
+}
+
+} // namespace
+
+TEST(ThreadBudget, threadsPerKernel)
+{
+  auto &budget = util::ThreadBudget::get();
+  const auto max_threads = budget.maxThreads();
+  ASSERT_GE(max_threads, 1u);
+  ASSERT_EQ(budget.threadsPerKernel(), max_threads);
+
+  {
+    util::ThreadBudgetScope scope1{1};
+    ASSERT_EQ(budget.threadsPerKernel(), max_threads);
+    {
+      util::ThreadBudgetScope scope2{3};
+      ASSERT_EQ(budget.threadsPerKernel(), shareOf(max_threads, 4));
+      {
+        util::ThreadBudgetScope scope3{max_threads * 2};
+        // At least one thread for each kernel
+        ASSERT_EQ(budget.threadsPerKernel(), 1u);
+      }
+    }
+    ASSERT_EQ(budget.threadsPerKernel(), max_threads);
+  }
+  ASSERT_EQ(budget.threadsPerKernel(), max_threads);
+}
+
+TEST(ThreadBudget, threadLimit)
+{
+  auto &budget = util::ThreadBudget::get();
+  const auto max_threads = budget.maxThreads();
+  ASSERT_EQ(budget.threadLimit(), 0u);
+
+  {
+    // Session limited to 4 threads, running kernels on 2 threads
+    util::ThreadBudgetScope scope1{2, 4};
+    ASSERT_EQ(budget.threadLimit(), 2u);
+    ASSERT_EQ(budget.threadsPerKernel(), std::min(shareOf(max_threads, 2), 2u));
+    {
+      // Process-wide budget is smaller than the limit of the session
+      util::ThreadBudgetScope scope2{max_threads * 2};
+      ASSERT_EQ(budget.threadsPerKernel(), 1u);
+    }
+    {
+      // Session without limit keeps the limit of the calling thread
+      util::ThreadLimitScope scope3{0};
+      ASSERT_EQ(budget.threadLimit(), 2u);
+    }
+  }
+  ASSERT_EQ(budget.threadLimit(), 0u);
+  ASSERT_EQ(budget.threadsPerKernel(), max_threads);
+
+  {
+    // Limit is kept for each thread
+    util::ThreadLimitScope scope{1};
+    uint32_t other_limit = 1;
+    std::thread{[&]() { other_limit = budget.threadLimit(); }}.join();
+    ASSERT_EQ(budget.threadLimit(), 1u);
+    ASSERT_EQ(other_limit, 0u);
+    ASSERT_EQ(budget.threadsPerKernel(), 1u);
+  }
+  ASSERT_EQ(budget.threadLimit(), 0u);
+
+  ASSERT_EQ(util::ThreadBudgetScope::threadLimitOf(0, 4), 0u);
+  ASSERT_EQ(util::ThreadBudgetScope::threadLimitOf(3, 4), 1u);
+  ASSERT_EQ(util::ThreadBudgetScope::threadLimitOf(9, 4), 2u);
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "util/TraceRingBuffer.h"
+
+#include <thread>
+
+using namespace onert;
+using Phase = util::TraceEvent::Phase;
+
+TEST(TraceRingBuffer, keep_last_events)
+{
+  util::TraceRingBuffer buffer{3};
+  ASSERT_EQ(buffer.capacity(), 4u);
+
+  for (uint32_t id = 0; id < 10; ++id)
+  {
+    buffer.record(id, id % 2 == 0 ? Phase::BEGIN : Phase::END);
+  }
+
+  auto threads = buffer.collect();
+  ASSERT_EQ(threads.size(), 1u);
+  const auto &events = threads.at(0);
+  ASSERT_EQ(events.size(), 4u);
+  for (uint32_t n = 0; n < events.size(); ++n)
+  {
+    ASSERT_EQ(events[n].id, 6 + n);
+    ASSERT_EQ(events[n].phase, n % 2 == 0 ? Phase::BEGIN : Phase::END);
+    if (n > 0)
+    {
+      ASSERT_LE(events[n - 1].ts, events[n].ts);
+    }
+  }
+}
+
+TEST(TraceRingBuffer, clamp_capacity)
+{
+  util::TraceRingBuffer buffer{0xffffffffu};
+  ASSERT_EQ(buffer.capacity(), util::TraceRingBuffer::max_capacity);
+}
+
+TEST(TraceRingBuffer, ring_per_thread)
+{
+  util::TraceRingBuffer buffer{16};
+  buffer.record(0, Phase::BEGIN);
+
+  std::thread worker{[&]() {
+    for (uint32_t id = 1; id <= 2; ++id)
+      buffer.record(id, Phase::BEGIN);
+  }};
+  worker.join();
+
+  // Another buffer does not share rings with the first one
+  util::TraceRingBuffer other{16};
+  other.record(3, Phase::END);
+  ASSERT_EQ(other.collect().size(), 1u);
+
+  auto threads = buffer.collect();
+  ASSERT_EQ(threads.size(), 2u);
+  size_t num_events = 0;
+  for (const auto &events : threads)
+    num_events += events.size();
+  ASSERT_EQ(num_events, 3u);
+}
+
+TEST(TraceRingBuffer, drop_unpaired_events)
+{
+  util::TraceRingBuffer buffer{8};
+
+  // BEGIN of the first two events is overwritten, and the last two have not ended yet
+  buffer.record(0, Phase::BEGIN);
+  buffer.record(1, Phase::BEGIN);
+  buffer.record(1, Phase::END);
+  buffer.record(2, Phase::BEGIN);
+  buffer.record(2, Phase::END);
+  buffer.record(0, Phase::END);
+  buffer.record(3, Phase::BEGIN);
+  buffer.record(3, Phase::END);
+  buffer.record(4, Phase::BEGIN);
+  buffer.record(5, Phase::BEGIN);
+
+  const auto events = buffer.collect().at(0);
+  ASSERT_EQ(events.size(), 8u);
+  ASSERT_EQ(events.front().id, 1u);
+  ASSERT_EQ(events.front().phase, Phase::END);
+
+  const auto paired = util::pairedEvents(events);
+  const std::vector<uint32_t> expected_ids{2, 2, 3, 3};
+  ASSERT_EQ(paired.size(), expected_ids.size());
+  for (uint32_t n = 0; n < paired.size(); ++n)
+  {
+    ASSERT_EQ(paired[n].id, expected_ids[n]);
+    ASSERT_EQ(paired[n].phase, n % 2 == 0 ? Phase::BEGIN : Phase::END);
+  }
+}
@@ -42,6 +42,100 @@ TEST_F(ValidationTestAddSessionPrepared, run_001)
   ASSERT_EQ(nnfw_run(_session), NNFW_STATUS_NO_ERROR);
 }
 
+TEST_F(ValidationTestAddSessionPrepared, run_bind_001)
+{
+  nnfw_tensorinfo ti_input;
+  ASSERT_EQ(nnfw_input_tensorinfo(_session, 0, &ti_input), NNFW_STATUS_NO_ERROR);
+  uint64_t input_elements = num_elems(&ti_input);
+  std::vector<float> input_buffer(input_elements);
+  for (uint64_t i = 0; i < input_elements; ++i)
+    input_buffer[i] = static_cast<float>(i);
+
+  nnfw_tensorinfo ti_output;
+  ASSERT_EQ(nnfw_output_tensorinfo(_session, 0, &ti_output), NNFW_STATUS_NO_ERROR);
+  uint64_t output_elements = num_elems(&ti_output);
+  std::vector<float> copied_output(output_elements);
+  std::vector<float> bound_output(output_elements);
+
+  // Run with copy
+  ASSERT_EQ(nnfw_set_input(_session, 0, ti_input.dtype, input_buffer.data(),
+                           sizeof(float) * input_elements),
+            NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_set_output(_session, 0, ti_output.dtype, copied_output.data(),
+                            sizeof(float) * output_elements),
+            NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_run(_session), NNFW_STATUS_NO_ERROR);
+
+  // Run with bound buffers
+  ASSERT_EQ(nnfw_bind_input(_session, 0, ti_input.dtype, input_buffer.data(),
+                            sizeof(float) * input_elements),
+            NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_bind_output(_session, 0, ti_output.dtype, bound_output.data(),
+                             sizeof(float) * output_elements),
+            NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_run(_session), NNFW_STATUS_NO_ERROR);
+
+  ASSERT_EQ(copied_output, bound_output);
+}
+
+TEST_F(ValidationTestAddSessionPrepared, run_async_001)
+{
+  nnfw_tensorinfo ti_input;
+  ASSERT_EQ(nnfw_input_tensorinfo(_session, 0, &ti_input), NNFW_STATUS_NO_ERROR);
+  uint64_t input_elements = num_elems(&ti_input);
+  std::vector<float> input_buffer(input_elements);
+  ASSERT_EQ(nnfw_set_input(_session, 0, ti_input.dtype, input_buffer.data(),
+                           sizeof(float) * input_elements),
+            NNFW_STATUS_NO_ERROR);
+
+  nnfw_tensorinfo ti_output;
+  ASSERT_EQ(nnfw_output_tensorinfo(_session, 0, &ti_output), NNFW_STATUS_NO_ERROR);
+  uint64_t output_elements = num_elems(&ti_output);
+  std::vector<float> output_buffer(output_elements);
+  ASSERT_EQ(nnfw_set_output(_session, 0, ti_output.dtype, output_buffer.data(),
+                            sizeof(float) * output_elements),
+            NNFW_STATUS_NO_ERROR);
+
+  struct Result
+  {
+    nnfw_session *session = nullptr;
+    NNFW_STATUS status = NNFW_STATUS_ERROR;
+  } result;
+  auto callback = [](nnfw_session *session, NNFW_STATUS status, void *user_data) {
+    auto result = static_cast<Result *>(user_data);
+    result->session = session;
+    result->status = status;
+  };
+
+  for (int i = 0; i < 3; ++i)
+  {
+    result = Result{};
+    ASSERT_EQ(nnfw_run_async(_session, callback, &result), NNFW_STATUS_NO_ERROR);
+    ASSERT_EQ(nnfw_await(_session), NNFW_STATUS_NO_ERROR);
+    ASSERT_EQ(result.session, _session);
+    ASSERT_EQ(result.status, NNFW_STATUS_NO_ERROR);
+  }
+
+  // Without callback
+  ASSERT_EQ(nnfw_run_async(_session, nullptr, nullptr), NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_await(_session), NNFW_STATUS_NO_ERROR);
+}
+
+TEST_F(ValidationTestAddSessionPrepared, neg_run_async_001)
+{
+  ASSERT_EQ(nnfw_run_async(_session, nullptr, nullptr), NNFW_STATUS_NO_ERROR);
+  // Session cannot be run again before await
+  ASSERT_EQ(nnfw_run_async(_session, nullptr, nullptr), NNFW_STATUS_ERROR);
+  ASSERT_EQ(nnfw_run(_session), NNFW_STATUS_ERROR);
+  nnfw_await(_session);
+}
+
+TEST_F(ValidationTestAddSessionPrepared, neg_await_001)
+{
+  // await without run_async
+  ASSERT_EQ(nnfw_await(_session), NNFW_STATUS_ERROR);
+}
+
 TEST_F(ValidationTestAddSessionPrepared, set_input_001)
 {
   char input[32];
@@ -94,6 +188,18 @@ TEST_F(ValidationTestAddSessionPrepared, neg_set_output_002)
             NNFW_STATUS_ERROR);
 }
 
+TEST_F(ValidationTestAddSessionPrepared, neg_bind_input_001)
+{
+  ASSERT_EQ(nnfw_bind_input(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, nullptr, 1), NNFW_STATUS_ERROR);
+}
+
+TEST_F(ValidationTestAddSessionPrepared, neg_bind_output_001)
+{
+  char output[1]; // buffer size is too small
+  ASSERT_EQ(nnfw_bind_output(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, output, sizeof(output)),
+            NNFW_STATUS_ERROR);
+}
+
 TEST_F(ValidationTestAddSessionPrepared, neg_get_input_size)
 {
   ASSERT_EQ(nnfw_input_size(_session, nullptr), NNFW_STATUS_ERROR);
@@ -21,7 +21,14 @@
 #include <unordered_map>
 
 #include "Operation.h"
+#include "operations/BinaryArithmetic.h"
+#include "operations/Concatenation.h"
 #include "operations/Convolution.h"
+#include "operations/DepthwiseConvolution.h"
+#include "operations/FullyConnected.h"
+#include "operations/Reduce.h"
+#include "operations/Softmax.h"
+#include "operations/Transpose.h"
 #include "operations/TransposeConv.h"
 
 namespace kbenchmark
@@ -65,6 +65,22 @@ std::string get_key_string(const std::string &key, OperationInfo &info)
   return info[key];
 }
 
+std::string get_key_string(const std::string &key, const std::string &default_value,
+                           OperationInfo &info)
+{
+  return info.count(key) ? info[key] : default_value;
+}
+
+std::string to_string(const std::vector<int> &dims)
+{
+  std::string str;
+  for (auto dim : dims)
+  {
+    str += (str.empty() ? "" : ",") + std::to_string(dim);
+  }
+  return str;
+}
+
 } // namespace kbenchmark
 
 #endif // __KBENCHMARK_UTILS_H__
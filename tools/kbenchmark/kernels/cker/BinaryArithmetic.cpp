@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Add, Sub, Mul and Div benchmark of cker, with broadcasting if shapes differ
+ */
+
+#include "Utils.h"
+
+#include <cker/operation/BinaryArithmeticOps.h>
+
+using namespace kbenchmark::kernels::cker;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(LAYER, 0);
+
+NONIUS_PARAM(ARITHMETIC_TYPE, std::string{"ADD"})
+
+NONIUS_PARAM(LHS_SHAPE, std::string{"1,56,56,64"})
+NONIUS_PARAM(RHS_SHAPE, std::string{"1,56,56,64"})
+NONIUS_PARAM(OUTPUT_SHAPE, std::string{"1,56,56,64"})
+
+NONIUS_PARAM(FUSED_ACT, std::string{"NONE"})
+
+//
+// Helpers
+//
+namespace
+{
+
+nnfw::cker::BinaryArithmeticOpType toArithmeticType(const std::string &name)
+{
+  if (name == "ADD")
+    return nnfw::cker::BinaryArithmeticOpType::ADD;
+  if (name == "SUB")
+    return nnfw::cker::BinaryArithmeticOpType::SUB;
+  if (name == "MUL")
+    return nnfw::cker::BinaryArithmeticOpType::MUL;
+  if (name == "DIV")
+    return nnfw::cker::BinaryArithmeticOpType::DIV;
+  throw std::runtime_error{"Unsupported arithmetic type: " + name};
+}
+
+} // namespace
+
+//
+// Benchmark Implementations
+//
+namespace
+{
+
+inline nonius::benchmark_registry &local_benchmark_registry()
+{
+  static nonius::benchmark_registry registry;
+  return registry;
+}
+
+} // namespace
+
+#define NONIUS_LOCAL_BENCHMARK(name, ...)                                              \
+  namespace                                                                            \
+  {                                                                                    \
+  static ::nonius::benchmark_registrar                                                 \
+      NONIUS_DETAIL_UNIQUE_NAME(benchmark_registrar)(local_benchmark_registry(), name, \
+                                                     __VA_ARGS__);                     \
+  }
+
+NONIUS_LOCAL_BENCHMARK("cker::BinaryArithmetic", [](nonius::chronometer meter) {
+  const auto lhs_shape = toShape(meter.param<LHS_SHAPE>());
+  const auto rhs_shape = toShape(meter.param<RHS_SHAPE>());
+  const auto output_shape = toShape(meter.param<OUTPUT_SHAPE>());
+
+  const auto activation = toActivation(meter.param<FUSED_ACT>());
+
+  nnfw::cker::BinaryArithmeticOpParam params;
+  params.type = toArithmeticType(meter.param<ARITHMETIC_TYPE>());
+  params.float_activation_min = activation.min;
+  params.float_activation_max = activation.max;
+  const bool need_broadcast = nnfw::cker::ProcessBroadcastShapes(lhs_shape, rhs_shape, &params);
+
+  // Keep divisors away from zero
+  const auto lhs = makeData(lhs_shape.FlatSize());
+  const auto rhs = makeData(rhs_shape.FlatSize(), 1.f, 2.f);
+  std::vector<float> output(output_shape.FlatSize());
+
+  const Cost cost{static_cast<double>(output.size()),
+                  sizeof(float) * static_cast<double>(lhs.size() + rhs.size() + output.size())};
+  const auto name = "cker::BinaryArithmetic(" + meter.param<ARITHMETIC_TYPE>() +
+                    (need_broadcast ? ", broadcast)" : ")");
+
+  // Run!
+  measure(meter, name, meter.param<LAYER>(), cost, [&]() {
+    if (need_broadcast)
+    {
+      nnfw::cker::BroadcastBinaryArithmeticOp(params, lhs_shape, lhs.data(), rhs_shape,
+                                              rhs.data(), output_shape, output.data());
+    }
+    else
+    {
+      nnfw::cker::BinaryArithmeticOp(params, lhs_shape, lhs.data(), rhs_shape, rhs.data(),
+                                     output_shape, output.data());
+    }
+  });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
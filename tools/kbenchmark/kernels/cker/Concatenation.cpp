@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Concatenation benchmark of cker
+ */
+
+#include "Utils.h"
+
+#include <cker/operation/Concatenation.h>
+
+using namespace kbenchmark::kernels::cker;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(LAYER, 0);
+
+NONIUS_PARAM(INPUT_SHAPES, std::string{"1,28,28,128;1,28,28,128"})
+NONIUS_PARAM(AXIS, 3);
+
+//
+// Benchmark Implementations
+//
+namespace
+{
+
+inline nonius::benchmark_registry &local_benchmark_registry()
+{
+  static nonius::benchmark_registry registry;
+  return registry;
+}
+
+} // namespace
+
+#define NONIUS_LOCAL_BENCHMARK(name, ...)                                              \
+  namespace                                                                            \
+  {                                                                                    \
+  static ::nonius::benchmark_registrar                                                 \
+      NONIUS_DETAIL_UNIQUE_NAME(benchmark_registrar)(local_benchmark_registry(), name, \
+                                                     __VA_ARGS__);                     \
+  }
+
+NONIUS_LOCAL_BENCHMARK("cker::Concatenation", [](nonius::chronometer meter) {
+  std::vector<nnfw::cker::Shape> input_shapes;
+  std::stringstream ss(meter.param<INPUT_SHAPES>());
+  std::string dims;
+  while (std::getline(ss, dims, ';'))
+  {
+    input_shapes.emplace_back(toShape(dims));
+  }
+  const int axis = meter.param<AXIS>();
+
+  nnfw::cker::Shape output_shape = input_shapes.at(0);
+  output_shape.SetDim(axis, 0);
+  std::vector<std::vector<float>> inputs;
+  std::vector<const nnfw::cker::Shape *> input_shape_ptrs;
+  std::vector<const float *> input_ptrs;
+  for (const auto &shape : input_shapes)
+  {
+    output_shape.SetDim(axis, output_shape.Dims(axis) + shape.Dims(axis));
+    inputs.emplace_back(makeData(shape.FlatSize()));
+    input_shape_ptrs.push_back(&shape);
+  }
+  for (const auto &input : inputs)
+  {
+    input_ptrs.push_back(input.data());
+  }
+  std::vector<float> output(output_shape.FlatSize());
+
+  nnfw::cker::ConcatenationParams params;
+  params.axis = axis;
+  params.inputs_count = input_shapes.size();
+
+  const Cost cost{0, sizeof(float) * 2 * static_cast<double>(output.size())};
+
+  // Run!
+  measure(meter, "cker::Concatenation", meter.param<LAYER>(), cost, [&]() {
+    nnfw::cker::Concatenation<float>(params, input_shape_ptrs.data(), input_ptrs.data(),
+                                     output_shape, output.data());
+  });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
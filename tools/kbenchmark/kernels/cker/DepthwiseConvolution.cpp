@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file DepthwiseConv2D benchmark of cker
+ */
+
+#include "Utils.h"
+
+#include <cker/operation/DepthwiseConv.h>
+
+using namespace kbenchmark::kernels::cker;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(LAYER, 0);
+
+NONIUS_PARAM(BATCH, 1);
+
+NONIUS_PARAM(IFM_C, 32);
+NONIUS_PARAM(IFM_H, 112);
+NONIUS_PARAM(IFM_W, 112);
+
+NONIUS_PARAM(OFM_C, 32);
+NONIUS_PARAM(OFM_H, 112);
+NONIUS_PARAM(OFM_W, 112);
+
+NONIUS_PARAM(KER_H, 3);
+NONIUS_PARAM(KER_W, 3);
+
+NONIUS_PARAM(STRIDE_H, 1);
+NONIUS_PARAM(STRIDE_W, 1);
+
+NONIUS_PARAM(MULTIPLIER, 1);
+
+NONIUS_PARAM(PADDING, std::string{"SAME"})
+NONIUS_PARAM(FUSED_ACT, std::string{"RELU6"})
+
+//
+// Benchmark Implementations
+//
+namespace
+{
+
+inline nonius::benchmark_registry &local_benchmark_registry()
+{
+  static nonius::benchmark_registry registry;
+  return registry;
+}
+
+} // namespace
+
+#define NONIUS_LOCAL_BENCHMARK(name, ...)                                              \
+  namespace                                                                            \
+  {                                                                                    \
+  static ::nonius::benchmark_registrar                                                 \
+      NONIUS_DETAIL_UNIQUE_NAME(benchmark_registrar)(local_benchmark_registry(), name, \
+                                                     __VA_ARGS__);                     \
+  }
+
+NONIUS_LOCAL_BENCHMARK("cker::DepthwiseConv_NHWC", [](nonius::chronometer meter) {
+  const int batch = meter.param<BATCH>();
+  const nnfw::cker::Shape input_shape{batch, meter.param<IFM_H>(), meter.param<IFM_W>(),
+                                      meter.param<IFM_C>()};
+  const nnfw::cker::Shape filter_shape{1, meter.param<KER_H>(), meter.param<KER_W>(),
+                                       meter.param<OFM_C>()};
+  const nnfw::cker::Shape bias_shape{meter.param<OFM_C>()};
+  const nnfw::cker::Shape output_shape{batch, meter.param<OFM_H>(), meter.param<OFM_W>(),
+                                       meter.param<OFM_C>()};
+
+  const auto padding =
+      calculatePadding(meter.param<PADDING>(), input_shape.Dims(1), input_shape.Dims(2),
+                       output_shape.Dims(1), output_shape.Dims(2), meter.param<STRIDE_H>(),
+                       meter.param<STRIDE_W>(), filter_shape.Dims(1), filter_shape.Dims(2));
+  const auto activation = toActivation(meter.param<FUSED_ACT>());
+
+  nnfw::cker::DepthwiseConvParams params;
+  params.stride_width = meter.param<STRIDE_W>();
+  params.stride_height = meter.param<STRIDE_H>();
+  params.dilation_width_factor = 1;
+  params.dilation_height_factor = 1;
+  params.padding_values.width = padding.left;
+  params.padding_values.height = padding.top;
+  params.depth_multiplier = meter.param<MULTIPLIER>();
+  params.float_activation_min = activation.min;
+  params.float_activation_max = activation.max;
+
+  const auto input = makeData(input_shape.FlatSize());
+  const auto filter = makeData(filter_shape.FlatSize());
+  const auto bias = makeData(bias_shape.FlatSize());
+  std::vector<float> output(output_shape.FlatSize());
+
+  const double macs =
+      static_cast<double>(output_shape.FlatSize()) * filter_shape.Dims(1) * filter_shape.Dims(2);
+  const Cost cost{2 * macs, sizeof(float) * (input.size() + filter.size() + bias.size() +
+                                             output.size())};
+
+  // Run!
+  measure(meter, "cker::DepthwiseConv_NHWC", meter.param<LAYER>(), cost, [&]() {
+    nnfw::cker::DepthwiseConv(params, input_shape, input.data(), filter_shape, filter.data(),
+                              bias_shape, bias.data(), output_shape, output.data());
+  });
+})
+
+NONIUS_LOCAL_BENCHMARK("cker::DepthwiseConvPerChannel_NHWC_int8", [](nonius::chronometer meter) {
+  const int batch = meter.param<BATCH>();
+  const nnfw::cker::Shape input_shape{batch, meter.param<IFM_H>(), meter.param<IFM_W>(),
+                                      meter.param<IFM_C>()};
+  const nnfw::cker::Shape filter_shape{1, meter.param<KER_H>(), meter.param<KER_W>(),
+                                       meter.param<OFM_C>()};
+  const nnfw::cker::Shape bias_shape{meter.param<OFM_C>()};
+  const nnfw::cker::Shape output_shape{batch, meter.param<OFM_H>(), meter.param<OFM_W>(),
+                                       meter.param<OFM_C>()};
+
+  const auto padding =
+      calculatePadding(meter.param<PADDING>(), input_shape.Dims(1), input_shape.Dims(2),
+                       output_shape.Dims(1), output_shape.Dims(2), meter.param<STRIDE_H>(),
+                       meter.param<STRIDE_W>(), filter_shape.Dims(1), filter_shape.Dims(2));
+  const auto activation = toActivation(meter.param<FUSED_ACT>());
+
+  nnfw::cker::DepthwiseConvParams params;
+  params.stride_width = meter.param<STRIDE_W>();
+  params.stride_height = meter.param<STRIDE_H>();
+  params.dilation_width_factor = 1;
+  params.dilation_height_factor = 1;
+  params.padding_values.width = padding.left;
+  params.padding_values.height = padding.top;
+  params.depth_multiplier = meter.param<MULTIPLIER>();
+  params.input_offset = 1;
+  params.output_offset = 0;
+  params.quantized_activation_min = activation.min < 0 ? -128 : 0;
+  params.quantized_activation_max = 127;
+
+  const auto input = makeInt8Data(input_shape.FlatSize());
+  const auto filter = makeInt8Data(filter_shape.FlatSize());
+  const std::vector<int32_t> bias(bias_shape.FlatSize(), 0);
+  std::vector<int8_t> output(output_shape.FlatSize());
+  const auto quant = makePerChannelQuantization(output_shape.Dims(3));
+
+  const double macs =
+      static_cast<double>(output_shape.FlatSize()) * filter_shape.Dims(1) * filter_shape.Dims(2);
+  const Cost cost{2 * macs, static_cast<double>(input.size() + filter.size() + output.size() +
+                                                sizeof(int32_t) * bias.size())};
+
+  // Run!
+  measure(meter, "cker::DepthwiseConvPerChannel_NHWC_int8", meter.param<LAYER>(), cost, [&]() {
+    nnfw::cker::DepthwiseConvPerChannel(params, quant.multiplier.data(), quant.shift.data(),
+                                        input_shape, input.data(), filter_shape, filter.data(),
+                                        bias_shape, bias.data(), output_shape, output.data());
+  });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file FullyConnected benchmark of cker
+ */
+
+#include "Utils.h"
+
+#include <cker/operation/FullyConnected.h>
+
+using namespace kbenchmark::kernels::cker;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(LAYER, 0);
+
+NONIUS_PARAM(BATCH, 1);
+NONIUS_PARAM(INPUT_SIZE, 1024);
+NONIUS_PARAM(OUTPUT_SIZE, 1000);
+
+NONIUS_PARAM(FUSED_ACT, std::string{"NONE"})
+
+//
+// Benchmark Implementations
+//
+namespace
+{
+
+inline nonius::benchmark_registry &local_benchmark_registry()
+{
+  static nonius::benchmark_registry registry;
+  return registry;
+}
+
+} // namespace
+
+#define NONIUS_LOCAL_BENCHMARK(name, ...)                                              \
+  namespace                                                                            \
+  {                                                                                    \
+  static ::nonius::benchmark_registrar                                                 \
+      NONIUS_DETAIL_UNIQUE_NAME(benchmark_registrar)(local_benchmark_registry(), name, \
+                                                     __VA_ARGS__);                     \
+  }
+
+NONIUS_LOCAL_BENCHMARK("cker::FullyConnected", [](nonius::chronometer meter) {
+  const nnfw::cker::Shape input_shape{meter.param<BATCH>(), meter.param<INPUT_SIZE>()};
+  const nnfw::cker::Shape weights_shape{meter.param<OUTPUT_SIZE>(), meter.param<INPUT_SIZE>()};
+  const nnfw::cker::Shape bias_shape{meter.param<OUTPUT_SIZE>()};
+  const nnfw::cker::Shape output_shape{meter.param<BATCH>(), meter.param<OUTPUT_SIZE>()};
+
+  const auto activation = toActivation(meter.param<FUSED_ACT>());
+
+  nnfw::cker::FullyConnectedParams params;
+  params.activation = activation.type;
+  params.float_activation_min = activation.min;
+  params.float_activation_max = activation.max;
+
+  const auto input = makeData(input_shape.FlatSize());
+  const auto weights = makeData(weights_shape.FlatSize());
+  const auto bias = makeData(bias_shape.FlatSize());
+  std::vector<float> output(output_shape.FlatSize());
+
+  const double macs = static_cast<double>(output_shape.FlatSize()) * weights_shape.Dims(1);
+  const Cost cost{2 * macs, sizeof(float) * (input.size() + weights.size() + bias.size() +
+                                             output.size())};
+
+  // Run!
+  measure(meter, "cker::FullyConnected", meter.param<LAYER>(), cost, [&]() {
+    nnfw::cker::FullyConnected(params, input_shape, input.data(), weights_shape, weights.data(),
+                               bias_shape, bias.data(), output_shape, output.data());
+  });
+})
+
+NONIUS_LOCAL_BENCHMARK("cker::FullyConnectedPerChannel_int8", [](nonius::chronometer meter) {
+  const nnfw::cker::Shape input_shape{meter.param<BATCH>(), meter.param<INPUT_SIZE>()};
+  const nnfw::cker::Shape weights_shape{meter.param<OUTPUT_SIZE>(), meter.param<INPUT_SIZE>()};
+  const nnfw::cker::Shape bias_shape{meter.param<OUTPUT_SIZE>()};
+  const nnfw::cker::Shape output_shape{meter.param<BATCH>(), meter.param<OUTPUT_SIZE>()};
+
+  const auto activation = toActivation(meter.param<FUSED_ACT>());
+
+  nnfw::cker::FullyConnectedParams params;
+  params.input_offset = 1;
+  params.output_offset = 0;
+  params.quantized_activation_min = activation.min < 0 ? -128 : 0;
+  params.quantized_activation_max = 127;
+  params.lhs_cacheable = true;
+
+  const auto input = makeInt8Data(input_shape.FlatSize());
+  const auto weights = makeInt8Data(weights_shape.FlatSize());
+  const std::vector<int32_t> bias(bias_shape.FlatSize(), 0);
+  std::vector<int8_t> output(output_shape.FlatSize());
+  const auto quant = makePerChannelQuantization(weights_shape.Dims(0));
+
+  const double macs = static_cast<double>(output_shape.FlatSize()) * weights_shape.Dims(1);
+  const Cost cost{2 * macs, static_cast<double>(input.size() + weights.size() + output.size() +
+                                                sizeof(int32_t) * bias.size())};
+
+  // Run!
+  measure(meter, "cker::FullyConnectedPerChannel_int8", meter.param<LAYER>(), cost, [&]() {
+    nnfw::cker::FullyConnectedPerChannel(params, quant.multiplier.data(), quant.shift.data(),
+                                         input_shape, input.data(), weights_shape, weights.data(),
+                                         bias_shape, bias.data(), output_shape, output.data());
+  });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Mean, Sum, ReduceMax, ReduceMin and ReduceProd benchmark of cker
+ */
+
+#include "Utils.h"
+
+#include <cker/operation/Reduce.h>
+#include <cker/operation/ReduceMean.h>
+
+using namespace kbenchmark::kernels::cker;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(LAYER, 0);
+
+NONIUS_PARAM(REDUCE_TYPE, std::string{"MEAN"})
+
+NONIUS_PARAM(INPUT_SHAPE, std::string{"1,7,7,1024"})
+NONIUS_PARAM(AXES, std::string{"1,2"})
+NONIUS_PARAM(KEEP_DIMS, 1);
+
+//
+// Helpers
+//
+namespace
+{
+
+using Reducer = float (*)(const float current, const float in);
+
+float sumReducer(const float current, const float in) { return in + current; }
+float prodReducer(const float current, const float in) { return in * current; }
+float maxReducer(const float current, const float in) { return in > current ? in : current; }
+float minReducer(const float current, const float in) { return in < current ? in : current; }
+
+std::pair<Reducer, float> toReducer(const std::string &name)
+{
+  if (name == "SUM")
+    return {sumReducer, 0.f};
+  if (name == "REDUCE_PROD")
+    return {prodReducer, 1.f};
+  if (name == "REDUCE_MAX")
+    return {maxReducer, std::numeric_limits<float>::lowest()};
+  if (name == "REDUCE_MIN")
+    return {minReducer, std::numeric_limits<float>::max()};
+  throw std::runtime_error{"Unsupported reduce type: " + name};
+}
+
+} // namespace
+
+//
+// Benchmark Implementations
+//
+namespace
+{
+
+inline nonius::benchmark_registry &local_benchmark_registry()
+{
+  static nonius::benchmark_registry registry;
+  return registry;
+}
+
+} // namespace
+
+#define NONIUS_LOCAL_BENCHMARK(name, ...)                                              \
+  namespace                                                                            \
+  {                                                                                    \
+  static ::nonius::benchmark_registrar                                                 \
+      NONIUS_DETAIL_UNIQUE_NAME(benchmark_registrar)(local_benchmark_registry(), name, \
+                                                     __VA_ARGS__);                     \
+  }
+
+NONIUS_LOCAL_BENCHMARK("cker::Reduce", [](nonius::chronometer meter) {
+  const auto input_shape = toShape(meter.param<INPUT_SHAPE>());
+  auto axes = toVector(meter.param<AXES>());
+
+  // Kernels take the output shape with reduced dimensions kept
+  auto output_shape = input_shape;
+  for (auto axis : axes)
+  {
+    output_shape.SetDim(axis, 1);
+  }
+
+  const auto input = makeData(input_shape.FlatSize());
+  std::vector<float> output(output_shape.FlatSize());
+
+  const auto type = meter.param<REDUCE_TYPE>();
+  const Cost cost{static_cast<double>(input.size()),
+                  sizeof(float) * static_cast<double>(input.size() + output.size())};
+  const auto name = "cker::Reduce(" + type + ")";
+
+  if (type == "MEAN")
+  {
+    // Run!
+    measure(meter, name, meter.param<LAYER>(), cost, [&]() {
+      nnfw::cker::Mean(input_shape, input.data(), output_shape, output.data(), axes);
+    });
+    return;
+  }
+
+  const auto reducer = toReducer(type);
+  nnfw::cker::Reduce reduce;
+  reduce.prepare(input_shape.DimensionsCount(), axes.size());
+
+  // Run!
+  measure(meter, name, meter.param<LAYER>(), cost, [&]() {
+    if (!reduce.ReduceGeneric<float>(input_shape, input.data(), output_shape, output.data(), axes,
+                                     meter.param<KEEP_DIMS>(), reducer.second, reducer.first))
+    {
+      throw std::runtime_error{"Reduce: Fail to run"};
+    }
+  });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Softmax benchmark of cker
+ */
+
+#include "Utils.h"
+
+#include <cker/operation/SoftMax.h>
+
+using namespace kbenchmark::kernels::cker;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(LAYER, 0);
+
+NONIUS_PARAM(INPUT_SHAPE, std::string{"1,1001"})
+
+//
+// Benchmark Implementations
+//
+namespace
+{
+
+inline nonius::benchmark_registry &local_benchmark_registry()
+{
+  static nonius::benchmark_registry registry;
+  return registry;
+}
+
+} // namespace
+
+#define NONIUS_LOCAL_BENCHMARK(name, ...)                                              \
+  namespace                                                                            \
+  {                                                                                    \
+  static ::nonius::benchmark_registrar                                                 \
+      NONIUS_DETAIL_UNIQUE_NAME(benchmark_registrar)(local_benchmark_registry(), name, \
+                                                     __VA_ARGS__);                     \
+  }
+
+NONIUS_LOCAL_BENCHMARK("cker::Softmax", [](nonius::chronometer meter) {
+  const auto shape = toShape(meter.param<INPUT_SHAPE>());
+
+  nnfw::cker::SoftmaxParams params;
+  params.beta = 1.f;
+
+  const auto input = makeData(shape.FlatSize());
+  std::vector<float> output(shape.FlatSize());
+
+  // Max, subtraction, exp, sum and normalization, counting exp as one operation
+  const Cost cost{5 * static_cast<double>(input.size()),
+                  sizeof(float) * static_cast<double>(input.size() + output.size())};
+
+  // Run!
+  measure(meter, "cker::Softmax", meter.param<LAYER>(), cost, [&]() {
+    nnfw::cker::Softmax(params, shape, input.data(), shape, output.data());
+  });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Transpose benchmark of cker
+ */
+
+#include "Utils.h"
+
+#include <cker/operation/Transpose.h>
+
+using namespace kbenchmark::kernels::cker;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(LAYER, 0);
+
+NONIUS_PARAM(INPUT_SHAPE, std::string{"1,56,56,64"})
+NONIUS_PARAM(PERM, std::string{"0,3,1,2"})
+
+//
+// Benchmark Implementations
+//
+namespace
+{
+
+inline nonius::benchmark_registry &local_benchmark_registry()
+{
+  static nonius::benchmark_registry registry;
+  return registry;
+}
+
+} // namespace
+
+#define NONIUS_LOCAL_BENCHMARK(name, ...)                                              \
+  namespace                                                                            \
+  {                                                                                    \
+  static ::nonius::benchmark_registrar                                                 \
+      NONIUS_DETAIL_UNIQUE_NAME(benchmark_registrar)(local_benchmark_registry(), name, \
+                                                     __VA_ARGS__);                     \
+  }
+
+NONIUS_LOCAL_BENCHMARK("cker::Transpose", [](nonius::chronometer meter) {
+  const auto input_shape = toShape(meter.param<INPUT_SHAPE>());
+  const auto perm = toVector(meter.param<PERM>());
+  if (perm.size() != static_cast<size_t>(input_shape.DimensionsCount()) || perm.size() > 4)
+  {
+    throw std::runtime_error{"Transpose: Wrong perm " + meter.param<PERM>()};
+  }
+
+  nnfw::cker::TransposeParams params;
+  params.perm_count = perm.size();
+  nnfw::cker::Shape output_shape(perm.size());
+  for (size_t i = 0; i < perm.size(); ++i)
+  {
+    params.perm[i] = perm[i];
+    output_shape.SetDim(i, input_shape.Dims(perm[i]));
+  }
+
+  const auto input = makeData(input_shape.FlatSize());
+  std::vector<float> output(output_shape.FlatSize());
+
+  const Cost cost{0, sizeof(float) * static_cast<double>(input.size() + output.size())};
+
+  // Run!
+  measure(meter, "cker::Transpose", meter.param<LAYER>(), cost, [&]() {
+    nnfw::cker::Transpose(params, input_shape, input.data(), output_shape, output.data());
+  });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __KBENCHMARK_KERNELS_CKER_UTILS_H__
+#define __KBENCHMARK_KERNELS_CKER_UTILS_H__
+
+#include <nonius/nonius.h++>
+
+#include <cker/Shape.h>
+#include <cker/Types.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace kbenchmark
+{
+namespace kernels
+{
+namespace cker
+{
+
+std::vector<int> toVector(const std::string &dims)
+{
+  std::vector<int> vec;
+  std::stringstream ss(dims);
+  int i;
+  while (ss >> i)
+  {
+    vec.push_back(i);
+    if (ss.peek() == ',')
+      ss.ignore();
+  }
+  return vec;
+}
+
+nnfw::cker::Shape toShape(const std::string &dims)
+{
+  const auto vec = toVector(dims);
+  return nnfw::cker::Shape(vec.size(), vec.data());
+}
+
+std::vector<float> makeData(int size, float min = -1.f, float max = 1.f)
+{
+  static std::mt19937 gen(0);
+  std::uniform_real_distribution<float> dist(min, max);
+  std::vector<float> data(size);
+  std::generate(data.begin(), data.end(), [&]() { return dist(gen); });
+  return data;
+}
+
+std::vector<int8_t> makeInt8Data(int size)
+{
+  static std::mt19937 gen(0);
+  std::uniform_int_distribution<int> dist(std::numeric_limits<int8_t>::min(),
+                                          std::numeric_limits<int8_t>::max());
+  std::vector<int8_t> data(size);
+  std::generate(data.begin(), data.end(), [&]() { return static_cast<int8_t>(dist(gen)); });
+  return data;
+}
+
+/**
+ * @brief Requantization of each output channel of int8 kernels, in the range that quantized
+ *        models have
+ */
+struct PerChannelQuantization
+{
+  std::vector<int32_t> multiplier;
+  std::vector<int> shift;
+};
+
+PerChannelQuantization makePerChannelQuantization(int num_channels)
+{
+  static std::mt19937 gen(0);
+  std::uniform_int_distribution<int32_t> multiplier_dist(1 << 30,
+                                                         std::numeric_limits<int32_t>::max());
+  std::uniform_int_distribution<int> shift_dist(-10, -6);
+  PerChannelQuantization quant;
+  for (int c = 0; c < num_channels; ++c)
+  {
+    quant.multiplier.push_back(multiplier_dist(gen));
+    quant.shift.push_back(shift_dist(gen));
+  }
+  return quant;
+}
+
+struct Activation
+{
+  nnfw::cker::FusedActivationFunctionType type;
+  float min;
+  float max;
+};
+
+Activation toActivation(const std::string &name)
+{
+  using nnfw::cker::FusedActivationFunctionType;
+  const float inf = std::numeric_limits<float>::infinity();
+  if (name == "NONE")
+    return Activation{FusedActivationFunctionType::kNone, -inf, inf};
+  if (name == "RELU")
+    return Activation{FusedActivationFunctionType::kRelu, 0.f, inf};
+  if (name == "RELU_N1_TO_1")
+    return Activation{FusedActivationFunctionType::kRelu1, -1.f, 1.f};
+  if (name == "RELU6")
+    return Activation{FusedActivationFunctionType::kRelu6, 0.f, 6.f};
+  throw std::runtime_error{"Unsupported fused activation: " + name};
+}
+
+struct PaddingInfo
+{
+  uint32_t top;
+  uint32_t left;
+};
+
+PaddingInfo calculatePadding(const std::string &padding_name, const uint32_t ifm_H,
+                             const uint32_t ifm_W, const uint32_t ofm_H, const uint32_t ofm_W,
+                             const uint32_t vertical_stride, const uint32_t horizontal_stride,
+                             const uint32_t ker_H, const uint32_t ker_W)
+{
+  if (padding_name == "SAME")
+  {
+    const int32_t vertical_needed_input = (ofm_H - 1) * vertical_stride + ker_H;
+    const int32_t vertical_total_padding = std::max(0, vertical_needed_input - (int32_t)ifm_H);
+
+    const int32_t horizontal_needed_input = (ofm_W - 1) * horizontal_stride + ker_W;
+    const int32_t horizontal_total_padding = std::max(0, horizontal_needed_input - (int32_t)ifm_W);
+
+    return PaddingInfo{static_cast<uint32_t>(vertical_total_padding / 2),
+                       static_cast<uint32_t>(horizontal_total_padding / 2)};
+  }
+  return PaddingInfo{0, 0};
+}
+
+/**
+ * @brief Work of one run of a kernel, to report throughput
+ */
+struct Cost
+{
+  double flops; //< Floating-point operations, 0 for data movement kernels
+  double bytes; //< Bytes of tensors read and written
+};
+
+/**
+ * @brief Table of throughputs of benchmarks at their best samples, which is printed when the
+ *        kernel library is unloaded
+ */
+class ThroughputTable
+{
+public:
+  static ThroughputTable &get(void)
+  {
+    static ThroughputTable table;
+    return table;
+  }
+
+  void record(const std::string &name, int layer, const Cost &cost, double seconds)
+  {
+    auto &entry = _entries[std::make_pair(name, layer)];
+    if (entry.seconds == 0 || seconds < entry.seconds)
+    {
+      entry.cost = cost;
+      entry.seconds = seconds;
+    }
+  }
+
+private:
+  ThroughputTable() = default;
+  ~ThroughputTable()
+  {
+    if (_entries.empty())
+      return;
+
+    std::cout << "Throughput at the best sample" << std::endl;
+    std::cout << std::fixed << std::setprecision(3);
+    for (const auto &e : _entries)
+    {
+      const auto &entry = e.second;
+      std::cout << "    " << e.first.first << " (layer " << e.first.second << "): ";
+      if (entry.cost.flops > 0)
+        std::cout << entry.cost.flops / entry.seconds / 1e9 << " GFLOP/s, ";
+      std::cout << entry.cost.bytes / entry.seconds / 1e9 << " GB/s" << std::endl;
+    }
+  }
+
+private:
+  struct Entry
+  {
+    Cost cost{0, 0};
+    double seconds = 0;
+  };
+  std::map<std::pair<std::string, int>, Entry> _entries;
+};
+
+/**
+ * @brief Measure a kernel with nonius, and record its throughput in ThroughputTable
+ */
+template <typename Fun>
+void measure(nonius::chronometer &meter, const std::string &name, int layer, const Cost &cost,
+             Fun &&fun)
+{
+  const auto start = std::chrono::steady_clock::now();
+  meter.measure([&](int) { fun(); });
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  ThroughputTable::get().record(name, layer, cost, elapsed.count() / meter.runs());
+}
+
+} // namespace cker
+} // namespace kernels
+} // namespace kbenchmark
+
+#endif // __KBENCHMARK_KERNELS_CKER_UTILS_H__
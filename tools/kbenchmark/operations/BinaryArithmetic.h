@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __KBENCHMARK_OPERATIONS_BINARY_ARITHMETIC_H__
+#define __KBENCHMARK_OPERATIONS_BINARY_ARITHMETIC_H__
+
+#include "Operation.h"
+#include "Utils.h"
+
+namespace kbenchmark
+{
+namespace operation
+{
+
+class BinaryArithmetic : public Operation
+{
+public:
+  BinaryArithmetic(const std::string &type) : _type{type} {}
+
+  nonius::parameters params(int layer_num, OperationInfo &info) override
+  {
+    nonius::parameters params;
+
+    params.insert({"LAYER", nonius::param{layer_num}});
+
+    params.insert({"ARITHMETIC_TYPE", nonius::param{_type}});
+
+    // Shapes are passed as comma-separated dimensions since their ranks differ
+    auto _lhs = get_key_dims({"input0"}, info);
+    auto _rhs = get_key_dims({"input1"}, info);
+    auto _output0 = get_key_dims({"output0"}, info);
+    params.insert({"LHS_SHAPE", nonius::param{to_string(_lhs)}});
+    params.insert({"RHS_SHAPE", nonius::param{to_string(_rhs)}});
+    params.insert({"OUTPUT_SHAPE", nonius::param{to_string(_output0)}});
+
+    auto _act = get_key_string({"fused_act"}, "NONE", info);
+    params.insert({"FUSED_ACT", nonius::param{_act}});
+
+    return params;
+  }
+
+private:
+  std::string _type;
+};
+
+class Add final : public BinaryArithmetic
+{
+public:
+  Add() : BinaryArithmetic{"ADD"} {}
+};
+
+class Sub final : public BinaryArithmetic
+{
+public:
+  Sub() : BinaryArithmetic{"SUB"} {}
+};
+
+class Mul final : public BinaryArithmetic
+{
+public:
+  Mul() : BinaryArithmetic{"MUL"} {}
+};
+
+class Div final : public BinaryArithmetic
+{
+public:
+  Div() : BinaryArithmetic{"DIV"} {}
+};
+
+} // namespace operation
+} // namespace kbenchmark
+
+#endif // __KBENCHMARK_OPERATIONS_BINARY_ARITHMETIC_H__
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __KBENCHMARK_OPERATIONS_CONCATENATION_H__
+#define __KBENCHMARK_OPERATIONS_CONCATENATION_H__
+
+#include "Operation.h"
+#include "Utils.h"
+
+namespace kbenchmark
+{
+namespace operation
+{
+
+class Concatenation final : public Operation
+{
+public:
+  Concatenation() = default;
+
+  nonius::parameters params(int layer_num, OperationInfo &info) override
+  {
+    nonius::parameters params;
+
+    params.insert({"LAYER", nonius::param{layer_num}});
+
+    // Input shapes are separated by ';'
+    auto _input_counts = get_key_int({"input_counts"}, info);
+    auto _output0 = get_key_dims({"output0"}, info);
+    std::string input_shapes;
+    int axis = _output0.size() - 1;
+    for (int i = 0; i < _input_counts; ++i)
+    {
+      auto _input = get_key_dims("input" + std::to_string(i), info);
+      input_shapes += (i == 0 ? "" : ";") + to_string(_input);
+
+      // The configuration file does not have axis, so it is the dimension which output differs
+      for (size_t d = 0; d < _input.size(); ++d)
+      {
+        if (_input[d] != _output0[d])
+          axis = d;
+      }
+    }
+    params.insert({"INPUT_SHAPES", nonius::param{input_shapes}});
+    params.insert({"AXIS", nonius::param{axis}});
+
+    return params;
+  }
+};
+
+} // namespace operation
+} // namespace kbenchmark
+
+#endif // __KBENCHMARK_OPERATIONS_CONCATENATION_H__
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __KBENCHMARK_OPERATIONS_REDUCE_H__
+#define __KBENCHMARK_OPERATIONS_REDUCE_H__
+
+#include "Operation.h"
+#include "Utils.h"
+
+namespace kbenchmark
+{
+namespace operation
+{
+
+class Reduce : public Operation
+{
+public:
+  Reduce(const std::string &type) : _type{type} {}
+
+  nonius::parameters params(int layer_num, OperationInfo &info) override
+  {
+    nonius::parameters params;
+
+    params.insert({"LAYER", nonius::param{layer_num}});
+
+    params.insert({"REDUCE_TYPE", nonius::param{_type}});
+
+    auto _input = get_key_dims({"input0"}, info);
+    auto _output0 = get_key_dims({"output0"}, info);
+    params.insert({"INPUT_SHAPE", nonius::param{to_string(_input)}});
+
+    // The configuration file has the shape of axes only, so axes are inferred from the shapes.
+    // Without keep_dims, a dimension of input is reduced if the next dimension of output does not
+    // match it.
+    const bool keep_dims = (_input.size() == _output0.size());
+    std::vector<int> axes;
+    size_t o = 0;
+    for (size_t i = 0; i < _input.size(); ++i)
+    {
+      if (keep_dims)
+      {
+        if (_output0[i] != _input[i])
+          axes.push_back(i);
+      }
+      else if (o < _output0.size() && _output0[o] == _input[i])
+      {
+        ++o;
+      }
+      else
+      {
+        axes.push_back(i);
+      }
+    }
+    params.insert({"AXES", nonius::param{to_string(axes)}});
+    params.insert({"KEEP_DIMS", nonius::param{keep_dims ? 1 : 0}});
+
+    return params;
+  }
+
+private:
+  std::string _type;
+};
+
+class Mean final : public Reduce
+{
+public:
+  Mean() : Reduce{"MEAN"} {}
+};
+
+class Sum final : public Reduce
+{
+public:
+  Sum() : Reduce{"SUM"} {}
+};
+
+class ReduceMax final : public Reduce
+{
+public:
+  ReduceMax() : Reduce{"REDUCE_MAX"} {}
+};
+
+class ReduceMin final : public Reduce
+{
+public:
+  ReduceMin() : Reduce{"REDUCE_MIN"} {}
+};
+
+class ReduceProd final : public Reduce
+{
+public:
+  ReduceProd() : Reduce{"REDUCE_PROD"} {}
+};
+
+} // namespace operation
+} // namespace kbenchmark
+
+#endif // __KBENCHMARK_OPERATIONS_REDUCE_H__
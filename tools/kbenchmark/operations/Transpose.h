@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __KBENCHMARK_OPERATIONS_TRANSPOSE_H__
+#define __KBENCHMARK_OPERATIONS_TRANSPOSE_H__
+
+#include "Operation.h"
+#include "Utils.h"
+
+namespace kbenchmark
+{
+namespace operation
+{
+
+class Transpose final : public Operation
+{
+public:
+  Transpose() = default;
+
+  nonius::parameters params(int layer_num, OperationInfo &info) override
+  {
+    nonius::parameters params;
+
+    params.insert({"LAYER", nonius::param{layer_num}});
+
+    auto _input = get_key_dims({"input0"}, info);
+    auto _output0 = get_key_dims({"output0"}, info);
+    params.insert({"INPUT_SHAPE", nonius::param{to_string(_input)}});
+
+    // The configuration file has the shape of perm only, so perm is inferred from the shapes.
+    // Each output dimension takes the first unused input dimension of the same size.
+    std::vector<int> perm;
+    std::vector<bool> used(_input.size(), false);
+    for (auto dim : _output0)
+    {
+      for (size_t i = 0; i < _input.size(); ++i)
+      {
+        if (!used[i] && _input[i] == dim)
+        {
+          used[i] = true;
+          perm.push_back(i);
+          break;
+        }
+      }
+    }
+    params.insert({"PERM", nonius::param{to_string(perm)}});
+
+    return params;
+  }
+};
+
+} // namespace operation
+} // namespace kbenchmark
+
+#endif // __KBENCHMARK_OPERATIONS_TRANSPOSE_H__